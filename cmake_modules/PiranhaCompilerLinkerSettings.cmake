@@ -1,7 +1,7 @@
 include(YACMACompilerLinkerSettings)
 include(CheckTypeSize)
 
-# Macro to detect the 128-bit unsigned integer type available on some compilers.
+# Macro to detect the 128-bit integer types available on some compilers.
 macro(PIRANHA_CHECK_UINT128_T)
 	message(STATUS "Looking for a 128-bit unsigned integer type.")
 	# NOTE: for now we support only the GCC integer.
@@ -14,6 +14,14 @@ macro(PIRANHA_CHECK_UINT128_T)
 	else()
 		message(STATUS "No 128-bit unsigned integer type detected.")
 	endif()
+	message(STATUS "Looking for a 128-bit signed integer type.")
+	CHECK_TYPE_SIZE("__int128_t" PIRANHA_INT128_T)
+	if(PIRANHA_INT128_T)
+		message(STATUS "128-bit signed integer type detected.")
+		set(PIRANHA_HAVE_INT128_T "#define PIRANHA_INT128_T __int128_t")
+	else()
+		message(STATUS "No 128-bit signed integer type detected.")
+	endif()
 endmacro()
 
 # Setup the C++ standard flag. We try C++14 first, if not available we go with C++11.
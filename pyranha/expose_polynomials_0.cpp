@@ -48,6 +48,8 @@ void expose_polynomials_0()
     bp::enum_<piranha::polynomial_gcd_algorithm>("polynomial_gcd_algorithm")
         .value("automatic", piranha::polynomial_gcd_algorithm::automatic)
         .value("prs_sr", piranha::polynomial_gcd_algorithm::prs_sr)
-        .value("heuristic", piranha::polynomial_gcd_algorithm::heuristic);
+        .value("heuristic", piranha::polynomial_gcd_algorithm::heuristic)
+        .value("brown", piranha::polynomial_gcd_algorithm::brown)
+        .value("zippel", piranha::polynomial_gcd_algorithm::zippel);
 }
 }
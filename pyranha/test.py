@@ -592,7 +592,7 @@ class polynomial_test_case(_ut.TestCase):
 		pt.reset_default_gcd_algorithm()
 		self.assertEqual(pt.get_default_gcd_algorithm(),pga.automatic)
 		def gcd_check(a,b,cmp):
-			for algo in [pga.automatic,pga.prs_sr,pga.heuristic]:
+			for algo in [pga.automatic,pga.prs_sr,pga.heuristic,pga.brown,pga.zippel]:
 				res = pt.gcd(a,b,algo)
 				self.assert_(res[0] == cmp or res[0] == -cmp)
 				res = pt.gcd(a,b,True,algo)
@@ -0,0 +1,189 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PIRANHA_DETAIL_GMP_MEMORY_POOL_HPP
+#define PIRANHA_DETAIL_GMP_MEMORY_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <gmp.h>
+
+#include "../config.hpp"
+
+namespace piranha
+{
+
+namespace detail
+{
+
+// Thread-local size-class pools for the memory allocated by GMP. The pools are hooked into GMP via
+// mp_set_memory_functions(), and they sit on top of the memory functions that were in use before the installation
+// (normally, GMP's defaults).
+//
+// The idea is the following:
+// - only requests whose size is a multiple of the granularity, up to a maximum size, are pooled. These cover
+//   the limb arrays of small/medium-sized mpz_t, which are what gets allocated and freed over and over in series
+//   arithmetic. Everything else (e.g., the strings returned by mpz_get_str()) goes straight to the old functions;
+// - a pooled block of size n is always obtained from the old allocation function with a size of exactly n, so that
+//   blocks allocated before the installation of the pool (or by a different thread) can be cached safely,
+//   and cached blocks can be given back to the old free function at any time;
+// - blocks are cached in the pool of the thread that frees them, up to a maximum number per size class. Blocks
+//   freed from a thread different from the allocating one just migrate between pools;
+// - the state of the pool is a trivial thread-local object, which remains accessible during thread (and program)
+//   shutdown. A separate thread-local guard object gives the cached blocks back when the thread exits, after which
+//   the pool becomes a pass-through to the old functions. This makes it safe for other thread-local/static objects
+//   to free GMP memory during shutdown.
+template <typename = void>
+struct gmp_memory_pool {
+    using alloc_func_t = void *(*)(std::size_t);
+    using realloc_func_t = void *(*)(void *, std::size_t, std::size_t);
+    using free_func_t = void (*)(void *, std::size_t);
+    // Granularity of the size classes, in bytes.
+    static const std::size_t granularity = sizeof(::mp_limb_t);
+    // Number of size classes.
+    static const std::size_t n_classes = 64u;
+    // Max number of cached blocks per size class.
+    static const unsigned max_cached = 64u;
+    struct state {
+        void *m_heads[n_classes];
+        unsigned m_counts[n_classes];
+        bool m_init;
+        bool m_dead;
+    };
+    struct guard {
+        ~guard()
+        {
+            auto &st = get_state();
+            drain(st);
+            st.m_dead = true;
+        }
+    };
+    // NOTE: the state is zero-initialised (thread storage duration).
+    static state &get_state()
+    {
+        static thread_local state st;
+        return st;
+    }
+    static void init_state(state &st)
+    {
+        st.m_init = true;
+        // Construct the guard on first use, so that its destructor is registered.
+        static thread_local guard g;
+        (void)g;
+    }
+    static void drain(state &st)
+    {
+        for (std::size_t i = 0u; i < n_classes; ++i) {
+            while (st.m_heads[i]) {
+                void *next = *static_cast<void **>(st.m_heads[i]);
+                s_old_free(st.m_heads[i], (i + 1u) * granularity);
+                st.m_heads[i] = next;
+            }
+            st.m_counts[i] = 0u;
+        }
+    }
+    // Size class of a request of n bytes, n_classes if the request is not pooled.
+    static std::size_t class_idx(std::size_t n)
+    {
+        return (n != 0u && n % granularity == 0u && n <= n_classes * granularity) ? n / granularity - 1u : n_classes;
+    }
+    static void *allocate(std::size_t n)
+    {
+        const auto idx = class_idx(n);
+        if (idx < n_classes) {
+            auto &st = get_state();
+            if (likely(st.m_counts[idx] != 0u)) {
+                void *retval = st.m_heads[idx];
+                st.m_heads[idx] = *static_cast<void **>(retval);
+                --st.m_counts[idx];
+                return retval;
+            }
+        }
+        return s_old_alloc(n);
+    }
+    static void deallocate(void *p, std::size_t n)
+    {
+        const auto idx = class_idx(n);
+        if (idx < n_classes) {
+            auto &st = get_state();
+            if (unlikely(!st.m_init)) {
+                init_state(st);
+            }
+            if (likely(!st.m_dead && st.m_counts[idx] < max_cached)) {
+                *static_cast<void **>(p) = st.m_heads[idx];
+                st.m_heads[idx] = p;
+                ++st.m_counts[idx];
+                return;
+            }
+        }
+        s_old_free(p, n);
+    }
+    static void *reallocate(void *p, std::size_t old_n, std::size_t new_n)
+    {
+        if (class_idx(old_n) == n_classes && class_idx(new_n) == n_classes) {
+            return s_old_realloc(p, old_n, new_n);
+        }
+        void *retval = allocate(new_n);
+        std::memcpy(retval, p, std::min(old_n, new_n));
+        deallocate(p, old_n);
+        return retval;
+    }
+    // Install the pool. This must be called before GMP is used concurrently from multiple threads,
+    // as mp_set_memory_functions() is not thread-safe.
+    static void install()
+    {
+        ::mp_get_memory_functions(&s_old_alloc, &s_old_realloc, &s_old_free);
+        ::mp_set_memory_functions(allocate, reallocate, deallocate);
+    }
+    static alloc_func_t s_old_alloc;
+    static realloc_func_t s_old_realloc;
+    static free_func_t s_old_free;
+};
+
+template <typename T>
+const std::size_t gmp_memory_pool<T>::granularity;
+
+template <typename T>
+const std::size_t gmp_memory_pool<T>::n_classes;
+
+template <typename T>
+const unsigned gmp_memory_pool<T>::max_cached;
+
+template <typename T>
+typename gmp_memory_pool<T>::alloc_func_t gmp_memory_pool<T>::s_old_alloc = nullptr;
+
+template <typename T>
+typename gmp_memory_pool<T>::realloc_func_t gmp_memory_pool<T>::s_old_realloc = nullptr;
+
+template <typename T>
+typename gmp_memory_pool<T>::free_func_t gmp_memory_pool<T>::s_old_free = nullptr;
+}
+}
+
+#endif
@@ -0,0 +1,548 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PIRANHA_DETAIL_GROUPED_SUBS_HPP
+#define PIRANHA_DETAIL_GROUPED_SUBS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <boost/numeric/conversion/cast.hpp>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../config.hpp"
+#include "../exceptions.hpp"
+#include "../math.hpp"
+#include "../mp_integer.hpp"
+#include "../mp_rational.hpp"
+#include "../symbol.hpp"
+#include "../symbol_set.hpp"
+#include "../thread_pool.hpp"
+#include "parallel_vector_transform.hpp"
+#include "sfinae_types.hpp"
+
+namespace piranha
+{
+namespace detail
+{
+
+// Check that a split of a key is a pair whose second element is a container of keys of the same type.
+template <typename Key, typename Split>
+using key_split_check =
+    typename std::enable_if<std::is_same<typename std::decay<typename Split::second_type>::type::value_type,
+                                         Key>::value>::type;
+
+// Detect the subs_split() method in a key.
+template <typename Key>
+struct key_has_subs_split {
+    template <typename K>
+    static auto test(const K &k)
+        -> decltype(key_split_check<K, decltype(k.subs_split(std::declval<const std::string &>(),
+                                                                std::declval<const symbol_set &>()))>(),
+                    sfinae_types::yes());
+    static sfinae_types::no test(...);
+    static const bool value = std::is_same<decltype(test(std::declval<const Key &>())), sfinae_types::yes>::value;
+};
+
+template <typename Key>
+const bool key_has_subs_split<Key>::value;
+
+// Detect the ipow_subs_split() method in a key.
+template <typename Key>
+struct key_has_ipow_subs_split {
+    template <typename K>
+    static auto test(const K &k)
+        -> decltype(key_split_check<K, decltype(k.ipow_subs_split(std::declval<const std::string &>(),
+                                                                     std::declval<const integer &>(),
+                                                                     std::declval<const symbol_set &>()))>(),
+                    sfinae_types::yes());
+    static sfinae_types::no test(...);
+    static const bool value = std::is_same<decltype(test(std::declval<const Key &>())), sfinae_types::yes>::value;
+};
+
+template <typename Key>
+const bool key_has_ipow_subs_split<Key>::value;
+
+// Detect if the subs_split() method of a key produces a single key.
+template <typename Key, typename = void>
+struct key_has_single_subs_split : std::false_type {
+};
+
+template <typename Key>
+struct key_has_single_subs_split<
+    Key, typename std::enable_if<std::is_same<typename decltype(std::declval<const Key &>().subs_split(
+                                                  std::declval<const std::string &>(),
+                                                  std::declval<const symbol_set &>()))::second_type,
+                                              std::array<Key, 1u>>::value>::type> : std::true_type {
+};
+
+// Detect if the ipow_subs_split() method of a key produces a single key.
+template <typename Key, typename = void>
+struct key_has_single_ipow_subs_split : std::false_type {
+};
+
+template <typename Key>
+struct key_has_single_ipow_subs_split<
+    Key, typename std::enable_if<std::is_same<typename decltype(std::declval<const Key &>().ipow_subs_split(
+                                                  std::declval<const std::string &>(), std::declval<const integer &>(),
+                                                  std::declval<const symbol_set &>()))::second_type,
+                                              std::array<Key, 1u>>::value>::type> : std::true_type {
+};
+
+// Number of threads to be used in the substitution of the terms of a series of the given size.
+template <typename Size>
+inline unsigned subs_n_threads(const Size &size)
+{
+    return (size == 0u) ? 1u : thread_pool::use_threads(size, Size(1000u));
+}
+
+// Pointers to the terms of the series s.
+template <typename Series>
+inline std::vector<typename Series::term_type const *> subs_term_pointers(const Series &s)
+{
+    std::vector<typename Series::term_type const *> retval;
+    retval.reserve(static_cast<decltype(retval.size())>(s.size()));
+    for (const auto &t : s._container()) {
+        retval.push_back(&t);
+    }
+    return retval;
+}
+
+// Group the terms of a series according to the ids of their splits (see grouped_subs()). The return value contains
+// the indices of the terms in each group, with the groups sorted by id.
+template <typename Split>
+inline std::vector<std::vector<typename std::vector<Split>::size_type>> group_splits(const std::vector<Split> &splits)
+{
+    using index_type = typename std::vector<Split>::size_type;
+    std::map<typename std::decay<typename Split::first_type>::type, std::vector<index_type>> groups;
+    for (index_type i = 0u; i < splits.size(); ++i) {
+        groups[splits[i].first].push_back(i);
+    }
+    std::vector<std::vector<index_type>> retval;
+    retval.reserve(static_cast<decltype(retval.size())>(groups.size()));
+    for (auto &p : groups) {
+        retval.push_back(std::move(p.second));
+    }
+    return retval;
+}
+
+// Sum over the groups of terms of the products between the values associated to each group and the series built
+// from the coefficients of the group and the keys of the splits. values(g) must return a vector containing the values
+// of the group g, one for each key in the splits. The groups are processed in parallel (largest groups first), and
+// their contributions are accumulated in the order of the groups, so that the result does not depend on the number
+// of threads.
+template <typename RetT, typename Series, typename Split, typename Index, typename Values>
+inline RetT grouped_subs_sum(const Series &s, const std::vector<typename Series::term_type const *> &terms,
+                             std::vector<Split> &splits, const std::vector<std::vector<Index>> &groups,
+                             const Values &values, unsigned n_threads)
+{
+    using term_type = typename Series::term_type;
+    const auto n_groups = groups.size();
+    std::vector<RetT> partials(n_groups);
+    const auto &s_set = s.get_symbol_set();
+    auto compute = [&](Index g) {
+        const auto &idx = groups[g];
+        auto v = values(g);
+        if (unlikely(v.size() != splits[idx[0u]].second.size())) {
+            piranha_throw(std::invalid_argument, "inconsistent key splitting in grouped substitution");
+        }
+        RetT partial(0);
+        for (decltype(v.size()) j = 0u; j < v.size(); ++j) {
+            Series tmp;
+            tmp.set_symbol_set(s_set);
+            for (const auto &i : idx) {
+                // NOTE: each key is used only once, and no two groups share an index.
+                tmp.insert(term_type(terms[i]->m_cf, std::move(splits[i].second[j])));
+            }
+            partial += std::move(tmp) * std::move(v[j]);
+        }
+        partials[g] = std::move(partial);
+    };
+    const unsigned n_g_threads = (n_groups < n_threads) ? static_cast<unsigned>(n_groups) : n_threads;
+    if (n_g_threads <= 1u) {
+        for (Index g = 0u; g < n_groups; ++g) {
+            compute(g);
+        }
+    } else {
+        // Schedule the largest groups first, handing out the groups dynamically.
+        std::vector<Index> order(n_groups);
+        for (Index g = 0u; g < n_groups; ++g) {
+            order[g] = g;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&groups](Index a, Index b) { return groups[a].size() > groups[b].size(); });
+        std::atomic<Index> next(0u);
+        auto worker = [&next, &order, &compute, n_groups]() {
+            while (true) {
+                const auto g = next.fetch_add(1u);
+                if (g >= n_groups) {
+                    break;
+                }
+                compute(order[g]);
+            }
+        };
+        future_list<decltype(worker())> ff_list;
+        try {
+            for (unsigned i = 0u; i < n_g_threads; ++i) {
+                ff_list.push_back(thread_pool::enqueue(i, worker));
+            }
+            // First let's wait for everything to finish.
+            ff_list.wait_all();
+            // Then, let's handle the exceptions.
+            ff_list.get_all();
+        } catch (...) {
+            ff_list.wait_all();
+            throw;
+        }
+    }
+    RetT retval(0);
+    for (auto &p : partials) {
+        retval += std::move(p);
+    }
+    return retval;
+}
+
+// Substitution in the keys of the series s, performed by grouping the terms.
+//
+// full(k) must return the result of the substitution in the key k, as a vector of (value, key) pairs.
+// split(k) must return a pair (group id, keys), where keys is an array containing the same keys that full(k) would
+// produce (in the same order), and the group id is such that all the keys with the same group id produce
+// the same values in full(). The terms of s are grouped by id, the values are computed only once per group by calling
+// full() on the first key of the group, and each value is multiplied by the series built from the coefficients
+// of the group and the corresponding keys from split(). That is, if the substitution is a power substitution, each
+// power is computed once and it is multiplied by the sum of its cofactors, instead of performing one power
+// and one series multiplication per term.
+//
+// The splitting and the groups are processed in parallel, and the contributions of the groups are accumulated
+// in the order of the group ids, so that the result does not depend on the number of threads.
+template <typename RetT, typename Series, typename Split, typename Full>
+inline RetT grouped_subs(const Series &s, const Split &split, const Full &full)
+{
+    using term_type = typename Series::term_type;
+    using key_type = typename term_type::key_type;
+    using split_type = decltype(split(std::declval<const key_type &>()));
+    using value_type = typename std::decay<decltype(full(std::declval<const key_type &>())[0u].first)>::type;
+    if (s.empty()) {
+        return RetT(0);
+    }
+    const auto terms = subs_term_pointers(s);
+    const unsigned n_threads = subs_n_threads(terms.size());
+    // Split the keys.
+    std::vector<split_type> splits(terms.size());
+    parallel_vector_transform(n_threads, terms, splits, [&split](term_type const *t) { return split(t->m_key); });
+    const auto groups = group_splits(splits);
+    return grouped_subs_sum<RetT>(s, terms, splits, groups,
+                                  [&full, &terms, &groups](decltype(groups.size()) g) {
+                                      auto f = full(terms[groups[g][0u]]->m_key);
+                                      std::vector<value_type> retval;
+                                      retval.reserve(static_cast<decltype(retval.size())>(f.size()));
+                                      for (auto &p : f) {
+                                          retval.push_back(std::move(p.first));
+                                      }
+                                      return retval;
+                                  },
+                                  n_threads);
+}
+
+// Accumulation of the products between the coefficients of the terms of s and the values of their groups, for the
+// case in which such products are coefficients and the return type is the series type. The products are accumulated
+// key by key, possibly without intermediate normalisations (see sum_accumulator), and the keys are partitioned
+// among the threads according to their hash values. The result is then built in a single output series, sized
+// in advance.
+template <typename RetT, typename Series, typename Split, typename Index, typename Value>
+inline RetT multi_grouped_subs_sum(const Series &s, const std::vector<typename Series::term_type const *> &terms,
+                                   std::vector<Split> &splits, const std::vector<std::vector<Index>> &groups,
+                                   std::vector<Value> &g_values, unsigned n_threads, const std::true_type &)
+{
+    using term_type = typename Series::term_type;
+    using cf_type = typename term_type::cf_type;
+    using key_type = typename term_type::key_type;
+    using size_type = typename Series::size_type;
+    using acc_map = std::unordered_map<key_type, sum_accumulator<cf_type>>;
+    std::vector<Index> term_group(terms.size()), idx(terms.size());
+    for (Index g = 0u; g < groups.size(); ++g) {
+        for (const auto &i : groups[g]) {
+            term_group[i] = g;
+        }
+    }
+    for (Index i = 0u; i < terms.size(); ++i) {
+        idx[i] = i;
+    }
+    // NOTE: the hashes are computed in advance, so that each thread reads and moves only its own keys.
+    std::vector<std::size_t> hashes(terms.size());
+    parallel_vector_transform(n_threads, idx, hashes,
+                              [&splits](Index i) { return std::hash<key_type>()(splits[i].second[0u]); });
+    std::vector<unsigned> parts(n_threads);
+    for (unsigned i = 0u; i < n_threads; ++i) {
+        parts[i] = i;
+    }
+    std::vector<acc_map> maps(n_threads);
+    parallel_vector_transform(n_threads, parts, maps, [&](unsigned p) {
+        acc_map retval;
+        retval.reserve(static_cast<typename acc_map::size_type>(terms.size() / n_threads));
+        for (Index i = 0u; i < terms.size(); ++i) {
+            if (hashes[i] % n_threads == p) {
+                retval[std::move(splits[i].second[0u])].multiply_accumulate(terms[i]->m_cf,
+                                                                            g_values[term_group[i]]);
+            }
+        }
+        return retval;
+    });
+    RetT retval;
+    retval.set_symbol_set(s.get_symbol_set());
+    auto &container = retval._container();
+    std::size_t size = 0u;
+    for (const auto &m : maps) {
+        size += m.size();
+    }
+    container.rehash(
+        boost::numeric_cast<size_type>(std::ceil(static_cast<double>(size) / container.max_load_factor())));
+    for (auto &m : maps) {
+        for (auto &p : m) {
+            retval.insert(term_type(p.second.get(), p.first));
+        }
+    }
+    return retval;
+}
+
+// General accumulation of the contributions of the groups.
+template <typename RetT, typename Series, typename Split, typename Index, typename Value>
+inline RetT multi_grouped_subs_sum(const Series &s, const std::vector<typename Series::term_type const *> &terms,
+                                   std::vector<Split> &splits, const std::vector<std::vector<Index>> &groups,
+                                   std::vector<Value> &g_values, unsigned n_threads, const std::false_type &)
+{
+    return grouped_subs_sum<RetT>(s, terms, splits, groups,
+                                  [&g_values](Index g) { return std::vector<Value>{std::move(g_values[g])}; },
+                                  n_threads);
+}
+
+// Simultaneous substitution of n symbols in the keys of the series s, for key types whose splits (see grouped_subs())
+// produce a single key. split(i, k) and subs(i, k) must return, respectively, the split of the key k and the result
+// of the substitution in k for the i-th symbol.
+//
+// The keys are split in chain with respect to all the symbols, and the terms are grouped according to the vectors
+// of ids thus obtained. The values of the substitution are tabulated per symbol and per id (e.g., each power of
+// each substituted value is computed only once), and the value associated to a group is the product of the tabulated
+// values of its ids. If the products between coefficients and values are coefficients and the return type is the
+// series type, the new terms are accumulated into a single output series. Otherwise, the groups are accumulated as in
+// grouped_subs().
+template <typename RetT, typename Series, typename Split, typename Subs>
+inline RetT multi_grouped_subs(const Series &s, std::size_t n, const Split &split, const Subs &subs)
+{
+    using term_type = typename Series::term_type;
+    using cf_type = typename term_type::cf_type;
+    using key_type = typename term_type::key_type;
+    using key_split_type = decltype(split(std::size_t(0u), std::declval<const key_type &>()));
+    static_assert(std::is_same<typename key_split_type::second_type, std::array<key_type, 1u>>::value,
+                  "Invalid key split type.");
+    using id_type = typename std::decay<typename key_split_type::first_type>::type;
+    using split_type = std::pair<std::vector<id_type>, std::array<key_type, 1u>>;
+    using value_type =
+        typename std::decay<decltype(subs(std::size_t(0u), std::declval<const key_type &>())[0u].first)>::type;
+    piranha_assert(n > 0u);
+    if (s.empty()) {
+        return RetT(0);
+    }
+    const auto terms = subs_term_pointers(s);
+    const unsigned n_threads = subs_n_threads(terms.size());
+    // Split in chain the key k with respect to the first m symbols.
+    auto chain_split = [&split](const key_type &k, std::size_t m) {
+        split_type retval;
+        retval.first.reserve(static_cast<decltype(retval.first.size())>(m));
+        retval.second[0u] = k;
+        for (std::size_t i = 0u; i < m; ++i) {
+            auto sp = split(i, retval.second[0u]);
+            retval.first.push_back(std::move(sp.first));
+            retval.second[0u] = std::move(sp.second[0u]);
+        }
+        return retval;
+    };
+    std::vector<split_type> splits(terms.size());
+    parallel_vector_transform(n_threads, terms, splits,
+                              [&chain_split, n](term_type const *t) { return chain_split(t->m_key, n); });
+    const auto groups = group_splits(splits);
+    using index_type = typename std::decay<decltype(groups[0u][0u])>::type;
+    // Per-symbol tables of values, indexed by id. The tables are filled in parallel, one symbol per task.
+    using table_type = std::map<id_type, value_type>;
+    std::vector<std::size_t> symbols(n);
+    for (std::size_t i = 0u; i < n; ++i) {
+        symbols[i] = i;
+    }
+    std::vector<table_type> tables(n);
+    parallel_vector_transform(n < n_threads ? static_cast<unsigned>(n) : n_threads, symbols, tables,
+                              [&](std::size_t i) {
+                                  table_type retval;
+                                  for (const auto &idx : groups) {
+                                      const auto &id = splits[idx[0u]].first[i];
+                                      if (retval.find(id) != retval.end()) {
+                                          continue;
+                                      }
+                                      // Substitution in the key obtained by substituting the first i symbols.
+                                      auto r = subs(i, chain_split(terms[idx[0u]]->m_key, i).second[0u]);
+                                      if (unlikely(r.size() != 1u)) {
+                                          piranha_throw(std::invalid_argument,
+                                                        "inconsistent key splitting in grouped substitution");
+                                      }
+                                      retval.emplace(id, std::move(r[0u].first));
+                                  }
+                                  return retval;
+                              });
+    // The values of the groups.
+    std::vector<index_type> g_idx(groups.size());
+    for (index_type g = 0u; g < groups.size(); ++g) {
+        g_idx[g] = g;
+    }
+    std::vector<value_type> g_values(groups.size());
+    parallel_vector_transform(groups.size() < n_threads ? static_cast<unsigned>(groups.size()) : n_threads, g_idx,
+                              g_values, [&groups, &splits, &tables, n](index_type g) {
+                                  const auto &ids = splits[groups[g][0u]].first;
+                                  value_type retval(tables[0u].find(ids[0u])->second);
+                                  for (std::size_t i = 1u; i < n; ++i) {
+                                      retval *= tables[i].find(ids[i])->second;
+                                  }
+                                  return retval;
+                              });
+    using direct = std::integral_constant<
+        bool, std::is_same<RetT, Series>::value
+                  && std::is_same<decltype(std::declval<const cf_type &>() * std::declval<const value_type &>()),
+                                  cf_type>::value>;
+    return multi_grouped_subs_sum<RetT>(s, terms, splits, groups, g_values, n_threads, direct{});
+}
+
+// Chained substitution of n symbols in the key k. f(i, k) must return the result of the substitution of the i-th
+// symbol in the key k, as a vector of (value, key) pairs. The substitution of each symbol is performed in the keys
+// resulting from the substitution of the previous symbols, and the values are multiplied together. Since the
+// substituted values are never subject to further substitutions, the substitution is simultaneous.
+template <typename Key, typename F>
+inline auto chain_key_subs(const Key &k, std::size_t n, const F &f) -> decltype(f(std::size_t(0u), k))
+{
+    piranha_assert(n > 0u);
+    auto retval = f(std::size_t(0u), k);
+    for (std::size_t i = 1u; i < n; ++i) {
+        decltype(retval) tmp;
+        for (const auto &p : retval) {
+            auto r = f(i, p.second);
+            for (auto &q : r) {
+                auto v(p.first);
+                v *= std::move(q.first);
+                tmp.emplace_back(std::move(v), std::move(q.second));
+            }
+        }
+        retval = std::move(tmp);
+    }
+    return retval;
+}
+
+// The items of a dictionary of simultaneous substitutions, as pointers to names and values.
+template <typename T>
+using subs_dict_items = std::vector<std::pair<const std::string *, const T *>>;
+
+// The items of the dictionary dict, sorted by name. If s_set is not null, only the names of the symbols
+// appearing in s_set are retained.
+template <typename T>
+inline subs_dict_items<T> sorted_subs_dict_items(const std::unordered_map<std::string, T> &dict,
+                                                 const symbol_set *s_set = nullptr)
+{
+    subs_dict_items<T> retval;
+    for (const auto &p : dict) {
+        if (s_set == nullptr || s_set->index_of(symbol(p.first)) != s_set->size()) {
+            retval.emplace_back(&p.first, &p.second);
+        }
+    }
+    std::sort(retval.begin(), retval.end(),
+              [](const std::pair<const std::string *, const T *> &a,
+                 const std::pair<const std::string *, const T *> &b) { return *a.first < *b.first; });
+    return retval;
+}
+
+// Accumulate the values f(t) for all the terms t of s. If the size of s is large enough, the terms are processed
+// concurrently in contiguous blocks, and the contributions of the blocks are then accumulated in order.
+template <typename RetT, typename Series, typename F>
+inline RetT blocked_subs(const Series &s, const F &f)
+{
+    if (s.empty()) {
+        return RetT(0);
+    }
+    const auto terms = subs_term_pointers(s);
+    const unsigned n_threads = subs_n_threads(terms.size());
+    const auto block_size = terms.size() / n_threads;
+    std::vector<unsigned> blocks(n_threads);
+    for (unsigned i = 0u; i < n_threads; ++i) {
+        blocks[i] = i;
+    }
+    std::vector<RetT> partials(n_threads);
+    parallel_vector_transform(n_threads, blocks, partials, [&terms, &f, block_size, n_threads](unsigned i) {
+        const auto b = i * block_size, e = (i == n_threads - 1u) ? terms.size() : (i + 1u) * block_size;
+        RetT retval(0);
+        for (auto j = b; j < e; ++j) {
+            retval += f(*terms[j]);
+        }
+        return retval;
+    });
+    RetT retval(0);
+    for (auto &p : partials) {
+        retval += std::move(p);
+    }
+    return retval;
+}
+
+// Substitution in the coefficients of the series s, for the case in which the substitution f(cf) yields a coefficient
+// of the same type. The keys are not affected, hence the result can be built by inserting directly the new
+// coefficients, without creating and multiplying one series per term. The coefficients are computed in parallel.
+template <typename Series, typename F>
+inline Series cf_only_subs(const Series &s, const F &f)
+{
+    using term_type = typename Series::term_type;
+    using cf_type = typename term_type::cf_type;
+    Series retval;
+    retval.set_symbol_set(s.get_symbol_set());
+    if (s.empty()) {
+        return retval;
+    }
+    const auto terms = subs_term_pointers(s);
+    std::vector<cf_type> cfs(terms.size());
+    parallel_vector_transform(subs_n_threads(terms.size()), terms, cfs,
+                              [&f](term_type const *t) { return f(t->m_cf); });
+    for (decltype(terms.size()) i = 0u; i < terms.size(); ++i) {
+        retval.insert(term_type(std::move(cfs[i]), terms[i]->m_key));
+    }
+    return retval;
+}
+}
+}
+
+#endif
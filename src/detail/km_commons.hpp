@@ -69,6 +69,13 @@ inline T km_merge_args(const symbol_set &orig_args, const symbol_set &new_args,
     }
     piranha_assert(std::is_sorted(orig_args.begin(), orig_args.end()));
     piranha_assert(std::is_sorted(new_args.begin(), new_args.end()));
+    if (std::equal(orig_args.begin(), orig_args.end(), new_args.begin())) {
+        // All the new symbols come after the old ones: decode directly into the new vector,
+        // and pad it with zeroes.
+        auto new_vector = km_unpack<VType, KaType>(orig_args, value);
+        new_vector.resize(static_cast<typename VType::size_type>(new_args.size()));
+        return KaType::encode(new_vector);
+    }
     const auto old_vector = km_unpack<VType, KaType>(orig_args, value);
     VType new_vector;
     auto it_new = new_args.begin();
@@ -76,7 +83,7 @@ inline T km_merge_args(const symbol_set &orig_args, const symbol_set &new_args,
         while (*it_new != orig_args[i]) {
             // NOTE: for arbitrary int types, value_type(0) might throw. Update docs
             // if needed.
-            new_vector.push_back(T(0));
+            new_vector.push_back(typename VType::value_type(0));
             piranha_assert(it_new != new_args.end());
             ++it_new;
             piranha_assert(it_new != new_args.end());
@@ -85,7 +92,7 @@ inline T km_merge_args(const symbol_set &orig_args, const symbol_set &new_args,
     }
     // Fill up arguments at the tail of new_args but not in orig_args.
     for (; it_new != new_args.end(); ++it_new) {
-        new_vector.push_back(T(0));
+        new_vector.push_back(typename VType::value_type(0));
     }
     piranha_assert(new_vector.size() == new_args.size());
     // Return new encoded value.
@@ -0,0 +1,772 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PIRANHA_DETAIL_MODULAR_GCD_HPP
+#define PIRANHA_DETAIL_MODULAR_GCD_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../config.hpp"
+#include "../exceptions.hpp"
+#include "parallel_vector_transform.hpp"
+
+namespace piranha
+{
+
+namespace detail
+{
+
+// Building blocks for the modular GCD algorithms of Brown and Zippel. See:
+// - Geddes, Czapor, Labahn, "Algorithms for computer algebra", chapter 7,
+// - Zippel, "Probabilistic algorithms for sparse polynomials" (1979),
+// - Zippel, "Interpolating polynomials from their values" (1990).
+// All the computations are done modulo primes smaller than 2**31, so that the product of two residues
+// always fits in a 64-bit unsigned integer.
+using mg_uint = std::uint_least64_t;
+
+// Exception to signal that a modular image could not be computed (e.g., too few evaluation
+// points available in the field).
+struct mg_failure : public base_exception {
+    explicit mg_failure(const std::string &s) : base_exception(s)
+    {
+    }
+};
+
+// Arithmetic in Z_p.
+class mg_field
+{
+public:
+    explicit mg_field(mg_uint p) : m_p(p)
+    {
+        piranha_assert(p > 2u && p < (mg_uint(1) << 31));
+    }
+    mg_uint add(mg_uint a, mg_uint b) const
+    {
+        const mg_uint r = a + b;
+        return r >= m_p ? r - m_p : r;
+    }
+    mg_uint sub(mg_uint a, mg_uint b) const
+    {
+        return a >= b ? a - b : a + (m_p - b);
+    }
+    mg_uint neg(mg_uint a) const
+    {
+        return a == 0u ? a : m_p - a;
+    }
+    mg_uint mul(mg_uint a, mg_uint b) const
+    {
+        return (a * b) % m_p;
+    }
+    mg_uint pow(mg_uint a, mg_uint n) const
+    {
+        mg_uint retval(1u);
+        while (n != 0u) {
+            if (n % 2u) {
+                retval = mul(retval, a);
+            }
+            a = mul(a, a);
+            n /= 2u;
+        }
+        return retval;
+    }
+    // Inverse via the extended Euclidean algorithm. a must be nonzero.
+    mg_uint inv(mg_uint a) const
+    {
+        piranha_assert(a != 0u && a < m_p);
+        std::int_least64_t r0 = static_cast<std::int_least64_t>(m_p), r1 = static_cast<std::int_least64_t>(a), t0 = 0,
+                           t1 = 1;
+        while (r1 != 0) {
+            const auto q = r0 / r1;
+            auto tmp = r0 - q * r1;
+            r0 = r1;
+            r1 = tmp;
+            tmp = t0 - q * t1;
+            t0 = t1;
+            t1 = tmp;
+        }
+        piranha_assert(r0 == 1);
+        return static_cast<mg_uint>(t0 < 0 ? t0 + static_cast<std::int_least64_t>(m_p) : t0);
+    }
+    mg_uint p() const
+    {
+        return m_p;
+    }
+
+private:
+    mg_uint m_p;
+};
+
+// Largest prime smaller than n, found by trial division. Returns zero if there is no such prime.
+inline mg_uint mg_prev_prime(mg_uint n)
+{
+    while (n > 3u) {
+        --n;
+        if (n % 2u == 0u || n % 3u == 0u) {
+            continue;
+        }
+        bool prime = true;
+        for (mg_uint d = 5u; d * d <= n; d += 6u) {
+            if (n % d == 0u || n % (d + 2u) == 0u) {
+                prime = false;
+                break;
+            }
+        }
+        if (prime) {
+            return n;
+        }
+    }
+    return 0u;
+}
+
+// Dense univariate polynomials over Z_p, stored as vectors of coefficients in increasing order
+// of degree and without trailing zeroes (the zero polynomial is the empty vector).
+using mg_upoly = std::vector<mg_uint>;
+
+inline void mg_utrim(mg_upoly &a)
+{
+    while (!a.empty() && a.back() == 0u) {
+        a.pop_back();
+    }
+}
+
+inline mg_uint mg_ueval(const mg_field &f, const mg_upoly &a, mg_uint x)
+{
+    mg_uint retval(0u);
+    for (auto it = a.rbegin(); it != a.rend(); ++it) {
+        retval = f.add(f.mul(retval, x), *it);
+    }
+    return retval;
+}
+
+inline void mg_uscale(const mg_field &f, mg_upoly &a, mg_uint c)
+{
+    if (c == 0u) {
+        a.clear();
+        return;
+    }
+    for (auto &x : a) {
+        x = f.mul(x, c);
+    }
+}
+
+inline void mg_umonic(const mg_field &f, mg_upoly &a)
+{
+    if (!a.empty()) {
+        mg_uscale(f, a, f.inv(a.back()));
+    }
+}
+
+// a += c * b.
+inline void mg_uaddmul(const mg_field &f, mg_upoly &a, const mg_upoly &b, mg_uint c)
+{
+    if (a.size() < b.size()) {
+        a.resize(b.size(), 0u);
+    }
+    for (mg_upoly::size_type i = 0u; i < b.size(); ++i) {
+        a[i] = f.add(a[i], f.mul(b[i], c));
+    }
+    mg_utrim(a);
+}
+
+// a *= (x - b).
+inline void mg_umul_linear(const mg_field &f, mg_upoly &a, mg_uint b)
+{
+    if (a.empty()) {
+        return;
+    }
+    a.push_back(0u);
+    for (auto i = a.size() - 1u; i > 0u; --i) {
+        a[i] = f.sub(a[i - 1u], f.mul(a[i], b));
+    }
+    a[0u] = f.neg(f.mul(a[0u], b));
+}
+
+inline mg_upoly mg_umul(const mg_field &f, const mg_upoly &a, const mg_upoly &b)
+{
+    if (a.empty() || b.empty()) {
+        return mg_upoly{};
+    }
+    mg_upoly retval(a.size() + b.size() - 1u, 0u);
+    for (mg_upoly::size_type i = 0u; i < a.size(); ++i) {
+        for (mg_upoly::size_type j = 0u; j < b.size(); ++j) {
+            retval[i + j] = f.add(retval[i + j], f.mul(a[i], b[j]));
+        }
+    }
+    return retval;
+}
+
+// Division with remainder: a is replaced by the remainder, the quotient is returned. b must be nonzero.
+inline mg_upoly mg_udivrem(const mg_field &f, mg_upoly &a, const mg_upoly &b)
+{
+    piranha_assert(!b.empty());
+    if (a.size() < b.size()) {
+        return mg_upoly{};
+    }
+    const mg_uint ilc = f.inv(b.back());
+    mg_upoly q(a.size() - b.size() + 1u, 0u);
+    for (auto i = q.size(); i > 0u; --i) {
+        const auto k = i - 1u;
+        const mg_uint c = f.mul(a[k + b.size() - 1u], ilc);
+        q[k] = c;
+        if (c != 0u) {
+            for (mg_upoly::size_type j = 0u; j < b.size(); ++j) {
+                a[k + j] = f.sub(a[k + j], f.mul(c, b[j]));
+            }
+        }
+    }
+    mg_utrim(a);
+    return q;
+}
+
+// Monic GCD.
+inline mg_upoly mg_ugcd(const mg_field &f, mg_upoly a, mg_upoly b)
+{
+    while (!b.empty()) {
+        mg_udivrem(f, a, b);
+        std::swap(a, b);
+    }
+    mg_umonic(f, a);
+    return a;
+}
+
+// Sparse multivariate polynomials over Z_p. The exponents of the terms are stored contiguously in m_expos,
+// and the terms are sorted in decreasing lexicographic order (the first variable being the most significant).
+struct mg_mpoly {
+    explicit mg_mpoly(unsigned nv = 0u) : m_nv(nv)
+    {
+    }
+    std::vector<mg_uint>::size_type size() const
+    {
+        return m_cfs.size();
+    }
+    bool empty() const
+    {
+        return m_cfs.empty();
+    }
+    const unsigned *expos(std::vector<mg_uint>::size_type i) const
+    {
+        return m_expos.data() + i * m_nv;
+    }
+    void push_back(const unsigned *e, mg_uint cf)
+    {
+        m_expos.insert(m_expos.end(), e, e + m_nv);
+        m_cfs.push_back(cf);
+    }
+    // Sort the terms in decreasing lexicographic order.
+    void sort()
+    {
+        std::vector<std::vector<mg_uint>::size_type> perm(size());
+        std::iota(perm.begin(), perm.end(), decltype(size())(0u));
+        std::sort(perm.begin(), perm.end(), [this](decltype(size()) i, decltype(size()) j) {
+            return std::lexicographical_compare(expos(j), expos(j) + m_nv, expos(i), expos(i) + m_nv);
+        });
+        mg_mpoly tmp(m_nv);
+        tmp.m_expos.reserve(m_expos.size());
+        tmp.m_cfs.reserve(m_cfs.size());
+        for (auto i : perm) {
+            tmp.push_back(expos(i), m_cfs[i]);
+        }
+        *this = std::move(tmp);
+    }
+    unsigned m_nv;
+    std::vector<unsigned> m_expos;
+    std::vector<mg_uint> m_cfs;
+};
+
+// Make a multivariate polynomial monic (i.e., with unitary leading coefficient).
+inline void mg_mmonic(const mg_field &f, mg_mpoly &a)
+{
+    if (!a.empty()) {
+        const mg_uint ilc = f.inv(a.m_cfs[0u]);
+        for (auto &c : a.m_cfs) {
+            c = f.mul(c, ilc);
+        }
+    }
+}
+
+// Representation of a multivariate polynomial in n variables as a polynomial in the first n - 1 variables
+// with coefficients in Z_p[x_n]. The monomials are stored contiguously in m_monos, in decreasing lexicographic
+// order.
+struct mg_rpoly {
+    unsigned m_nv;
+    std::vector<unsigned> m_monos;
+    std::vector<mg_upoly> m_cfs;
+    const unsigned *mono(std::vector<mg_upoly>::size_type i) const
+    {
+        return m_monos.data() + i * m_nv;
+    }
+};
+
+inline mg_rpoly mg_to_rpoly(const mg_mpoly &a)
+{
+    piranha_assert(a.m_nv > 1u);
+    const unsigned nv = a.m_nv - 1u;
+    mg_rpoly retval{nv, {}, {}};
+    for (decltype(a.size()) i = 0u; i < a.size(); ++i) {
+        const auto e = a.expos(i);
+        if (retval.m_cfs.empty() || !std::equal(e, e + nv, retval.mono(retval.m_cfs.size() - 1u))) {
+            retval.m_monos.insert(retval.m_monos.end(), e, e + nv);
+            retval.m_cfs.emplace_back();
+        }
+        auto &c = retval.m_cfs.back();
+        if (c.size() <= e[nv]) {
+            c.resize(e[nv] + 1u, 0u);
+        }
+        c[e[nv]] = a.m_cfs[i];
+    }
+    return retval;
+}
+
+inline mg_mpoly mg_from_rpoly(const mg_rpoly &a)
+{
+    mg_mpoly retval(a.m_nv + 1u);
+    std::vector<unsigned> tmp(a.m_nv + 1u);
+    for (decltype(a.m_cfs.size()) i = 0u; i < a.m_cfs.size(); ++i) {
+        std::copy(a.mono(i), a.mono(i) + a.m_nv, tmp.begin());
+        const auto &c = a.m_cfs[i];
+        for (auto k = c.size(); k > 0u; --k) {
+            if (c[k - 1u] != 0u) {
+                tmp.back() = static_cast<unsigned>(k - 1u);
+                retval.push_back(tmp.data(), c[k - 1u]);
+            }
+        }
+    }
+    return retval;
+}
+
+// Evaluate the last variable of a at x. Terms sharing the first nv - 1 exponents are contiguous, thanks to
+// the lexicographic ordering.
+inline mg_mpoly mg_eval_last(const mg_field &f, const mg_mpoly &a, mg_uint x)
+{
+    piranha_assert(a.m_nv > 1u);
+    const unsigned nv = a.m_nv - 1u;
+    mg_mpoly retval(nv);
+    for (decltype(a.size()) i = 0u; i < a.size(); ++i) {
+        const auto e = a.expos(i);
+        const mg_uint v = f.mul(a.m_cfs[i], f.pow(x, e[nv]));
+        if (!retval.empty() && std::equal(e, e + nv, retval.expos(retval.size() - 1u))) {
+            retval.m_cfs.back() = f.add(retval.m_cfs.back(), v);
+        } else {
+            if (!retval.empty() && retval.m_cfs.back() == 0u) {
+                retval.m_cfs.back() = v;
+                std::copy(e, e + nv, retval.m_expos.end() - nv);
+            } else {
+                retval.push_back(e, v);
+            }
+        }
+    }
+    if (!retval.empty() && retval.m_cfs.back() == 0u) {
+        retval.m_cfs.pop_back();
+        retval.m_expos.resize(retval.m_expos.size() - nv);
+    }
+    return retval;
+}
+
+// Evaluate all the variables of a but the k-th one at the given values (the k-th value is ignored),
+// returning a univariate polynomial.
+inline mg_upoly mg_eval_slice(const mg_field &f, const mg_mpoly &a, unsigned k, const std::vector<mg_uint> &values)
+{
+    piranha_assert(values.size() == a.m_nv && k < a.m_nv);
+    mg_upoly retval;
+    for (decltype(a.size()) i = 0u; i < a.size(); ++i) {
+        const auto e = a.expos(i);
+        mg_uint v = a.m_cfs[i];
+        for (unsigned l = 0u; l < a.m_nv && v != 0u; ++l) {
+            if (l != k) {
+                v = f.mul(v, f.pow(values[l], e[l]));
+            }
+        }
+        if (retval.size() <= e[k]) {
+            retval.resize(e[k] + 1u, 0u);
+        }
+        retval[e[k]] = f.add(retval[e[k]], v);
+    }
+    mg_utrim(retval);
+    return retval;
+}
+
+// Solve the transposed Vandermonde system sum_i c_i * z_i**t = w_t, t = 0, ..., n - 1, with distinct nodes z_i.
+inline std::vector<mg_uint> mg_tvandermonde(const mg_field &f, const std::vector<mg_uint> &z,
+                                            const std::vector<mg_uint> &w)
+{
+    piranha_assert(z.size() == w.size());
+    const auto n = z.size();
+    // Master polynomial prod_i (x - z_i).
+    mg_upoly master{1u};
+    for (auto zi : z) {
+        mg_umul_linear(f, master, zi);
+    }
+    std::vector<mg_uint> retval(n), qi(n);
+    for (decltype(z.size()) i = 0u; i < n; ++i) {
+        // Synthetic division of the master polynomial by (x - z_i).
+        mg_uint carry = master[n];
+        for (auto k = n; k > 0u; --k) {
+            qi[k - 1u] = carry;
+            carry = f.add(master[k - 1u], f.mul(carry, z[i]));
+        }
+        mg_uint num(0u);
+        for (decltype(z.size()) t = 0u; t < n; ++t) {
+            num = f.add(num, f.mul(qi[t], w[t]));
+        }
+        retval[i] = f.mul(num, f.inv(mg_ueval(f, qi, z[i])));
+    }
+    return retval;
+}
+
+// Zippel's sparse modular GCD step: compute the image in Z_p of a GCD whose support is assumed to be the
+// support of the skeleton polynomial sk (in decreasing lexicographic order), normalised so that its leading
+// coefficient is lc. The coefficients are reconstructed from univariate images in the first variable, computed
+// at the powers of a random evaluation point for the other variables, by solving transposed Vandermonde systems.
+// One extra image is used to validate the result. The univariate images are computed in parallel using n_threads
+// threads. The return value is false if the skeleton cannot be used (e.g., because its leading coefficient with
+// respect to the first variable is not a monomial, because of an unlucky evaluation point or because
+// the skeleton turns out to be wrong), in which case the caller should fall back to the dense algorithm.
+inline bool mg_zippel(const mg_field &f, const mg_mpoly &a, const mg_mpoly &b, const mg_mpoly &sk, mg_uint lc,
+                      mg_mpoly &out, unsigned n_threads)
+{
+    piranha_assert(!a.empty() && !b.empty() && !sk.empty() && a.m_nv == b.m_nv && a.m_nv == sk.m_nv);
+    const unsigned nv = a.m_nv;
+    if (nv < 2u || (sk.size() > 1u && sk.expos(1u)[0u] == sk.expos(0u)[0u])) {
+        return false;
+    }
+    // Group the skeleton according to the degree in the first variable.
+    std::vector<std::pair<unsigned, std::vector<decltype(sk.size())>>> groups;
+    decltype(sk.size()) n_points = 0u;
+    for (decltype(sk.size()) i = 0u; i < sk.size(); ++i) {
+        if (groups.empty() || groups.back().first != sk.expos(i)[0u]) {
+            groups.emplace_back(sk.expos(i)[0u], std::vector<decltype(sk.size())>{});
+        }
+        groups.back().second.push_back(i);
+        n_points = std::max(n_points, groups.back().second.size());
+    }
+    // Random evaluation point, and values of the skeleton monomials at the evaluation point.
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(f.p() ^ (sk.size() + a.size() * b.size())));
+    std::uniform_int_distribution<mg_uint> dist(2u, f.p() - 1u);
+    std::vector<mg_uint> alpha(nv - 1u);
+    for (auto &x : alpha) {
+        x = dist(rng);
+    }
+    auto mono_eval = [&f, nv](const unsigned *e, const std::vector<mg_uint> &values) {
+        mg_uint retval(1u);
+        for (unsigned k = 1u; k < nv; ++k) {
+            retval = f.mul(retval, f.pow(values[k - 1u], e[k]));
+        }
+        return retval;
+    };
+    std::vector<mg_uint> nodes(sk.size());
+    for (decltype(sk.size()) i = 0u; i < sk.size(); ++i) {
+        nodes[i] = mono_eval(sk.expos(i), alpha);
+    }
+    // The nodes within each group must be distinct.
+    for (const auto &gr : groups) {
+        std::vector<mg_uint> tmp;
+        for (auto i : gr.second) {
+            tmp.push_back(nodes[i]);
+        }
+        std::sort(tmp.begin(), tmp.end());
+        if (std::adjacent_find(tmp.begin(), tmp.end()) != tmp.end()) {
+            return false;
+        }
+    }
+    // Values of the monomials of a and b at the evaluation point. The value of a monomial at alpha**t
+    // is then the t-th power of its value at alpha.
+    std::vector<mg_uint> a_nodes(a.size()), b_nodes(b.size());
+    for (decltype(a.size()) i = 0u; i < a.size(); ++i) {
+        a_nodes[i] = mono_eval(a.expos(i), alpha);
+    }
+    for (decltype(b.size()) i = 0u; i < b.size(); ++i) {
+        b_nodes[i] = mono_eval(b.expos(i), alpha);
+    }
+    auto eval = [&f](const mg_mpoly &p, const std::vector<mg_uint> &p_nodes, unsigned t) {
+        mg_upoly retval(p.expos(0u)[0u] + 1u, 0u);
+        for (decltype(p.size()) i = 0u; i < p.size(); ++i) {
+            const auto k = p.expos(i)[0u];
+            retval[k] = f.add(retval[k], f.mul(p.m_cfs[i], f.pow(p_nodes[i], t)));
+        }
+        mg_utrim(retval);
+        return retval;
+    };
+    // Univariate images at alpha**t, t = 0, ..., n_points. An empty vector signals an unusable image.
+    const auto deg_a = a.expos(0u)[0u], deg_b = b.expos(0u)[0u], deg_g = sk.expos(0u)[0u];
+    std::vector<unsigned> ts(n_points + 1u);
+    std::iota(ts.begin(), ts.end(), 0u);
+    std::vector<mg_upoly> images(ts.size());
+    n_threads = std::min(n_threads, static_cast<unsigned>(ts.size()));
+    parallel_vector_transform(n_threads, ts, images, [&](unsigned t) -> mg_upoly {
+        auto ua = eval(a, a_nodes, t), ub = eval(b, b_nodes, t);
+        if (ua.size() != deg_a + 1u || ub.size() != deg_b + 1u) {
+            return mg_upoly{};
+        }
+        auto g = mg_ugcd(f, std::move(ua), std::move(ub));
+        if (g.size() != deg_g + 1u) {
+            return mg_upoly{};
+        }
+        // Scale so that the leading coefficient matches the skeleton's.
+        mg_uscale(f, g, f.mul(lc, f.pow(nodes[0u], t)));
+        return g;
+    });
+    if (std::any_of(images.begin(), images.end(), [](const mg_upoly &u) { return u.empty(); })) {
+        return false;
+    }
+    // Solve for the coefficients of each group.
+    std::vector<mg_uint> cfs(sk.size());
+    for (const auto &gr : groups) {
+        const auto n = gr.second.size();
+        std::vector<mg_uint> z, w;
+        for (decltype(gr.second.size()) i = 0u; i < n; ++i) {
+            z.push_back(nodes[gr.second[i]]);
+            w.push_back(images[i][gr.first]);
+        }
+        const auto sol = mg_tvandermonde(f, z, w);
+        // Validation against the extra image.
+        mg_uint check(0u);
+        for (decltype(gr.second.size()) i = 0u; i < n; ++i) {
+            cfs[gr.second[i]] = sol[i];
+            check = f.add(check, f.mul(sol[i], f.pow(z[i], n_points)));
+        }
+        if (check != images.back()[gr.first]) {
+            return false;
+        }
+    }
+    // The images must not contain degrees absent from the skeleton.
+    std::vector<char> sk_degs(deg_g + 1u, 0);
+    for (const auto &gr : groups) {
+        sk_degs[gr.first] = 1;
+    }
+    for (const auto &img : images) {
+        for (mg_upoly::size_type k = 0u; k < img.size(); ++k) {
+            if (img[k] != 0u && !sk_degs[k]) {
+                return false;
+            }
+        }
+    }
+    out = mg_mpoly(nv);
+    for (decltype(sk.size()) i = 0u; i < sk.size(); ++i) {
+        if (cfs[i] != 0u) {
+            out.push_back(sk.expos(i), cfs[i]);
+        }
+    }
+    return !out.empty() && out.m_cfs[0u] == lc;
+}
+// Brown's dense modular GCD in Z_p[x_1,...,x_n] (Geddes et al., algorithm 7.2). The input polynomials must be
+// nonzero and have the same number of variables. The result is monic. Each variable is eliminated by evaluation,
+// starting from the last one, and the GCD is reconstructed via Newton interpolation from images computed
+// at distinct evaluation points. Images whose leading monomial is larger than the smallest one seen so far are
+// unlucky, and they are discarded. The interpolation stops when enough images have been collected
+// and the candidate GCD passes a divisibility check.
+inline mg_mpoly mg_brown(const mg_field &f, const mg_mpoly &a, const mg_mpoly &b, bool sparse = false,
+                         unsigned n_threads = 1u)
+{
+    piranha_assert(!a.empty() && !b.empty() && a.m_nv == b.m_nv && a.m_nv > 0u);
+    if (a.m_nv == 1u) {
+        // Univariate case.
+        mg_upoly ua, ub;
+        for (const auto *p : {&a, &b}) {
+            auto &u = (p == &a) ? ua : ub;
+            u.resize(p->expos(0u)[0u] + 1u, 0u);
+            for (decltype(p->size()) i = 0u; i < p->size(); ++i) {
+                u[p->expos(i)[0u]] = p->m_cfs[i];
+            }
+        }
+        const auto g = mg_ugcd(f, std::move(ua), std::move(ub));
+        mg_mpoly retval(1u);
+        for (auto k = g.size(); k > 0u; --k) {
+            if (g[k - 1u] != 0u) {
+                const auto e = static_cast<unsigned>(k - 1u);
+                retval.push_back(&e, g[k - 1u]);
+            }
+        }
+        return retval;
+    }
+    // Contents and primitive parts with respect to the first n - 1 variables.
+    auto ra = mg_to_rpoly(a), rb = mg_to_rpoly(b);
+    auto content = [&f](const mg_rpoly &r) {
+        mg_upoly retval;
+        for (const auto &c : r.m_cfs) {
+            retval = mg_ugcd(f, std::move(retval), c);
+            if (retval.size() == 1u) {
+                break;
+            }
+        }
+        return retval;
+    };
+    const auto ca = content(ra), cb = content(rb);
+    const auto c = mg_ugcd(f, ca, cb);
+    unsigned deg_a = 0u, deg_b = 0u;
+    for (auto *p : {&ra, &rb}) {
+        const auto &cont = (p == &ra) ? ca : cb;
+        auto &deg = (p == &ra) ? deg_a : deg_b;
+        for (auto &x : p->m_cfs) {
+            mg_udivrem(f, x, cont).swap(x);
+            deg = std::max(deg, static_cast<unsigned>(x.size() - 1u));
+        }
+    }
+    // GCD of the leading coefficients.
+    const mg_upoly g = mg_ugcd(f, ra.m_cfs[0u], rb.m_cfs[0u]);
+    const auto pa = mg_from_rpoly(ra), pb = mg_from_rpoly(rb);
+    // Number of images needed for the interpolation.
+    const auto n_images = static_cast<mg_upoly::size_type>(std::min(deg_a, deg_b) + g.size());
+    const unsigned nv = ra.m_nv;
+    mg_rpoly h{nv, {}, {}};
+    std::vector<unsigned> h_lm;
+    mg_upoly q{1u};
+    // Skeleton for the sparse interpolation of the images.
+    mg_mpoly sk(nv);
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(f.p() ^ pa.size()));
+    std::uniform_int_distribution<mg_uint> dist(0u, f.p() - 1u);
+    for (mg_uint x = 0u;; ++x) {
+        if (unlikely(x == f.p())) {
+            piranha_throw(mg_failure, "the evaluation points in the finite field have been exhausted");
+        }
+        const mg_uint gx = mg_ueval(f, g, x);
+        if (gx == 0u || mg_ueval(f, ra.m_cfs[0u], x) == 0u || mg_ueval(f, rb.m_cfs[0u], x) == 0u) {
+            continue;
+        }
+        const auto ea = mg_eval_last(f, pa, x), eb = mg_eval_last(f, pb, x);
+        mg_mpoly img(nv);
+        if (!sparse || h_lm.empty() || !mg_zippel(f, ea, eb, sk, 1u, img, n_threads)) {
+            img = mg_brown(f, ea, eb, sparse, n_threads);
+        }
+        const auto lm = img.expos(0u);
+        const bool restart = h_lm.empty() || std::lexicographical_compare(lm, lm + nv, h_lm.begin(), h_lm.end());
+        if (restart && sparse) {
+            sk = img;
+        }
+        for (auto &v : img.m_cfs) {
+            v = f.mul(v, gx);
+        }
+        if (restart) {
+            // First image or smaller leading monomial: (re)start the interpolation.
+            h_lm.assign(lm, lm + nv);
+            h.m_monos = std::move(img.m_expos);
+            h.m_cfs.clear();
+            for (auto v : img.m_cfs) {
+                h.m_cfs.push_back(mg_upoly{v});
+            }
+            q = mg_upoly{1u};
+        } else if (std::equal(lm, lm + nv, h_lm.begin())) {
+            // Newton interpolation: h += (img - h(x)) * q / q(x).
+            const mg_uint iqx = f.inv(mg_ueval(f, q, x));
+            mg_rpoly new_h{nv, {}, {}};
+            decltype(h.m_cfs.size()) i = 0u;
+            decltype(img.size()) j = 0u;
+            while (i < h.m_cfs.size() || j < img.size()) {
+                int cmp;
+                if (i == h.m_cfs.size()) {
+                    cmp = 1;
+                } else if (j == img.size()) {
+                    cmp = -1;
+                } else if (std::equal(h.mono(i), h.mono(i) + nv, img.expos(j))) {
+                    cmp = 0;
+                } else {
+                    cmp = std::lexicographical_compare(h.mono(i), h.mono(i) + nv, img.expos(j), img.expos(j) + nv)
+                              ? 1
+                              : -1;
+                }
+                mg_upoly cf = (cmp <= 0) ? std::move(h.m_cfs[i]) : mg_upoly{};
+                const mg_uint hx = mg_ueval(f, cf, x), ix = (cmp >= 0) ? img.m_cfs[j] : mg_uint(0u);
+                mg_uaddmul(f, cf, q, f.mul(f.sub(ix, hx), iqx));
+                const unsigned *m = (cmp <= 0) ? h.mono(i) : img.expos(j);
+                if (!cf.empty()) {
+                    new_h.m_monos.insert(new_h.m_monos.end(), m, m + nv);
+                    new_h.m_cfs.push_back(std::move(cf));
+                }
+                if (cmp <= 0) {
+                    ++i;
+                }
+                if (cmp >= 0) {
+                    ++j;
+                }
+            }
+            h = std::move(new_h);
+        } else {
+            // Unlucky evaluation point.
+            continue;
+        }
+        mg_umul_linear(f, q, x);
+        if (q.size() <= n_images) {
+            continue;
+        }
+        // Remove the content and check that the candidate divides the primitive parts of the inputs.
+        // The check is probabilistic, as the divisibility is tested on the univariate slices through
+        // a random point, but the final result of the modular algorithms is in any case validated
+        // via trial division in Z.
+        auto hp = h;
+        const auto hc = content(hp);
+        for (auto &y : hp.m_cfs) {
+            mg_udivrem(f, y, hc).swap(y);
+        }
+        auto retval = mg_from_rpoly(hp);
+        std::vector<mg_uint> pt(nv + 1u);
+        for (auto &v : pt) {
+            v = dist(rng);
+        }
+        bool conclusive = true, divides = true;
+        for (unsigned k = 0u; k <= nv && divides; ++k) {
+            const auto uh = mg_eval_slice(f, retval, k, pt);
+            if (uh.empty()) {
+                conclusive = false;
+                break;
+            }
+            auto ua = mg_eval_slice(f, pa, k, pt), ub = mg_eval_slice(f, pb, k, pt);
+            mg_udivrem(f, ua, uh);
+            mg_udivrem(f, ub, uh);
+            divides = ua.empty() && ub.empty();
+        }
+        if (!conclusive) {
+            continue;
+        }
+        if (!divides) {
+            if (sparse) {
+                // The skeleton might be wrong: restart with dense images.
+                sparse = false;
+                h_lm.clear();
+                q = mg_upoly{1u};
+            }
+            continue;
+        }
+        // Multiply by the GCD of the contents and normalise.
+        for (auto &y : hp.m_cfs) {
+            y = mg_umul(f, y, c);
+        }
+        retval = mg_from_rpoly(hp);
+        mg_mmonic(f, retval);
+        return retval;
+    }
+}
+
+}
+}
+
+#endif
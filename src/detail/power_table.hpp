@@ -0,0 +1,258 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PIRANHA_DETAIL_POWER_TABLE_HPP
+#define PIRANHA_DETAIL_POWER_TABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../config.hpp"
+#include "../exceptions.hpp"
+#include "../math.hpp"
+#include "../mp_integer.hpp"
+#include "../pow.hpp"
+#include "../symbol_set.hpp"
+#include "sfinae_types.hpp"
+
+namespace piranha
+{
+namespace detail
+{
+
+// Tables of the integral powers of the evaluation values of a set of symbols, used in series evaluation.
+// The powers of the i-th symbol are tabulated for all the exponents in the closed range bounds[i], so that
+// the evaluation of a key does not need to compute any power. The entries of the tables are computed with
+// math::pow(), hence the evaluation via the tables gives exactly the same results as the evaluation via
+// positions maps.
+template <typename U, typename T>
+class power_table
+{
+    static_assert(std::is_integral<T>::value, "The exponent type must be integral.");
+
+public:
+    using pow_type = decltype(math::pow(std::declval<const U &>(), std::declval<const T &>()));
+    using bounds_type = std::vector<std::pair<T, T>>;
+    // Update the bounds b1 with the bounds b2.
+    static void merge_bounds(bounds_type &b1, const bounds_type &b2)
+    {
+        if (b1.empty()) {
+            b1 = b2;
+            return;
+        }
+        if (b2.empty()) {
+            return;
+        }
+        piranha_assert(b1.size() == b2.size());
+        for (decltype(b1.size()) i = 0u; i < b1.size(); ++i) {
+            b1[i].first = std::min(b1[i].first, b2[i].first);
+            b1[i].second = std::max(b1[i].second, b2[i].second);
+        }
+    }
+    // Update the bounds b with the exponents in the range [begin, end).
+    template <typename It>
+    static void update_bounds(bounds_type &b, It begin, It end)
+    {
+        if (b.empty()) {
+            for (; begin != end; ++begin) {
+                b.emplace_back(*begin, *begin);
+            }
+            return;
+        }
+        for (auto it = b.begin(); begin != end; ++begin, ++it) {
+            piranha_assert(it != b.end());
+            if (*begin < it->first) {
+                it->first = *begin;
+            } else if (*begin > it->second) {
+                it->second = *begin;
+            }
+        }
+    }
+    // Total number of entries in the tables built from the bounds b.
+    static integer table_size(const bounds_type &b)
+    {
+        integer retval(0);
+        for (const auto &p : b) {
+            retval += integer(p.second) - integer(p.first) + 1;
+        }
+        return retval;
+    }
+    // Build the tables for the values in pmap, which must contain all the positions in [0, b.size()).
+    explicit power_table(const symbol_set::positions_map<U> &pmap, const bounds_type &b)
+    {
+        if (unlikely(pmap.size() != b.size() || (pmap.size() && pmap.back().first != pmap.size() - 1u))) {
+            piranha_throw(std::invalid_argument, "invalid positions map for the construction of a power table");
+        }
+        auto it = pmap.begin();
+        for (const auto &p : b) {
+            piranha_assert(p.first <= p.second);
+            m_mins.push_back(p.first);
+            m_tables.emplace_back();
+            auto &t = m_tables.back();
+            for (T n = p.first;; ++n) {
+                t.push_back(math::pow(it->second, n));
+                if (n == p.second) {
+                    break;
+                }
+            }
+            ++it;
+        }
+    }
+    // Number of tabulated symbols.
+    std::size_t size() const
+    {
+        return m_tables.size();
+    }
+    // Power of the i-th symbol to the exponent n.
+    const pow_type &operator()(std::size_t i, const T &n) const
+    {
+        piranha_assert(i < m_tables.size() && n >= m_mins[i]);
+        piranha_assert(static_cast<std::size_t>(n - m_mins[i]) < m_tables[i].size());
+        return m_tables[i][static_cast<std::size_t>(n - m_mins[i])];
+    }
+
+private:
+    std::vector<T> m_mins;
+    std::vector<std::vector<pow_type>> m_tables;
+};
+
+// Tables of the cosines and sines of the integral multiples of the evaluation values of a set of symbols, used in the
+// evaluation of trigonometric keys. The multiples of the i-th symbol are tabulated for all the multipliers in the
+// closed range bounds[i], so that the evaluation of a key requires only multiplications and additions via the angle
+// addition formulae. The bounds are managed via the static methods of power_table.
+template <typename U, typename T>
+class trig_table
+{
+    static_assert(std::is_integral<T>::value, "The multiplier type must be integral.");
+    using arg_type = decltype(std::declval<const U &>() * std::declval<const T &>());
+
+public:
+    using value_type = decltype(math::cos(std::declval<const arg_type &>()));
+    using bounds_type = std::vector<std::pair<T, T>>;
+    // Build the tables for the values in pmap, which must contain all the positions in [0, b.size()).
+    explicit trig_table(const symbol_set::positions_map<U> &pmap, const bounds_type &b)
+    {
+        if (unlikely(pmap.size() != b.size() || (pmap.size() && pmap.back().first != pmap.size() - 1u))) {
+            piranha_throw(std::invalid_argument, "invalid positions map for the construction of a trigonometric table");
+        }
+        auto it = pmap.begin();
+        for (const auto &p : b) {
+            piranha_assert(p.first <= p.second);
+            m_mins.push_back(p.first);
+            m_tables.emplace_back();
+            auto &t = m_tables.back();
+            for (T n = p.first;; ++n) {
+                const arg_type arg(it->second * n);
+                t.emplace_back(math::cos(arg), math::sin(arg));
+                if (n == p.second) {
+                    break;
+                }
+            }
+            ++it;
+        }
+    }
+    // Number of tabulated symbols.
+    std::size_t size() const
+    {
+        return m_tables.size();
+    }
+    // Cosine and sine of the value of the i-th symbol multiplied by n.
+    const std::pair<value_type, value_type> &operator()(std::size_t i, const T &n) const
+    {
+        piranha_assert(i < m_tables.size() && n >= m_mins[i]);
+        piranha_assert(static_cast<std::size_t>(n - m_mins[i]) < m_tables[i].size());
+        return m_tables[i][static_cast<std::size_t>(n - m_mins[i])];
+    }
+
+private:
+    std::vector<T> m_mins;
+    std::vector<std::vector<std::pair<value_type, value_type>>> m_tables;
+};
+
+// Detect if the key type Key supports evaluation via power tables with evaluation values of type U.
+template <typename Key, typename U, typename = void>
+struct key_has_power_table_evaluate {
+    static const bool value = false;
+};
+
+template <typename Key, typename U>
+struct key_has_power_table_evaluate<Key, U,
+                                    typename std::enable_if<std::is_integral<typename Key::value_type>::value>::type> {
+    using table_type = power_table<U, typename Key::value_type>;
+    template <typename K>
+    static auto test(const K &k)
+        -> decltype(k.update_exponent_bounds(std::declval<typename table_type::bounds_type &>(),
+                                             std::declval<const symbol_set &>()),
+                    k.evaluate(std::declval<const table_type &>(), std::declval<const symbol_set &>()), void(),
+                    sfinae_types::yes());
+    static sfinae_types::no test(...);
+    static const bool value = std::is_same<decltype(test(std::declval<const Key &>())), sfinae_types::yes>::value;
+};
+
+template <typename Key, typename U, typename Enable>
+const bool key_has_power_table_evaluate<Key, U, Enable>::value;
+
+template <typename Key, typename U>
+const bool key_has_power_table_evaluate<
+    Key, U, typename std::enable_if<std::is_integral<typename Key::value_type>::value>::type>::value;
+
+// Detect if the key type Key supports evaluation via trigonometric tables with evaluation values of type U.
+template <typename Key, typename U, typename = void>
+struct key_has_trig_table_evaluate {
+    static const bool value = false;
+};
+
+template <typename Key, typename U>
+struct key_has_trig_table_evaluate<Key, U,
+                                   typename std::enable_if<std::is_integral<typename Key::value_type>::value>::type> {
+    using table_type = trig_table<U, typename Key::value_type>;
+    // NOTE: the bounds type is spelled out in order not to instantiate table_type.
+    using bounds_type = std::vector<std::pair<typename Key::value_type, typename Key::value_type>>;
+    template <typename K>
+    static auto test(const K &k)
+        -> decltype(k.update_multiplier_bounds(std::declval<bounds_type &>(), std::declval<const symbol_set &>()),
+                    k.evaluate(std::declval<const table_type &>(), std::declval<const symbol_set &>()), void(),
+                    sfinae_types::yes());
+    static sfinae_types::no test(...);
+    static const bool value = std::is_same<decltype(test(std::declval<const Key &>())), sfinae_types::yes>::value;
+};
+
+template <typename Key, typename U, typename Enable>
+const bool key_has_trig_table_evaluate<Key, U, Enable>::value;
+
+template <typename Key, typename U>
+const bool key_has_trig_table_evaluate<
+    Key, U, typename std::enable_if<std::is_integral<typename Key::value_type>::value>::type>::value;
+}
+}
+
+#endif
@@ -0,0 +1,1254 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PIRANHA_DOUBLE_DOUBLE_HPP
+#define PIRANHA_DOUBLE_DOUBLE_HPP
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "config.hpp"
+#include "exceptions.hpp"
+#include "is_cf.hpp"
+#include "math.hpp"
+#include "mp_integer.hpp"
+#include "mp_rational.hpp"
+#include "pow.hpp"
+#include "real.hpp"
+#include "safe_cast.hpp"
+#include "serialization.hpp"
+
+namespace piranha
+{
+
+namespace detail
+{
+
+// Types interoperable with double_double.
+template <typename T>
+struct is_double_double_interoperable_type {
+    static const bool value = detail::is_mp_integer_interoperable_type<T>::value || detail::is_mp_integer<T>::value
+                              || detail::is_mp_rational<T>::value;
+};
+
+// Error-free transformations. See:
+// http://web.mit.edu/tabbott/Public/quaddouble-debian/qd-2.3.4-old/docs/qd.pdf
+// NOTE: these rely on strict IEEE semantics, they will give wrong results if the compiler
+// is allowed to reassociate floating-point operations (e.g., -ffast-math).
+// Sum of a and b, assuming |a| >= |b|.
+inline double dd_quick_two_sum(double a, double b, double &err)
+{
+    const double s = a + b;
+    err = b - (s - a);
+    return s;
+}
+
+inline double dd_two_sum(double a, double b, double &err)
+{
+    const double s = a + b, bb = s - a;
+    err = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+inline double dd_two_prod(double a, double b, double &err)
+{
+    const double p = a * b;
+#if defined(FP_FAST_FMA)
+    err = std::fma(a, b, -p);
+#else
+    // Dekker's splitting. A software fma is typically much slower than this.
+    const double split = 134217729.0, ta = split * a, tb = split * b, a_hi = ta - (ta - a), a_lo = a - a_hi,
+                 b_hi = tb - (tb - b), b_lo = b - b_hi;
+    err = ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+#endif
+    return p;
+}
+}
+
+/// Double-double floating-point class.
+/**
+ * This class represents a floating-point number as the unevaluated sum of two \p double values, the \e high and
+ * the \e low components, with the low component not larger in magnitude than half an ulp of the high component.
+ * The result is a floating-point type with a significand of (at least) 106 bits and the exponent range of \p double.
+ *
+ * All the basic arithmetic operations are implemented inline via error-free transformations of \p double operations
+ * (no memory allocation is ever performed), which makes this class considerably faster than piranha::real with
+ * comparable precision. It is thus intended as a drop-in replacement for piranha::real as a series coefficient type
+ * when about 32 decimal digits of precision are sufficient. Addition, subtraction, multiplication and division are
+ * accurate to a few units of \f$ 2^{-106} \f$ relative to the result. Transcendental functions are computed via
+ * piranha::real and rounded back.
+ *
+ * The algorithms used in this class require strict IEEE 754 semantics for \p double: they will give wrong results
+ * if the compiler is allowed to reassociate floating-point operations (e.g., via the <tt>-ffast-math</tt> flag
+ * in GCC and Clang). Non-finite values and division by zero follow the semantics of \p double.
+ *
+ * ## Interoperability with other types ##
+ *
+ * This class interoperates with the same types as piranha::real. Values of other types are converted to
+ * piranha::double_double before the operation takes place, so that the result of mixed operations is always
+ * of type piranha::double_double. Conversion from and to piranha::real is explicit.
+ *
+ * ## Exception safety guarantee ##
+ *
+ * Unless noted otherwise, this class provides the strong exception safety guarantee for all operations.
+ *
+ * ## Move semantics ##
+ *
+ * Move semantics is equivalent to copy semantics.
+ *
+ * ## Serialization ##
+ *
+ * This class supports serialization. The two components are serialized separately, so that the
+ * serialization round-trip is exact.
+ *
+ * @see http://web.mit.edu/tabbott/Public/quaddouble-debian/qd-2.3.4-old/docs/qd.pdf
+ */
+class double_double
+{
+    // Shortcut for interop type detector.
+    template <typename T>
+    using is_interoperable_type = detail::is_double_double_interoperable_type<T>;
+    // Enabler for generic ctor.
+    template <typename T>
+    using generic_ctor_enabler = typename std::enable_if<is_interoperable_type<T>::value, int>::type;
+    // Enabler for conversion operator.
+    template <typename T>
+    using cast_enabler = typename std::enable_if<is_interoperable_type<T>::value || std::is_same<T, real>::value,
+                                                 int>::type;
+    // Construction.
+    template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    void construct_from_generic(const T &x)
+    {
+        m_hi = static_cast<double>(x);
+        // NOTE: this is exact for all the floating-point types with a significand
+        // no wider than twice the significand of double (which covers long double on all
+        // common platforms).
+        m_lo = std::isfinite(m_hi) ? static_cast<double>(x - static_cast<T>(m_hi)) : 0.;
+    }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value
+                                                      && (std::numeric_limits<T>::digits <= 53),
+                                                  int>::type
+                          = 0>
+    void construct_from_generic(const T &n)
+    {
+        m_hi = static_cast<double>(n);
+        m_lo = 0.;
+    }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value
+                                                      && (std::numeric_limits<T>::digits > 53),
+                                                  int>::type
+                          = 0>
+    void construct_from_generic(const T &n)
+    {
+        // Split the value in two halves which can be represented exactly by double, then
+        // sum them up exactly.
+        const T q = static_cast<T>(n / (T(1) << 32u)), r = static_cast<T>(n % (T(1) << 32u));
+        m_hi = detail::dd_two_sum(static_cast<double>(q) * 4294967296., static_cast<double>(r), m_lo);
+    }
+    template <typename T, typename std::enable_if<detail::is_mp_integer<T>::value || detail::is_mp_rational<T>::value,
+                                                  int>::type
+                          = 0>
+    void construct_from_generic(const T &x)
+    {
+        construct_from_real(real{x});
+    }
+    void construct_from_real(const real &r)
+    {
+        m_hi = static_cast<double>(r);
+        // NOTE: if r is finite, the difference between r and its rounded value is computed
+        // exactly in the precision of r.
+        m_lo = std::isfinite(m_hi) ? static_cast<double>(r - m_hi) : 0.;
+    }
+    // Conversion.
+    template <typename T>
+    typename std::enable_if<std::is_same<T, bool>::value, T>::type convert_to_impl() const
+    {
+        return m_hi != 0.;
+    }
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, T>::type convert_to_impl() const
+    {
+        return static_cast<T>(m_hi) + static_cast<T>(m_lo);
+    }
+    template <typename T>
+    typename std::enable_if<detail::is_mp_integer<T>::value, T>::type convert_to_impl() const
+    {
+        if (unlikely(!std::isfinite(m_hi))) {
+            piranha_throw(std::overflow_error, "cannot convert non-finite double_double to an integral value");
+        }
+        const double t_hi = std::trunc(m_hi);
+        // If the high component is not integral, the low component cannot move the value past
+        // the next integer.
+        if (t_hi != m_hi) {
+            return T(t_hi);
+        }
+        // The high component is integral: truncation towards zero must take into account the sign
+        // of the low component.
+        double t_lo;
+        if (m_hi > 0. && m_lo < 0.) {
+            t_lo = std::floor(m_lo);
+        } else if (m_hi < 0. && m_lo > 0.) {
+            t_lo = std::ceil(m_lo);
+        } else {
+            t_lo = std::trunc(m_lo);
+        }
+        T retval(t_hi);
+        retval += T(t_lo);
+        return retval;
+    }
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, T>::type
+    convert_to_impl() const
+    {
+        return static_cast<T>(convert_to_impl<integer>());
+    }
+    template <typename T>
+    typename std::enable_if<detail::is_mp_rational<T>::value, T>::type convert_to_impl() const
+    {
+        // NOTE: the conversion from double to rational is exact, and it throws on
+        // non-finite values.
+        T retval(m_hi);
+        retval += T(m_lo);
+        return retval;
+    }
+    template <typename T>
+    typename std::enable_if<std::is_same<T, real>::value, T>::type convert_to_impl() const
+    {
+        real retval{m_hi};
+        retval += m_lo;
+        return retval;
+    }
+    // The error-free transformations produce NaNs in the low component when
+    // dealing with non-finite values, follow the semantics of double instead.
+    double_double &set_non_finite(double x)
+    {
+        m_hi = x;
+        m_lo = 0.;
+        return *this;
+    }
+    // In-place arithmetics.
+    double_double &in_place_add(const double_double &other)
+    {
+        // IEEE-style addition (the "accurate" variant).
+        double s2, t2;
+        double s1 = detail::dd_two_sum(m_hi, other.m_hi, s2);
+        if (unlikely(!std::isfinite(s1))) {
+            return set_non_finite(s1);
+        }
+        const double t1 = detail::dd_two_sum(m_lo, other.m_lo, t2);
+        s2 += t1;
+        s1 = detail::dd_quick_two_sum(s1, s2, s2);
+        s2 += t2;
+        m_hi = detail::dd_quick_two_sum(s1, s2, m_lo);
+        return *this;
+    }
+    double_double &in_place_sub(const double_double &other)
+    {
+        return in_place_add(-other);
+    }
+    double_double &in_place_mul(const double_double &other)
+    {
+        double p2;
+        const double p1 = detail::dd_two_prod(m_hi, other.m_hi, p2);
+        if (unlikely(!std::isfinite(p1))) {
+            return set_non_finite(p1);
+        }
+        p2 += m_hi * other.m_lo + m_lo * other.m_hi;
+        m_hi = detail::dd_quick_two_sum(p1, p2, m_lo);
+        return *this;
+    }
+    double_double &in_place_div(const double_double &other)
+    {
+        // Long division: three correction steps.
+        const double q1 = m_hi / other.m_hi;
+        if (unlikely(!std::isfinite(q1) || !std::isfinite(other.m_hi))) {
+            return set_non_finite(q1);
+        }
+        double_double r(*this);
+        r -= other * double_double(q1);
+        const double q2 = r.m_hi / other.m_hi;
+        r -= other * double_double(q2);
+        const double q3 = r.m_hi / other.m_hi;
+        double lo;
+        const double hi = detail::dd_quick_two_sum(q1, q2, lo);
+        m_hi = hi;
+        m_lo = lo;
+        return in_place_add(double_double(q3));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    double_double &in_place_add(const T &x)
+    {
+        return in_place_add(double_double(x));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    double_double &in_place_sub(const T &x)
+    {
+        return in_place_sub(double_double(x));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    double_double &in_place_mul(const T &x)
+    {
+        return in_place_mul(double_double(x));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    double_double &in_place_div(const T &x)
+    {
+        return in_place_div(double_double(x));
+    }
+    // Binary operations.
+    static double_double binary_add(const double_double &a, const double_double &b)
+    {
+        double_double retval(a);
+        retval += b;
+        return retval;
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static double_double binary_add(const double_double &a, const T &b)
+    {
+        return binary_add(a, double_double(b));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static double_double binary_add(const T &a, const double_double &b)
+    {
+        return binary_add(double_double(a), b);
+    }
+    static double_double binary_sub(const double_double &a, const double_double &b)
+    {
+        double_double retval(a);
+        retval -= b;
+        return retval;
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static double_double binary_sub(const double_double &a, const T &b)
+    {
+        return binary_sub(a, double_double(b));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static double_double binary_sub(const T &a, const double_double &b)
+    {
+        return binary_sub(double_double(a), b);
+    }
+    static double_double binary_mul(const double_double &a, const double_double &b)
+    {
+        double_double retval(a);
+        retval *= b;
+        return retval;
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static double_double binary_mul(const double_double &a, const T &b)
+    {
+        return binary_mul(a, double_double(b));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static double_double binary_mul(const T &a, const double_double &b)
+    {
+        return binary_mul(double_double(a), b);
+    }
+    static double_double binary_div(const double_double &a, const double_double &b)
+    {
+        double_double retval(a);
+        retval /= b;
+        return retval;
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static double_double binary_div(const double_double &a, const T &b)
+    {
+        return binary_div(a, double_double(b));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static double_double binary_div(const T &a, const double_double &b)
+    {
+        return binary_div(double_double(a), b);
+    }
+    // Comparisons.
+    static bool binary_equal(const double_double &a, const double_double &b)
+    {
+        return a.m_hi == b.m_hi && a.m_lo == b.m_lo;
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static bool binary_equal(const double_double &a, const T &b)
+    {
+        return binary_equal(a, double_double(b));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static bool binary_equal(const T &a, const double_double &b)
+    {
+        return binary_equal(double_double(a), b);
+    }
+    static bool binary_less_than(const double_double &a, const double_double &b)
+    {
+        return a.m_hi < b.m_hi || (a.m_hi == b.m_hi && a.m_lo < b.m_lo);
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static bool binary_less_than(const double_double &a, const T &b)
+    {
+        return binary_less_than(a, double_double(b));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static bool binary_less_than(const T &a, const double_double &b)
+    {
+        return binary_less_than(double_double(a), b);
+    }
+    static bool binary_leq(const double_double &a, const double_double &b)
+    {
+        return a.m_hi < b.m_hi || (a.m_hi == b.m_hi && a.m_lo <= b.m_lo);
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static bool binary_leq(const double_double &a, const T &b)
+    {
+        return binary_leq(a, double_double(b));
+    }
+    template <typename T, generic_ctor_enabler<T> = 0>
+    static bool binary_leq(const T &a, const double_double &b)
+    {
+        return binary_leq(double_double(a), b);
+    }
+    // Serialization support.
+    friend class boost::serialization::access;
+    template <class Archive>
+    void serialize(Archive &ar, unsigned int)
+    {
+        ar &m_hi;
+        ar &m_lo;
+    }
+
+public:
+    /// Default constructor.
+    /**
+     * Will initialize the number to zero.
+     */
+    double_double() : m_hi(0.), m_lo(0.)
+    {
+    }
+    /// Defaulted copy constructor.
+    double_double(const double_double &) = default;
+    /// Defaulted move constructor.
+    double_double(double_double &&) = default;
+    /// Constructor from components.
+    /**
+     * The value of \p this will be the sum of \p hi and \p lo, computed exactly and normalised
+     * so that the low component is not larger than half an ulp of the high component.
+     *
+     * @param[in] hi high component.
+     * @param[in] lo low component.
+     */
+    explicit double_double(double hi, double lo)
+    {
+        m_hi = detail::dd_two_sum(hi, lo, m_lo);
+    }
+    /// Generic constructor.
+    /**
+     * \note
+     * This constructor is enabled only if \p T is an interoperable type.
+     *
+     * Values of floating-point and integral types are represented exactly if their significand
+     * fits in the significand of piranha::double_double. piranha::mp_integer and piranha::mp_rational values are
+     * rounded to nearest via piranha::real.
+     *
+     * @param[in] x object used to construct \p this.
+     *
+     * @throws unspecified any exception thrown by the construction of piranha::real from \p x.
+     */
+    template <typename T, generic_ctor_enabler<T> = 0>
+    explicit double_double(const T &x)
+    {
+        construct_from_generic(x);
+    }
+    /// Constructor from piranha::real.
+    /**
+     * \p r will be rounded to nearest to the precision of piranha::double_double.
+     *
+     * @param[in] r piranha::real used to construct \p this.
+     */
+    explicit double_double(const real &r)
+    {
+        construct_from_real(r);
+    }
+    /// Constructor from C string.
+    /**
+     * The string is parsed via piranha::real (with the default precision of piranha::real) and the result is
+     * then rounded to the precision of piranha::double_double.
+     *
+     * @param[in] str C string used for construction.
+     *
+     * @throws unspecified any exception thrown by the constructor from string of piranha::real.
+     */
+    explicit double_double(const char *str)
+    {
+        construct_from_real(real{str});
+    }
+    /// Constructor from C++ string.
+    /**
+     * Equivalent to the constructor from C string.
+     *
+     * @param[in] str C++ string used for construction.
+     *
+     * @throws unspecified any exception thrown by the constructor from C string.
+     */
+    explicit double_double(const std::string &str) : double_double(str.c_str())
+    {
+    }
+    /// Destructor.
+    ~double_double();
+    /// Defaulted copy assignment operator.
+    double_double &operator=(const double_double &) = default;
+    /// Defaulted move assignment operator.
+    double_double &operator=(double_double &&) = default;
+    /// Generic assignment operator.
+    /**
+     * \note
+     * This assignment operator is enabled only if \p T is an interoperable type.
+     *
+     * @param[in] x assignment argument.
+     *
+     * @return reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, generic_ctor_enabler<T> = 0>
+    double_double &operator=(const T &x)
+    {
+        return (*this = double_double(x));
+    }
+    /// Assignment operator from C string.
+    /**
+     * @param[in] str C string.
+     *
+     * @return reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the constructor from C string.
+     */
+    double_double &operator=(const char *str)
+    {
+        return (*this = double_double(str));
+    }
+    /// Assignment operator from C++ string.
+    /**
+     * @param[in] str C++ string.
+     *
+     * @return reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the constructor from C string.
+     */
+    double_double &operator=(const std::string &str)
+    {
+        return (*this = str.c_str());
+    }
+    /// Conversion operator.
+    /**
+     * \note
+     * This operator is enabled only if \p T is an interoperable type or piranha::real.
+     *
+     * The conversion to integral types will truncate towards zero. The conversion to piranha::mp_rational
+     * is exact. The conversion to piranha::real will use the default precision of piranha::real.
+     *
+     * @return \p this converted to \p T.
+     *
+     * @throws std::overflow_error if \p this is not finite and \p T is integral.
+     * @throws unspecified any exception thrown by the conversion of piranha::mp_integer to \p T, or by the
+     * construction of piranha::mp_rational from \p double.
+     */
+    template <typename T, cast_enabler<T> = 0>
+    explicit operator T() const
+    {
+        return convert_to_impl<T>();
+    }
+    /// High component.
+    /**
+     * @return the high component of \p this.
+     */
+    double hi() const
+    {
+        return m_hi;
+    }
+    /// Low component.
+    /**
+     * @return the low component of \p this.
+     */
+    double lo() const
+    {
+        return m_lo;
+    }
+    /// Sign.
+    /**
+     * @return 1 if <tt>this > 0</tt>, 0 if <tt>this == 0</tt> and -1 if <tt>this < 0</tt>. If \p this is NaN, zero
+     * will be returned.
+     */
+    int sign() const
+    {
+        return m_hi > 0. ? 1 : (m_hi < 0. ? -1 : 0);
+    }
+    /// Negate in-place.
+    void negate()
+    {
+        m_hi = -m_hi;
+        m_lo = -m_lo;
+    }
+    /// Test for zero.
+    /**
+     * @return \p true if \p this is zero, \p false otherwise.
+     */
+    bool is_zero() const
+    {
+        return m_hi == 0.;
+    }
+    /// Absolute value.
+    /**
+     * @return absolute value of \p this.
+     */
+    double_double abs() const
+    {
+        return m_hi < 0. ? -(*this) : *this;
+    }
+    /// Combined multiply-add.
+    /**
+     * Sets \p this to <tt>this + (y * z)</tt>. The product is accumulated without being
+     * normalised first.
+     *
+     * @param[in] y first argument.
+     * @param[in] z second argument.
+     *
+     * @return reference to \p this.
+     */
+    double_double &multiply_accumulate(const double_double &y, const double_double &z)
+    {
+        double p2;
+        const double p1 = detail::dd_two_prod(y.m_hi, z.m_hi, p2);
+        if (unlikely(!std::isfinite(p1))) {
+            return in_place_add(double_double(p1));
+        }
+        p2 += y.m_hi * z.m_lo + y.m_lo * z.m_hi;
+        double s2, t2;
+        double s1 = detail::dd_two_sum(m_hi, p1, s2);
+        if (unlikely(!std::isfinite(s1))) {
+            return set_non_finite(s1);
+        }
+        const double t1 = detail::dd_two_sum(m_lo, p2, t2);
+        s2 += t1;
+        s1 = detail::dd_quick_two_sum(s1, s2, s2);
+        s2 += t2;
+        m_hi = detail::dd_quick_two_sum(s1, s2, m_lo);
+        return *this;
+    }
+    /// In-place addition.
+    /**
+     * \note
+     * This operator is enabled only if \p T is an interoperable type or piranha::double_double.
+     *
+     * @param[in] x argument for the addition.
+     *
+     * @return reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T>
+    auto operator+=(const T &x) -> decltype(this->in_place_add(x))
+    {
+        return in_place_add(x);
+    }
+    /// Binary addition involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return <tt>x + y</tt>.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator+(const T &x, const U &y) -> decltype(double_double::binary_add(x, y))
+    {
+        return binary_add(x, y);
+    }
+    /// Identity operator.
+    /**
+     * @return copy of \p this.
+     */
+    double_double operator+() const
+    {
+        return *this;
+    }
+    /// In-place subtraction.
+    /**
+     * \note
+     * This operator is enabled only if \p T is an interoperable type or piranha::double_double.
+     *
+     * @param[in] x argument for the subtraction.
+     *
+     * @return reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T>
+    auto operator-=(const T &x) -> decltype(this->in_place_sub(x))
+    {
+        return in_place_sub(x);
+    }
+    /// Binary subtraction involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return <tt>x - y</tt>.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator-(const T &x, const U &y) -> decltype(double_double::binary_sub(x, y))
+    {
+        return binary_sub(x, y);
+    }
+    /// Negated copy.
+    /**
+     * @return copy of \p -this.
+     */
+    double_double operator-() const
+    {
+        double_double retval(*this);
+        retval.negate();
+        return retval;
+    }
+    /// In-place multiplication.
+    /**
+     * \note
+     * This operator is enabled only if \p T is an interoperable type or piranha::double_double.
+     *
+     * @param[in] x argument for the multiplication.
+     *
+     * @return reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T>
+    auto operator*=(const T &x) -> decltype(this->in_place_mul(x))
+    {
+        return in_place_mul(x);
+    }
+    /// Binary multiplication involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return <tt>x * y</tt>.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator*(const T &x, const U &y) -> decltype(double_double::binary_mul(x, y))
+    {
+        return binary_mul(x, y);
+    }
+    /// In-place division.
+    /**
+     * \note
+     * This operator is enabled only if \p T is an interoperable type or piranha::double_double.
+     *
+     * Division by zero follows the semantics of \p double.
+     *
+     * @param[in] x argument for the division.
+     *
+     * @return reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T>
+    auto operator/=(const T &x) -> decltype(this->in_place_div(x))
+    {
+        return in_place_div(x);
+    }
+    /// Binary division involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return <tt>x / y</tt>.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator/(const T &x, const U &y) -> decltype(double_double::binary_div(x, y))
+    {
+        return binary_div(x, y);
+    }
+    /// Generic equality operator involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * Two normalised piranha::double_double objects are equal if and only if their components are equal.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return \p true if <tt>x == y</tt>, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator==(const T &x, const U &y) -> decltype(double_double::binary_equal(x, y))
+    {
+        return binary_equal(x, y);
+    }
+    /// Generic inequality operator involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return \p true if <tt>x != y</tt>, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the equality operator.
+     */
+    template <typename T, typename U>
+    friend auto operator!=(const T &x, const U &y) -> decltype(!double_double::binary_equal(x, y))
+    {
+        return !binary_equal(x, y);
+    }
+    /// Generic less-than operator involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return \p true if <tt>x < y</tt>, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator<(const T &x, const U &y) -> decltype(double_double::binary_less_than(x, y))
+    {
+        return binary_less_than(x, y);
+    }
+    /// Generic less-than or equal operator involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return \p true if <tt>x <= y</tt>, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator<=(const T &x, const U &y) -> decltype(double_double::binary_leq(x, y))
+    {
+        return binary_leq(x, y);
+    }
+    /// Generic greater-than operator involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return \p true if <tt>x > y</tt>, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator>(const T &x, const U &y) -> decltype(double_double::binary_less_than(y, x))
+    {
+        return binary_less_than(y, x);
+    }
+    /// Generic greater-than or equal operator involving piranha::double_double.
+    /**
+     * \note
+     * This template operator is enabled only if either:
+     * - \p T is piranha::double_double and \p U is an interoperable type,
+     * - \p U is piranha::double_double and \p T is an interoperable type,
+     * - both \p T and \p U are piranha::double_double.
+     *
+     * @param[in] x first argument
+     * @param[in] y second argument.
+     *
+     * @return \p true if <tt>x >= y</tt>, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the generic constructor.
+     */
+    template <typename T, typename U>
+    friend auto operator>=(const T &x, const U &y) -> decltype(double_double::binary_leq(y, x))
+    {
+        return binary_leq(y, x);
+    }
+    /// Overload output stream operator for piranha::double_double.
+    /**
+     * The value is printed via the conversion to piranha::real.
+     *
+     * @param[in] os output stream.
+     * @param[in] x piranha::double_double to be directed to stream.
+     *
+     * @return reference to \p os.
+     *
+     * @throws unspecified any exception thrown by the stream operator of piranha::real.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const double_double &x)
+    {
+        return os << static_cast<real>(x);
+    }
+    /// Overload input stream operator for piranha::double_double.
+    /**
+     * Equivalent to extracting a line from the stream and then assigning it to \p x.
+     *
+     * @param[in] is input stream.
+     * @param[in,out] x piranha::double_double to which the contents of the stream will be assigned.
+     *
+     * @return reference to \p is.
+     *
+     * @throws unspecified any exception thrown by the assignment operator from string.
+     */
+    friend std::istream &operator>>(std::istream &is, double_double &x)
+    {
+        std::string tmp_str;
+        std::getline(is, tmp_str);
+        x = tmp_str;
+        return is;
+    }
+
+private:
+    double m_hi;
+    double m_lo;
+};
+
+namespace math
+{
+
+/// Specialisation of the piranha::math::negate() functor for piranha::double_double.
+template <typename T>
+struct negate_impl<T, typename std::enable_if<std::is_same<T, double_double>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in,out] x piranha::double_double to be negated.
+     */
+    void operator()(T &x) const
+    {
+        x.negate();
+    }
+};
+
+/// Specialisation of the piranha::math::is_zero() functor for piranha::double_double.
+template <typename T>
+struct is_zero_impl<T, typename std::enable_if<std::is_same<T, double_double>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in] x piranha::double_double to be tested.
+     *
+     * @return \p true if \p x is zero, \p false otherwise.
+     */
+    bool operator()(const T &x) const
+    {
+        return x.is_zero();
+    }
+};
+}
+
+namespace detail
+{
+
+// Enabler for the pow specialisation.
+template <typename T, typename U>
+using dd_pow_enabler =
+    typename std::enable_if<std::is_same<T, double_double>::value
+                            && (std::is_integral<U>::value || is_mp_integer<U>::value
+                                || std::is_floating_point<U>::value || std::is_same<U, double_double>::value)>::type;
+}
+
+namespace math
+{
+
+/// Specialisation of the piranha::math::pow() functor for piranha::double_double.
+/**
+ * \note
+ * This specialisation is activated when \p T is piranha::double_double and \p U is an integral, floating-point,
+ * piranha::mp_integer or piranha::double_double type.
+ */
+template <typename T, typename U>
+struct pow_impl<T, U, detail::dd_pow_enabler<T, U>> {
+private:
+    template <typename V>
+    static double_double upow(const double_double &b, V n)
+    {
+        double_double retval(1), tmp(b);
+        while (n) {
+            if (n % 2u) {
+                retval *= tmp;
+            }
+            n /= 2u;
+            if (n) {
+                tmp *= tmp;
+            }
+        }
+        return retval;
+    }
+    template <typename V, typename std::enable_if<std::is_integral<V>::value && std::is_signed<V>::value, int>::type
+                          = 0>
+    static double_double ipow(const double_double &b, const V &n)
+    {
+        using uv_t = typename std::make_unsigned<V>::type;
+        if (n >= V(0)) {
+            return upow(b, static_cast<uv_t>(n));
+        }
+        // NOTE: compute the magnitude of n avoiding overflow for the minimum value.
+        return double_double(1) / upow(b, static_cast<uv_t>(uv_t(0) - static_cast<uv_t>(n)));
+    }
+    template <typename V, typename std::enable_if<std::is_unsigned<V>::value, int>::type = 0>
+    static double_double ipow(const double_double &b, const V &n)
+    {
+        return upow(b, n);
+    }
+    template <typename V, typename std::enable_if<detail::is_mp_integer<V>::value, int>::type = 0>
+    static double_double ipow(const double_double &b, const V &n)
+    {
+        return ipow(b, static_cast<long long>(n));
+    }
+    template <typename V, typename std::enable_if<std::is_floating_point<V>::value
+                                                      || std::is_same<V, double_double>::value,
+                                                  int>::type
+                          = 0>
+    static double_double ipow(const double_double &b, const V &x)
+    {
+        return double_double(math::pow(static_cast<real>(b), static_cast<real>(x)));
+    }
+
+public:
+    /// Call operator.
+    /**
+     * Integral exponents are handled via exponentiation by squaring. Other exponents are handled
+     * by converting the arguments to piranha::real.
+     *
+     * @param[in] b base.
+     * @param[in] e exponent.
+     *
+     * @return \p b to the power of \p e.
+     *
+     * @throws std::overflow_error if \p e is a piranha::mp_integer not representable by <tt>long long</tt>.
+     * @throws unspecified any exception thrown by piranha::math::pow() for piranha::real.
+     */
+    double_double operator()(const T &b, const U &e) const
+    {
+        return ipow(b, e);
+    }
+};
+
+/// Specialisation of the piranha::math::sin() functor for piranha::double_double.
+template <typename T>
+struct sin_impl<T, typename std::enable_if<std::is_same<T, double_double>::value>::type> {
+    /// Call operator.
+    /**
+     * The sine is computed via piranha::real.
+     *
+     * @param[in] x argument.
+     *
+     * @return sine of \p x.
+     */
+    T operator()(const T &x) const
+    {
+        return T(math::sin(static_cast<real>(x)));
+    }
+};
+
+/// Specialisation of the piranha::math::cos() functor for piranha::double_double.
+template <typename T>
+struct cos_impl<T, typename std::enable_if<std::is_same<T, double_double>::value>::type> {
+    /// Call operator.
+    /**
+     * The cosine is computed via piranha::real.
+     *
+     * @param[in] x argument.
+     *
+     * @return cosine of \p x.
+     */
+    T operator()(const T &x) const
+    {
+        return T(math::cos(static_cast<real>(x)));
+    }
+};
+
+/// Specialisation of the piranha::math::abs() functor for piranha::double_double.
+template <typename T>
+struct abs_impl<T, typename std::enable_if<std::is_same<T, double_double>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in] x input parameter.
+     *
+     * @return absolute value of \p x.
+     */
+    T operator()(const T &x) const
+    {
+        return x.abs();
+    }
+};
+
+/// Specialisation of the piranha::math::partial() functor for piranha::double_double.
+template <typename T>
+struct partial_impl<T, typename std::enable_if<std::is_same<T, double_double>::value>::type> {
+    /// Call operator.
+    /**
+     * @return an instance of piranha::double_double constructed from zero.
+     */
+    T operator()(const T &, const std::string &) const
+    {
+        return T{};
+    }
+};
+
+/// Specialisation of the implementation of piranha::math::multiply_accumulate() for piranha::double_double.
+template <typename T>
+struct multiply_accumulate_impl<T, T, T, typename std::enable_if<std::is_same<T, double_double>::value>::type> {
+    /// Call operator.
+    /**
+     * This implementation will use piranha::double_double::multiply_accumulate().
+     *
+     * @param[in,out] x target value for accumulation.
+     * @param[in] y first argument.
+     * @param[in] z second argument.
+     */
+    void operator()(T &x, const T &y, const T &z) const
+    {
+        x.multiply_accumulate(y, z);
+    }
+};
+}
+
+inline double_double::~double_double()
+{
+    PIRANHA_TT_CHECK(is_cf, double_double);
+}
+
+namespace detail
+{
+
+template <typename To, typename From>
+using sc_dd_enabler =
+    typename std::enable_if<(std::is_integral<To>::value || is_mp_integer<To>::value || is_mp_rational<To>::value)
+                            && std::is_same<From, double_double>::value>::type;
+}
+
+/// Specialisation of piranha::safe_cast() for conversions involving piranha::double_double.
+/**
+ * This specialisation is enabled if \p To is an integral type, piranha::mp_integer or piranha::mp_rational, and \p
+ * From is piranha::double_double.
+ */
+template <typename To, typename From>
+struct safe_cast_impl<To, From, detail::sc_dd_enabler<To, From>> {
+private:
+    template <typename T>
+    using integral_enabler =
+        typename std::enable_if<std::is_integral<T>::value || detail::is_mp_integer<T>::value, int>::type;
+    template <typename T>
+    using rational_enabler = typename std::enable_if<detail::is_mp_rational<T>::value, int>::type;
+
+public:
+    /// Call operator, double_double to integral overload.
+    /**
+     * The conversion will succeed if \p x is a finite integral value representable by
+     * the target type.
+     *
+     * @param[in] x conversion argument.
+     *
+     * @return \p x converted to \p To.
+     *
+     * @throws std::invalid_argument if \p x is not a finite integral value.
+     * @throws unspecified any exception thrown by the conversion operator of piranha::double_double.
+     */
+    template <typename T = To, integral_enabler<T> = 0>
+    T operator()(const double_double &x) const
+    {
+        // NOTE: in a normalised double_double, the value is integral if and only if both
+        // components are integral.
+        if (unlikely(!std::isfinite(x.hi()) || std::trunc(x.hi()) != x.hi() || std::trunc(x.lo()) != x.lo())) {
+            piranha_throw(std::invalid_argument, "the input double_double does not represent a finite integral value");
+        }
+        return static_cast<T>(x);
+    }
+    /// Call operator, double_double to rational overload.
+    /**
+     * @param[in] x conversion argument.
+     *
+     * @return \p x converted to piranha::mp_rational.
+     *
+     * @throws unspecified any exception thrown by the conversion operator of piranha::double_double.
+     */
+    template <typename T = To, rational_enabler<T> = 0>
+    T operator()(const double_double &x) const
+    {
+        return static_cast<T>(x);
+    }
+};
+}
+
+#endif
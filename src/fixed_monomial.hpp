@@ -0,0 +1,1325 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PIRANHA_FIXED_MONOMIAL_HPP
+#define PIRANHA_FIXED_MONOMIAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "detail/cf_mult_impl.hpp"
+#include "detail/power_table.hpp"
+#include "detail/prepare_for_print.hpp"
+#include "detail/safe_integral_adder.hpp"
+#include "exceptions.hpp"
+#include "is_key.hpp"
+#include "math.hpp"
+#include "mp_integer.hpp"
+#include "mp_rational.hpp"
+#include "pow.hpp"
+#include "safe_cast.hpp"
+#include "serialization.hpp"
+#include "symbol.hpp"
+#include "symbol_set.hpp"
+#include "term.hpp"
+#include "type_traits.hpp"
+
+namespace piranha
+{
+
+namespace detail
+{
+
+// Multipliers for the hash of fixed_monomial. These are the outputs of the splitmix64 generator, made odd.
+inline unsigned long long fm_hash_mult(std::size_t i)
+{
+    unsigned long long z = 0x9e3779b97f4a7c15ull * (static_cast<unsigned long long>(i) + 1ull);
+    z = (z ^ (z >> 30u)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27u)) * 0x94d049bb133111ebull;
+    return (z ^ (z >> 31u)) | 1ull;
+}
+}
+
+/// Fixed-size monomial class.
+/**
+ * This class represents a multivariate monomial whose exponents, of type \p T, are stored in an \p std::array of
+ * size \p N. The number of symbols is thus bounded at compile time: a piranha::fixed_monomial is compatible with any
+ * reference set of up to \p N symbols, and the exponents past the size of the reference set are always zero.
+ *
+ * Contrary to piranha::monomial, there is no bookkeeping of the size of the monomial and no switching between static
+ * and dynamic storage. Multiplication, hashing, comparison and the computation of the degree always operate on all the
+ * \p N exponents, in loops whose trip count is known at compile time and which can thus be fully unrolled and
+ * vectorised by the compiler. This class is intended for workloads in which the number of symbols is small and known
+ * in advance.
+ *
+ * This class satisfies the piranha::is_key type trait.
+ *
+ * ## Type requirements ##
+ *
+ * - \p T must be constructible from \p int, it must satisfy the piranha::has_is_zero and piranha::is_hashable type
+ *   traits, and it must be copy-assignable, equality-comparable and less-than comparable.
+ * - \p N must be greater than zero.
+ *
+ * ## Exception safety guarantee ##
+ *
+ * Unless noted otherwise, this class provides the basic exception safety guarantee.
+ *
+ * ## Move semantics ##
+ *
+ * Move semantics is equivalent to the move semantics of \p std::array.
+ *
+ * ## Serialization ##
+ *
+ * This class supports serialization if \p T does.
+ */
+template <typename T, std::size_t N>
+class fixed_monomial
+{
+    PIRANHA_TT_CHECK(has_is_zero, T);
+    PIRANHA_TT_CHECK(std::is_copy_assignable, T);
+    PIRANHA_TT_CHECK(is_hashable, T);
+    PIRANHA_TT_CHECK(is_less_than_comparable, T);
+    static_assert(N > 0u, "The size of a fixed monomial must be greater than zero.");
+
+public:
+    /// Exponent type.
+    using value_type = T;
+    /// Size type.
+    using size_type = std::size_t;
+    /// Maximum number of symbols.
+    static const size_type max_size = N;
+
+private:
+#if !defined(PIRANHA_DOXYGEN_INVOKED)
+    using container_type = std::array<T, N>;
+    // Eval type definition.
+    template <typename U, typename = void>
+    struct eval_type_ {
+    };
+    template <typename U>
+    using e_type = decltype(math::pow(std::declval<U const &>(), std::declval<T const &>()));
+    template <typename U>
+    struct eval_type_<U, typename std::enable_if<is_multipliable_in_place<e_type<U>>::value
+                                                 && std::is_constructible<e_type<U>, int>::value
+                                                 && detail::is_pmappable<U>::value>::type> {
+        using type = e_type<U>;
+    };
+    template <typename U>
+    using eval_type = typename eval_type_<U>::type;
+    // Subs support.
+    template <typename U>
+    using subs_type__ = decltype(math::pow(std::declval<const U &>(), std::declval<const T &>()));
+    template <typename U, typename = void>
+    struct subs_type_ {
+    };
+    template <typename U>
+    struct subs_type_<U,
+                      typename std::enable_if<std::is_constructible<subs_type__<U>, int>::value
+                                              && std::is_assignable<subs_type__<U> &, subs_type__<U>>::value>::type> {
+        using type = subs_type__<U>;
+    };
+    template <typename U>
+    using subs_type = typename subs_type_<U>::type;
+    // ipow subs support.
+    template <typename U>
+    using ipow_subs_type__ = decltype(math::pow(std::declval<const U &>(), std::declval<const integer &>()));
+    template <typename U, typename = void>
+    struct ipow_subs_type_ {
+    };
+    template <typename U>
+    struct ipow_subs_type_<U, typename std::enable_if<std::is_constructible<ipow_subs_type__<U>, int>::value
+                                                      && std::is_assignable<ipow_subs_type__<U> &,
+                                                                            ipow_subs_type__<U>>::value
+                                                      && has_safe_cast<rational, T>::value
+                                                      && is_subtractable_in_place<T, integer>::value>::type> {
+        using type = ipow_subs_type__<U>;
+    };
+    template <typename U>
+    using ipow_subs_type = typename ipow_subs_type_<U>::type;
+    // Enablers for the ctors from init list and range.
+    template <typename U>
+    using init_list_enabler = typename std::enable_if<has_safe_cast<T, U>::value, int>::type;
+    template <typename Iterator>
+    using it_ctor_enabler =
+        typename std::enable_if<is_input_iterator<Iterator>::value
+                                    && has_safe_cast<T, typename std::iterator_traits<Iterator>::value_type>::value,
+                                int>::type;
+    // Multiplication and division.
+    template <typename Cf, typename U>
+    using multiply_enabler =
+        typename std::enable_if<has_add3<U>::value && detail::true_tt<detail::cf_mult_enabler<Cf>>::value, int>::type;
+    template <typename U>
+    using monomial_multiply_enabler = typename std::enable_if<has_add3<U>::value, int>::type;
+    template <typename U>
+    using monomial_divide_enabler = typename std::enable_if<has_sub3<U>::value, int>::type;
+    // Enabler for the evaluation via power tables.
+    template <typename U>
+    using power_table_enabler = typename std::enable_if<std::is_integral<U>::value, int>::type;
+    // Enabler for linear argument.
+    template <typename U>
+    using linarg_enabler = typename std::enable_if<has_safe_cast<integer, U>::value, int>::type;
+    // Pow support.
+    template <typename U, typename std::enable_if<std::is_integral<U>::value, int>::type = 0>
+    static integer get_pow_arg(const U &n)
+    {
+        return integer(n);
+    }
+    template <typename U, typename std::enable_if<!std::is_integral<U>::value, int>::type = 0>
+    static const U &get_pow_arg(const U &x)
+    {
+        return x;
+    }
+    using pow_type = typename std::conditional<std::is_integral<T>::value, integer &&, const T &>::type;
+    template <typename U>
+    using pow_enabler =
+        typename std::enable_if<has_safe_cast<T, decltype(std::declval<pow_type>() * std::declval<const U &>())>::value,
+                                int>::type;
+    // Degree support.
+    template <typename U>
+    using add_type = decltype(std::declval<const U &>() + std::declval<const U &>());
+    template <typename U>
+    using degree_type = typename std::enable_if<std::is_constructible<add_type<U>, int>::value
+                                                    && is_addable_in_place<add_type<U>, U>::value,
+                                                add_type<U>>::type;
+    // If the sum of N exponents is always representable in long long, the degree is computed without checking each
+    // addition for overflow, and only the final result is checked.
+    template <typename U>
+    using fast_degree = std::integral_constant<bool, std::is_integral<U>::value && std::numeric_limits<U>::digits <= 32
+                                                         && N <= (1ull << 31u)>;
+    template <typename U, typename std::enable_if<fast_degree<U>::value, int>::type = 0>
+    static degree_type<U> degree_check(long long n)
+    {
+        using d_type = degree_type<U>;
+        if (unlikely(n > static_cast<long long>(std::numeric_limits<d_type>::max())
+                     || n < static_cast<long long>(std::numeric_limits<d_type>::min()))) {
+            piranha_throw(std::overflow_error, "overflow in the computation of the degree of a monomial");
+        }
+        return static_cast<d_type>(n);
+    }
+    template <typename U, typename std::enable_if<fast_degree<U>::value, int>::type = 0>
+    degree_type<U> degree_impl() const
+    {
+        long long retval = 0;
+        for (size_type i = 0u; i < N; ++i) {
+            retval += m_value[i];
+        }
+        return degree_check<U>(retval);
+    }
+    template <typename U, typename std::enable_if<fast_degree<U>::value, int>::type = 0>
+    degree_type<U> degree_impl(const symbol_set::positions &p) const
+    {
+        long long retval = 0;
+        for (const auto &i : p) {
+            retval += m_value[i];
+        }
+        return degree_check<U>(retval);
+    }
+    template <typename U, typename std::enable_if<std::is_integral<U>::value, int>::type = 0>
+    static void expo_add(degree_type<U> &retval, const U &n)
+    {
+        detail::safe_integral_adder(retval, static_cast<degree_type<U>>(n));
+    }
+    template <typename U, typename std::enable_if<!std::is_integral<U>::value, int>::type = 0>
+    static void expo_add(degree_type<U> &retval, const U &x)
+    {
+        retval += x;
+    }
+    template <typename U, typename std::enable_if<!fast_degree<U>::value, int>::type = 0>
+    degree_type<U> degree_impl() const
+    {
+        degree_type<U> retval(0);
+        for (const auto &x : m_value) {
+            expo_add(retval, x);
+        }
+        return retval;
+    }
+    template <typename U, typename std::enable_if<!fast_degree<U>::value, int>::type = 0>
+    degree_type<U> degree_impl(const symbol_set::positions &p) const
+    {
+        degree_type<U> retval(0);
+        for (const auto &i : p) {
+            expo_add(retval, m_value[i]);
+        }
+        return retval;
+    }
+    // Integrate and partial utils: in-place increment/decrement by one, checked for integral types.
+    template <typename U, typename std::enable_if<std::is_integral<U>::value, int>::type = 0>
+    static void ip_inc(U &x)
+    {
+        if (unlikely(x == std::numeric_limits<U>::max())) {
+            piranha_throw(std::invalid_argument, "positive overflow error in the calculation of the "
+                                                 "integral of a monomial");
+        }
+        x = static_cast<U>(x + U(1));
+    }
+    template <typename U, typename std::enable_if<!std::is_integral<U>::value, int>::type = 0>
+    static void ip_inc(U &x)
+    {
+        x = x + U(1);
+    }
+    template <typename U>
+    using integrate_enabler =
+        typename std::enable_if<std::is_assignable<U &, decltype(std::declval<U &>() + std::declval<U>())>::value,
+                                int>::type;
+    template <typename U, typename std::enable_if<std::is_integral<U>::value, int>::type = 0>
+    static void ip_dec(U &x)
+    {
+        if (unlikely(x == std::numeric_limits<U>::min())) {
+            piranha_throw(std::invalid_argument, "negative overflow error in the calculation of the "
+                                                 "partial derivative of a monomial");
+        }
+        x = static_cast<U>(x - U(1));
+    }
+    template <typename U, typename std::enable_if<!std::is_integral<U>::value, int>::type = 0>
+    static void ip_dec(U &x)
+    {
+        x = x - U(1);
+    }
+    template <typename U>
+    using partial_enabler =
+        typename std::enable_if<std::is_assignable<U &, decltype(std::declval<U &>() - std::declval<U>())>::value,
+                                int>::type;
+    // Hashing of the exponents: plain cast for integral types, std::hash otherwise.
+    template <typename U, typename std::enable_if<std::is_integral<U>::value, int>::type = 0>
+    static std::size_t expo_hash(const U &n)
+    {
+        return static_cast<std::size_t>(n);
+    }
+    template <typename U, typename std::enable_if<!std::is_integral<U>::value, int>::type = 0>
+    static std::size_t expo_hash(const U &x)
+    {
+        return std::hash<U>()(x);
+    }
+    static std::array<std::size_t, N> make_hash_mults()
+    {
+        std::array<std::size_t, N> retval;
+        for (std::size_t i = 0u; i < N; ++i) {
+            retval[i] = static_cast<std::size_t>(detail::fm_hash_mult(i));
+        }
+        return retval;
+    }
+    static const std::array<std::size_t, N> s_hash_mults;
+    // Size check for the reference set of symbols.
+    static void check_args(const symbol_set &args)
+    {
+        if (unlikely(args.size() > N)) {
+            piranha_throw(std::invalid_argument, "the number of symbols exceeds the size of the fixed monomial");
+        }
+    }
+    // Implementation of the ctor from range.
+    template <typename Iterator>
+    size_type construct_from_range(Iterator begin, Iterator end)
+    {
+        size_type i = 0u;
+        for (; begin != end; ++begin, ++i) {
+            if (unlikely(i == N)) {
+                piranha_throw(std::invalid_argument, "the number of exponents exceeds the size of the fixed monomial");
+            }
+            m_value[i] = safe_cast<T>(*begin);
+        }
+        return i;
+    }
+    // Serialization support.
+    friend class boost::serialization::access;
+    template <typename Archive>
+    void serialize(Archive &ar, unsigned int)
+    {
+        for (auto &x : m_value) {
+            ar &x;
+        }
+    }
+#endif
+
+public:
+    /// Arity of the multiply() method.
+    static const std::size_t multiply_arity = 1u;
+    /// Default constructor.
+    /**
+     * After construction all exponents in the monomial will be zero.
+     *
+     * @throws unspecified any exception thrown by the construction of an exponent from \p int.
+     */
+    fixed_monomial()
+    {
+        m_value.fill(T(0));
+    }
+    /// Defaulted copy constructor.
+    fixed_monomial(const fixed_monomial &) = default;
+    /// Defaulted move constructor.
+    fixed_monomial(fixed_monomial &&) = default;
+    /// Constructor from initializer list.
+    /**
+     * \note
+     * This constructor is enabled only if \p U can be cast safely to \p T.
+     *
+     * The first <tt>list.size()</tt> exponents will be initialised with the values in \p list (converted
+     * via piranha::safe_cast()), the remaining exponents will be set to zero.
+     *
+     * @param[in] list initializer list.
+     *
+     * @throws std::invalid_argument if the size of \p list is greater than \p N.
+     * @throws unspecified any exception thrown by piranha::safe_cast() or by the default constructor.
+     */
+    template <typename U, init_list_enabler<U> = 0>
+    explicit fixed_monomial(std::initializer_list<U> list) : fixed_monomial()
+    {
+        construct_from_range(list.begin(), list.end());
+    }
+    /// Constructor from range.
+    /**
+     * \note
+     * This constructor is enabled only if \p Iterator is an input iterator whose value type
+     * can be cast safely to \p T.
+     *
+     * The exponents will be initialised with the values in the range, converted via piranha::safe_cast().
+     * The exponents past the size of the range will be set to zero.
+     *
+     * @param[in] begin beginning of the range.
+     * @param[in] end end of the range.
+     *
+     * @throws std::invalid_argument if the size of the range is greater than \p N.
+     * @throws unspecified any exception thrown by piranha::safe_cast() or by the default constructor.
+     */
+    template <typename Iterator, it_ctor_enabler<Iterator> = 0>
+    explicit fixed_monomial(Iterator begin, Iterator end) : fixed_monomial()
+    {
+        construct_from_range(begin, end);
+    }
+    /// Constructor from range and symbol set.
+    /**
+     * \note
+     * This constructor is enabled only if the corresponding range constructor is enabled.
+     *
+     * This constructor is identical to the constructor from range. In addition, after construction
+     * it will also check that the size of the range is equal to the size of \p s.
+     * This constructor is used by piranha::polynomial::find_cf().
+     *
+     * @param[in] begin beginning of the range.
+     * @param[in] end end of the range.
+     * @param[in] s reference symbol set.
+     *
+     * @throws std::invalid_argument if the size of the range is different from the size of \p s.
+     * @throws unspecified any exception thrown by the constructor from range.
+     */
+    template <typename Iterator, it_ctor_enabler<Iterator> = 0>
+    explicit fixed_monomial(Iterator begin, Iterator end, const symbol_set &s) : fixed_monomial()
+    {
+        if (unlikely(construct_from_range(begin, end) != s.size())) {
+            piranha_throw(std::invalid_argument, "invalid fixed monomial");
+        }
+    }
+    /// Constructor from set of symbols.
+    /**
+     * After construction all exponents in the monomial will be zero.
+     *
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception thrown by the default constructor.
+     */
+    explicit fixed_monomial(const symbol_set &args) : fixed_monomial()
+    {
+        check_args(args);
+    }
+    /// Converting constructor.
+    /**
+     * This constructor is for use when converting from one term type to another in piranha::series. It will
+     * copy \p other, after having checked that \p other is compatible with \p args.
+     *
+     * @param[in] other construction argument.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @throws std::invalid_argument if \p other is not compatible with \p args.
+     * @throws unspecified any exception thrown by the copy constructor.
+     */
+    explicit fixed_monomial(const fixed_monomial &other, const symbol_set &args) : fixed_monomial(other)
+    {
+        if (unlikely(!other.is_compatible(args))) {
+            piranha_throw(std::invalid_argument, "incompatible arguments");
+        }
+    }
+    /// Trivial destructor.
+    ~fixed_monomial()
+    {
+        PIRANHA_TT_CHECK(is_key, fixed_monomial);
+    }
+    /// Defaulted copy assignment operator.
+    fixed_monomial &operator=(const fixed_monomial &) = default;
+    /// Defaulted move assignment operator.
+    fixed_monomial &operator=(fixed_monomial &&) = default;
+    /// Element access.
+    /**
+     * @param[in] i index of the exponent to be accessed.
+     *
+     * @return a reference to the exponent at index \p i.
+     */
+    value_type &operator[](const size_type &i)
+    {
+        piranha_assert(i < N);
+        return m_value[i];
+    }
+    /// Const element access.
+    /**
+     * @param[in] i index of the exponent to be accessed.
+     *
+     * @return a const reference to the exponent at index \p i.
+     */
+    const value_type &operator[](const size_type &i) const
+    {
+        piranha_assert(i < N);
+        return m_value[i];
+    }
+    /// Compatibility check.
+    /**
+     * A monomial and a set of arguments are compatible if the size of \p args is not greater than \p N, and all the
+     * exponents past the size of \p args are zero.
+     *
+     * @param[in] args reference arguments set.
+     *
+     * @return compatibility flag for the monomial.
+     */
+    bool is_compatible(const symbol_set &args) const noexcept
+    {
+        if (args.size() > N) {
+            return false;
+        }
+        return std::all_of(m_value.begin() + args.size(), m_value.end(),
+                           [](const value_type &x) { return math::is_zero(x); });
+    }
+    /// Ignorability check.
+    /**
+     * A monomial is never ignorable by definition.
+     *
+     * @return \p false.
+     */
+    bool is_ignorable(const symbol_set &) const noexcept
+    {
+        return false;
+    }
+    /// Merge arguments.
+    /**
+     * Merge the new arguments set \p new_args into \p this, given the current reference arguments set
+     * \p orig_args.
+     *
+     * @param[in] orig_args original arguments set.
+     * @param[in] new_args new arguments set.
+     *
+     * @return monomial with merged arguments.
+     *
+     * @throws std::invalid_argument if at least one of these conditions is true:
+     * - the size of \p new_args is not greater than the size of \p orig_args,
+     * - the size of \p new_args is greater than \p N,
+     * - not all elements of \p orig_args are included in \p new_args.
+     * @throws unspecified any exception thrown by the default constructor or by the copy assignment of exponents.
+     */
+    fixed_monomial merge_args(const symbol_set &orig_args, const symbol_set &new_args) const
+    {
+        if (unlikely(new_args.size() <= orig_args.size() || new_args.size() > N
+                     || !std::includes(new_args.begin(), new_args.end(), orig_args.begin(), orig_args.end()))) {
+            piranha_throw(std::invalid_argument, "invalid argument(s) for symbol set merging");
+        }
+        piranha_assert(std::is_sorted(orig_args.begin(), orig_args.end()));
+        piranha_assert(std::is_sorted(new_args.begin(), new_args.end()));
+        fixed_monomial retval;
+        size_type j = 0u;
+        for (size_type i = 0u; i < orig_args.size(); ++i, ++j) {
+            const auto &s = orig_args[static_cast<symbol_set::size_type>(i)];
+            while (new_args[static_cast<symbol_set::size_type>(j)] != s) {
+                ++j;
+                piranha_assert(j < new_args.size());
+            }
+            retval.m_value[j] = m_value[i];
+        }
+        return retval;
+    }
+    /// Check if monomial is unitary.
+    /**
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return \p true if all the exponents are zero, \p false otherwise.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception thrown by piranha::math::is_zero().
+     */
+    bool is_unitary(const symbol_set &args) const
+    {
+        check_args(args);
+        return std::all_of(m_value.begin(), m_value.end(), [](const value_type &x) { return math::is_zero(x); });
+    }
+    /// Degree.
+    /**
+     * \note
+     * This method is enabled only if \p T is addable and the type resulting from the addition is constructible from
+     * \p int and \p T can be added in-place to it.
+     *
+     * If \p T is a C++ integral type, the computation will be checked for overflow.
+     *
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the degree of the monomial.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws std::overflow_error if the exponent type is a C++ integral type and the computation
+     * of the degree overflows.
+     * @throws unspecified any exception thrown by the invoked constructor or arithmetic operators.
+     */
+    template <typename U = T>
+    degree_type<U> degree(const symbol_set &args) const
+    {
+        check_args(args);
+        return degree_impl<U>();
+    }
+    /// Partial degree.
+    /**
+     * \note
+     * This method is enabled only if the non-partial degree() is enabled.
+     *
+     * Exponents not in \p p will be discarded during the computation of the partial degree.
+     *
+     * @param[in] p positions of the symbols to be considered.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the partial degree of the monomial.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N, or if \p p is
+     * not compatible with \p args.
+     * @throws std::overflow_error if the exponent type is a C++ integral type and the computation
+     * of the degree overflows.
+     * @throws unspecified any exception thrown by the invoked constructor or arithmetic operators.
+     */
+    template <typename U = T>
+    degree_type<U> degree(const symbol_set::positions &p, const symbol_set &args) const
+    {
+        check_args(args);
+        if (unlikely(p.size() && p.back() >= args.size())) {
+            piranha_throw(std::invalid_argument, "invalid positions");
+        }
+        return degree_impl<U>(p);
+    }
+    /// Low degree (equivalent to the degree).
+    template <typename U = T>
+    degree_type<U> ldegree(const symbol_set &args) const
+    {
+        return degree(args);
+    }
+    /// Partial low degree (equivalent to the partial degree).
+    template <typename U = T>
+    degree_type<U> ldegree(const symbol_set::positions &p, const symbol_set &args) const
+    {
+        return degree(p, args);
+    }
+    /// Name of the linear argument.
+    /**
+     * \note
+     * This method is enabled only if the exponent type supports piranha::safe_cast() to piranha::integer.
+     *
+     * If the monomial is linear in a variable (i.e., all exponents are zero apart from a single unitary
+     * exponent), the name of the variable will be returned. Otherwise, an error will be raised.
+     *
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return name of the linear variable.
+     *
+     * @throws std::invalid_argument if the monomial is not linear or if the size of \p args is greater than \p N.
+     */
+    template <typename U = T, linarg_enabler<U> = 0>
+    std::string linear_argument(const symbol_set &args) const
+    {
+        check_args(args);
+        size_type n_linear = 0u, candidate = 0u;
+        for (size_type i = 0u; i < args.size(); ++i) {
+            integer tmp;
+            try {
+                tmp = safe_cast<integer>(m_value[i]);
+            } catch (const std::invalid_argument &) {
+                piranha_throw(std::invalid_argument, "exponent is not an integer");
+            }
+            if (tmp == 0) {
+                continue;
+            }
+            if (tmp != 1) {
+                piranha_throw(std::invalid_argument, "exponent is not unitary");
+            }
+            candidate = i;
+            ++n_linear;
+        }
+        if (n_linear != 1u) {
+            piranha_throw(std::invalid_argument, "monomial is not linear");
+        }
+        return args[static_cast<symbol_set::size_type>(candidate)].get_name();
+    }
+    /// Monomial exponentiation.
+    /**
+     * \note
+     * This method is enabled if the exponent type (or its promoted piranha::integer counterpart)
+     * is multipliable by \p U and the result type can be cast safely back to the exponent type.
+     *
+     * Will return a monomial corresponding to \p this raised to the <tt>x</tt>-th power. If the exponent type is a
+     * C++ integral type, each exponent will be promoted to piranha::integer before the exponentiation takes place.
+     *
+     * @param[in] x exponent.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return \p this to the power of \p x.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception thrown by piranha::safe_cast() or by the invoked arithmetic operations.
+     */
+    template <typename U, pow_enabler<U> = 0>
+    fixed_monomial pow(const U &x, const symbol_set &args) const
+    {
+        fixed_monomial retval(args);
+        for (size_type i = 0u; i < args.size(); ++i) {
+            retval.m_value[i] = safe_cast<T>(get_pow_arg(m_value[i]) * x);
+        }
+        return retval;
+    }
+    /// Partial derivative.
+    /**
+     * \note
+     * This method is enabled only if the exponent type is subtractable and the result of the operation
+     * can be assigned back to the exponent type.
+     *
+     * This method will return the partial derivative of \p this with respect to the symbol at the position indicated by
+     * \p p. The result is a pair consisting of the exponent associated to \p p before differentiation and the monomial
+     * itself after differentiation. If \p p is empty or if the exponent associated to it is zero,
+     * the returned pair will be <tt>(0,fixed_monomial{args})</tt>.
+     *
+     * @param[in] p position of the symbol with respect to which the differentiation will be calculated.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return result of the differentiation.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N, if the size of \p p is
+     * greater than one, if the position specified by \p p is invalid or if the computation on integral exponents
+     * results in an overflow error.
+     * @throws unspecified any exception thrown by exponent construction and arithmetics, or by
+     * piranha::math::is_zero().
+     */
+    template <typename U = T, partial_enabler<U> = 0>
+    std::pair<U, fixed_monomial> partial(const symbol_set::positions &p, const symbol_set &args) const
+    {
+        check_args(args);
+        if (p.size() > 1u || (p.size() == 1u && p.back() >= args.size())) {
+            piranha_throw(std::invalid_argument, "invalid size of symbol_set::positions");
+        }
+        if (!p.size() || math::is_zero(m_value[*p.begin()])) {
+            return std::make_pair(U(0), fixed_monomial(args));
+        }
+        fixed_monomial m(*this);
+        U v(m.m_value[*p.begin()]);
+        ip_dec(m.m_value[*p.begin()]);
+        return std::make_pair(std::move(v), std::move(m));
+    }
+    /// Integration.
+    /**
+     * \note
+     * This method is enabled only if the exponent type is addable and the result of the operation
+     * can be assigned back to the exponent type.
+     *
+     * Will return the antiderivative of \p this with respect to symbol \p s. The result is a pair
+     * consisting of the exponent associated to \p s increased by one and the monomial itself
+     * after integration. If \p s is not in \p args, the returned monomial will have an extra exponent
+     * set to 1 in the same position \p s would have if it were added to \p args.
+     *
+     * @param[in] s symbol with respect to which the integration will be calculated.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return result of the integration.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N (or equal to \p N, if \p s is not
+     * in \p args), if the exponent associated to \p s is -1, or if the computation on integral exponents
+     * results in an overflow error.
+     * @throws unspecified any exception thrown by exponent construction and arithmetics, or by
+     * piranha::math::is_zero().
+     */
+    template <typename U = T, integrate_enabler<U> = 0>
+    std::pair<U, fixed_monomial> integrate(const symbol &s, const symbol_set &args) const
+    {
+        check_args(args);
+        // Position of s in args (or the position it would have if it were added to args).
+        const auto it = std::lower_bound(args.begin(), args.end(), s);
+        const auto pos = static_cast<size_type>(it - args.begin());
+        fixed_monomial retval(*this);
+        if (it != args.end() && *it == s) {
+            ip_inc(retval.m_value[pos]);
+            if (math::is_zero(retval.m_value[pos])) {
+                piranha_throw(std::invalid_argument,
+                              "unable to perform monomial integration: negative unitary exponent");
+            }
+            U expo(retval.m_value[pos]);
+            return std::make_pair(std::move(expo), std::move(retval));
+        }
+        if (unlikely(args.size() == N)) {
+            piranha_throw(std::invalid_argument, "the number of symbols exceeds the size of the fixed monomial");
+        }
+        // Make room for the new exponent.
+        for (size_type i = args.size(); i > pos; --i) {
+            retval.m_value[i] = m_value[i - 1u];
+        }
+        retval.m_value[pos] = T(1);
+        return std::make_pair(U(1), std::move(retval));
+    }
+    /// Print.
+    /**
+     * Will print to stream a human-readable representation of the monomial.
+     *
+     * @param[in] os target stream.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception resulting from printing exponents to stream.
+     */
+    void print(std::ostream &os, const symbol_set &args) const
+    {
+        check_args(args);
+        const T zero(0), one(1);
+        bool empty_output = true;
+        for (size_type i = 0u; i < args.size(); ++i) {
+            if (m_value[i] != zero) {
+                if (!empty_output) {
+                    os << '*';
+                }
+                os << args[static_cast<symbol_set::size_type>(i)].get_name();
+                empty_output = false;
+                if (m_value[i] != one) {
+                    os << "**" << detail::prepare_for_print(m_value[i]);
+                }
+            }
+        }
+    }
+    /// Print in TeX mode.
+    /**
+     * Will print to stream a TeX representation of the monomial.
+     *
+     * @param[in] os target stream.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception resulting from:
+     * - construction, comparison and assignment of exponents,
+     * - piranha::math::negate(),
+     * - streaming to \p os.
+     */
+    void print_tex(std::ostream &os, const symbol_set &args) const
+    {
+        check_args(args);
+        std::ostringstream oss_num, oss_den, *cur_oss;
+        const T zero(0), one(1);
+        T cur_value;
+        for (size_type i = 0u; i < args.size(); ++i) {
+            cur_value = m_value[i];
+            if (cur_value != zero) {
+                cur_oss
+                    = (cur_value > zero) ? std::addressof(oss_num) : (math::negate(cur_value), std::addressof(oss_den));
+                (*cur_oss) << "{" << args[static_cast<symbol_set::size_type>(i)].get_name() << "}";
+                if (cur_value != one) {
+                    (*cur_oss) << "^{" << detail::prepare_for_print(cur_value) << "}";
+                }
+            }
+        }
+        const std::string num_str = oss_num.str(), den_str = oss_den.str();
+        if (!num_str.empty() && !den_str.empty()) {
+            os << "\\frac{" << num_str << "}{" << den_str << "}";
+        } else if (!num_str.empty() && den_str.empty()) {
+            os << num_str;
+        } else if (num_str.empty() && !den_str.empty()) {
+            os << "\\frac{1}{" << den_str << "}";
+        }
+    }
+    /// Evaluation.
+    /**
+     * \note
+     * This method is available only if \p U satisfies the following requirements:
+     * - it can be used in piranha::symbol_set::positions_map,
+     * - it can be used in piranha::math::pow() with the monomial exponents as powers, yielding a type \p eval_type,
+     * - \p eval_type is constructible from \p int,
+     * - \p eval_type is multipliable in place.
+     *
+     * The return value will be built by iteratively applying piranha::math::pow() using the values provided
+     * by \p pmap as bases and the values in the monomial as exponents. The positions in \p pmap must reference
+     * only and all the symbols in \p args.
+     *
+     * @param[in] pmap piranha::symbol_set::positions_map that will be used for substitution.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the result of evaluating \p this with the values provided in \p pmap.
+     *
+     * @throws std::invalid_argument if there exist an incompatibility between \p this,
+     * \p args or \p pmap.
+     * @throws unspecified any exception thrown by:
+     * - construction of the return type,
+     * - piranha::math::pow() or the in-place multiplication operator of the return type.
+     */
+    template <typename U>
+    eval_type<U> evaluate(const symbol_set::positions_map<U> &pmap, const symbol_set &args) const
+    {
+        check_args(args);
+        if (unlikely(pmap.size() != args.size() || (pmap.size() && pmap.back().first != pmap.size() - 1u))) {
+            piranha_throw(std::invalid_argument, "invalid positions map for evaluation");
+        }
+        eval_type<U> retval(1);
+        auto it = pmap.begin();
+        for (size_type i = 0u; i < args.size(); ++i, ++it) {
+            piranha_assert(it != pmap.end() && it->first == i);
+            retval *= math::pow(it->second, m_value[i]);
+        }
+        piranha_assert(it == pmap.end());
+        return retval;
+    }
+    /// Update the bounds of the exponents.
+    /**
+     * \note
+     * This method is enabled only if the exponent type is a C++ integral type.
+     *
+     * The pairs in \p bounds will be updated so that they contain, respectively, lower and upper bounds for the
+     * exponents of \p this. If \p bounds is empty, it will be initialised from the exponents of \p this.
+     * This method is used in series evaluation, together with the evaluation via power tables.
+     *
+     * @param[in,out] bounds the vector of bounds to be updated.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @throws std::invalid_argument if the sizes of \p this, \p args and \p bounds (if not empty) differ.
+     * @throws unspecified any exception thrown by memory errors in standard containers.
+     */
+    template <typename U = T, power_table_enabler<U> = 0>
+    void update_exponent_bounds(std::vector<std::pair<U, U>> &bounds, const symbol_set &args) const
+    {
+        if (unlikely(args.size() > N || (!bounds.empty() && bounds.size() != args.size()))) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set or exponent bounds");
+        }
+        detail::power_table<U, U>::update_bounds(bounds, m_value.begin(), m_value.begin() + args.size());
+    }
+    /// Evaluation via power tables.
+    /**
+     * \note
+     * This method is enabled only if the exponent type is a C++ integral type, and the other requirements
+     * of the evaluation via piranha::symbol_set::positions_map are satisfied.
+     *
+     * This method will return the same value as the evaluation via piranha::symbol_set::positions_map,
+     * but the powers of the evaluation values are read from \p table, which must cover the exponents of \p this.
+     *
+     * @param[in] table the table of the powers of the evaluation values.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the result of evaluating \p this with the powers provided by \p table.
+     *
+     * @throws std::invalid_argument if the sizes of \p this, \p args and \p table differ.
+     * @throws unspecified any exception thrown by
+     * the construction and the in-place multiplication of the return type.
+     */
+    template <typename U, typename V = T, power_table_enabler<V> = 0>
+    eval_type<U> evaluate(const detail::power_table<U, V> &table, const symbol_set &args) const
+    {
+        if (unlikely(args.size() > N || table.size() != args.size())) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set or power table");
+        }
+        eval_type<U> retval(1);
+        for (decltype(args.size()) i = 0u; i < args.size(); ++i) {
+            retval *= table(i, m_value[i]);
+        }
+        return retval;
+    }
+    /// Substitution.
+    /**
+     * \note
+     * This method is enabled only if:
+     * - \p U can be raised to the value type, yielding a type \p subs_type,
+     * - \p subs_type can be constructed from \p int and it is assignable.
+     *
+     * Substitute the symbol called \p s in the monomial with quantity \p x. The return value is vector containing one
+     * pair in which the first element is the result of substituting \p s with \p x (i.e., \p x raised to the power of
+     * the exponent corresponding to \p s), and the second element the monomial after the substitution has been
+     * performed (i.e., with the exponent corresponding to \p s set to zero). If \p s is not in \p args, the return
+     * value will be <tt>(1,this)</tt>.
+     *
+     * @param[in] s name of the symbol that will be substituted.
+     * @param[in] x quantity that will be substituted in place of \p s.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the result of substituting \p x for \p s.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception thrown by:
+     * - construction and assignment of the return value,
+     * - construction of an exponent from zero,
+     * - piranha::math::pow().
+     */
+    template <typename U>
+    std::vector<std::pair<subs_type<U>, fixed_monomial>> subs(const std::string &s, const U &x,
+                                                              const symbol_set &args) const
+    {
+        check_args(args);
+        subs_type<U> retval_s(1);
+        fixed_monomial retval_key(*this);
+        for (size_type i = 0u; i < args.size(); ++i) {
+            if (args[static_cast<symbol_set::size_type>(i)].get_name() == s) {
+                retval_s = math::pow(x, m_value[i]);
+                retval_key.m_value[i] = T(0);
+            }
+        }
+        std::vector<std::pair<subs_type<U>, fixed_monomial>> retval;
+        retval.push_back(std::make_pair(std::move(retval_s), std::move(retval_key)));
+        return retval;
+    }
+    /// Substitution of integral power.
+    /**
+     * \note
+     * This method is enabled only if:
+     * - \p U can be raised to a piranha::integer power, yielding a type \p subs_type,
+     * - \p subs_type is constructible from \p int and assignable,
+     * - the value type of the monomial can be cast safely to piranha::rational and it supports
+     *   in-place subtraction with piranha::integer.
+     *
+     * Substitute the symbol called \p s to the power of \p n with quantity \p x. The semantics are the same
+     * as in piranha::monomial::ipow_subs().
+     *
+     * @param[in] s name of the symbol that will be substituted.
+     * @param[in] n power of \p s that will be substituted.
+     * @param[in] x quantity that will be substituted in place of \p s to the power of \p n.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the result of substituting \p x for \p s to the power of \p n.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception thrown by:
+     * - construction and assignment of the return value,
+     * - construction of piranha::rational,
+     * - piranha::safe_cast(),
+     * - piranha::math::pow(),
+     * - the in-place subtraction operator of the exponent type.
+     */
+    template <typename U>
+    std::vector<std::pair<ipow_subs_type<U>, fixed_monomial>> ipow_subs(const std::string &s, const integer &n,
+                                                                        const U &x, const symbol_set &args) const
+    {
+        check_args(args);
+        ipow_subs_type<U> retval_s(1);
+        fixed_monomial retval_key(*this);
+        for (size_type i = 0u; i < args.size(); ++i) {
+            if (args[static_cast<symbol_set::size_type>(i)].get_name() == s) {
+                const rational tmp(safe_cast<rational>(m_value[i]) / n);
+                if (tmp >= 1) {
+                    const auto tmp_t = static_cast<integer>(tmp);
+                    retval_s = math::pow(x, tmp_t);
+                    retval_key.m_value[i] -= tmp_t * n;
+                }
+            }
+        }
+        std::vector<std::pair<ipow_subs_type<U>, fixed_monomial>> retval;
+        retval.push_back(std::make_pair(std::move(retval_s), std::move(retval_key)));
+        return retval;
+    }
+    /// Multiply terms with a fixed monomial key.
+    /**
+     * \note
+     * This method is enabled only if \p T satisfies piranha::has_add3 and \p Cf satisfies piranha::is_cf and
+     * piranha::has_mul3.
+     *
+     * Multiply \p t1 by \p t2, storing the result in the only element of \p res. If \p Cf is an instance of
+     * piranha::mp_rational, then only the numerators of the coefficients will be multiplied.
+     *
+     * The exponents are added via piranha::math::add3() over all the \p N elements of the monomials. No check is
+     * performed on the size of the reference set of symbols, and no overflow check is performed on the exponents.
+     *
+     * @param[out] res return value.
+     * @param[in] t1 first argument.
+     * @param[in] t2 second argument.
+     *
+     * @throws unspecified any exception thrown by piranha::math::mul3() or piranha::math::add3().
+     */
+    template <typename Cf, typename U = T, multiply_enabler<Cf, U> = 0>
+    static void multiply(std::array<term<Cf, fixed_monomial>, multiply_arity> &res, const term<Cf, fixed_monomial> &t1,
+                         const term<Cf, fixed_monomial> &t2, const symbol_set &)
+    {
+        auto &t = res[0u];
+        detail::cf_mult_impl(t.m_cf, t1.m_cf, t2.m_cf);
+        for (size_type i = 0u; i < N; ++i) {
+            math::add3(t.m_key.m_value[i], t1.m_key.m_value[i], t2.m_key.m_value[i]);
+        }
+    }
+    /// Multiply fixed monomials.
+    /**
+     * \note
+     * This method is enabled only if \p T satisfies piranha::has_add3.
+     *
+     * Multiply \p a by \p b, storing the result in \p out. No overflow check is performed on the exponents.
+     *
+     * @param[out] out return value.
+     * @param[in] a first argument.
+     * @param[in] b second argument.
+     *
+     * @throws unspecified any exception thrown by piranha::math::add3().
+     */
+    template <typename U = T, monomial_multiply_enabler<U> = 0>
+    static void multiply(fixed_monomial &out, const fixed_monomial &a, const fixed_monomial &b, const symbol_set &)
+    {
+        for (size_type i = 0u; i < N; ++i) {
+            math::add3(out.m_value[i], a.m_value[i], b.m_value[i]);
+        }
+    }
+    /// Divide fixed monomials.
+    /**
+     * \note
+     * This method is enabled only if \p T satisfies piranha::has_sub3.
+     *
+     * Divide \p a by \p b, storing the result in \p out. No overflow check is performed on the exponents.
+     *
+     * @param[out] out return value.
+     * @param[in] a first argument.
+     * @param[in] b second argument.
+     *
+     * @throws unspecified any exception thrown by piranha::math::sub3().
+     */
+    template <typename U = T, monomial_divide_enabler<U> = 0>
+    static void divide(fixed_monomial &out, const fixed_monomial &a, const fixed_monomial &b, const symbol_set &)
+    {
+        for (size_type i = 0u; i < N; ++i) {
+            math::sub3(out.m_value[i], a.m_value[i], b.m_value[i]);
+        }
+    }
+    /// Hash value.
+    /**
+     * The hash value is computed as a linear combination of the exponents (or of their hash values, if \p T is not a
+     * C++ integral type) with fixed pseudo-random odd multipliers.
+     *
+     * @return a hash value for \p this.
+     *
+     * @throws unspecified any exception thrown by the specialisation of \p std::hash for \p T.
+     */
+    std::size_t hash() const
+    {
+        std::size_t retval = 0u;
+        for (size_type i = 0u; i < N; ++i) {
+            retval += expo_hash(m_value[i]) * s_hash_mults[i];
+        }
+        return retval;
+    }
+    /// Equality operator.
+    /**
+     * @param[in] other comparison argument.
+     *
+     * @return \p true if all the exponents of \p this and \p other are equal, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the equality operator of \p T.
+     */
+    bool operator==(const fixed_monomial &other) const
+    {
+        return m_value == other.m_value;
+    }
+    /// Inequality operator.
+    /**
+     * @param[in] other comparison argument.
+     *
+     * @return the opposite of operator==().
+     *
+     * @throws unspecified any exception thrown by operator==().
+     */
+    bool operator!=(const fixed_monomial &other) const
+    {
+        return !(*this == other);
+    }
+    /// Comparison operator.
+    /**
+     * The two monomials will be compared lexicographically.
+     *
+     * @param[in] other comparison argument.
+     *
+     * @return \p true if \p this is lexicographically less than \p other, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the less-than operator of \p T.
+     */
+    bool operator<(const fixed_monomial &other) const
+    {
+        return m_value < other.m_value;
+    }
+    /// Identify symbols that can be trimmed.
+    /**
+     * This method is used in piranha::series::trim(). The input parameter \p candidates
+     * contains a set of symbols that are candidates for elimination. The method will remove
+     * from \p candidates those symbols whose exponent in \p this is not zero.
+     *
+     * @param[in] candidates set of candidates for elimination.
+     * @param[in] args reference arguments set.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception thrown by piranha::math::is_zero() or piranha::symbol_set::remove().
+     */
+    void trim_identify(symbol_set &candidates, const symbol_set &args) const
+    {
+        check_args(args);
+        for (size_type i = 0u; i < args.size(); ++i) {
+            const auto &s = args[static_cast<symbol_set::size_type>(i)];
+            if (!math::is_zero(m_value[i]) && std::binary_search(candidates.begin(), candidates.end(), s)) {
+                candidates.remove(s);
+            }
+        }
+    }
+    /// Trim.
+    /**
+     * This method will return a copy of \p this with the exponents associated to the symbols
+     * in \p trim_args removed.
+     *
+     * @param[in] trim_args arguments whose exponents will be removed.
+     * @param[in] orig_args original arguments set.
+     *
+     * @return trimmed copy of \p this.
+     *
+     * @throws std::invalid_argument if the size of \p orig_args is greater than \p N.
+     * @throws unspecified any exception thrown by the default constructor or by the copy assignment of exponents.
+     */
+    fixed_monomial trim(const symbol_set &trim_args, const symbol_set &orig_args) const
+    {
+        check_args(orig_args);
+        fixed_monomial retval;
+        size_type j = 0u;
+        for (size_type i = 0u; i < orig_args.size(); ++i) {
+            if (!std::binary_search(trim_args.begin(), trim_args.end(),
+                                    orig_args[static_cast<symbol_set::size_type>(i)])) {
+                retval.m_value[j] = m_value[i];
+                ++j;
+            }
+        }
+        return retval;
+    }
+    /// Extract the vector of exponents.
+    /**
+     * This method will write into \p out the exponents of \p this associated to the symbols in \p args. If necessary,
+     * \p out will be resized to match the size of \p args.
+     *
+     * @param[out] out vector into which the exponents will be copied.
+     * @param[in] args reference set of arguments.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception thrown by:
+     * - piranha::safe_cast(),
+     * - the resizing of \p out,
+     * - the copy assignment of the exponents.
+     */
+    void extract_exponents(std::vector<value_type> &out, const symbol_set &args) const
+    {
+        using v_size_type = decltype(out.size());
+        check_args(args);
+        if (unlikely(out.size() != args.size())) {
+            out.resize(safe_cast<v_size_type>(args.size()));
+        }
+        std::copy(m_value.begin(), m_value.begin() + args.size(), out.begin());
+    }
+    /// Split.
+    /**
+     * This method will split \p this into two monomials: the second monomial will contain the exponent
+     * of the first variable in \p args, the first monomial will contain all the other exponents.
+     *
+     * @param[in] args reference arguments set.
+     *
+     * @return a pair of monomials, the second one containing the first exponent, the first one containing all the
+     * other exponents.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N or less than 2.
+     * @throws unspecified any exception thrown by the default constructor or by the copy assignment of exponents.
+     */
+    std::pair<fixed_monomial, fixed_monomial> split(const symbol_set &args) const
+    {
+        check_args(args);
+        if (unlikely(args.size() < 2u)) {
+            piranha_throw(std::invalid_argument, "only monomials with 2 or more variables can be split");
+        }
+        fixed_monomial first, second;
+        std::copy(m_value.begin() + 1, m_value.end(), first.m_value.begin());
+        second.m_value[0u] = m_value[0u];
+        return std::make_pair(std::move(first), std::move(second));
+    }
+    /// Detect negative exponents.
+    /**
+     * @param[in] args reference arguments set.
+     *
+     * @return \p true if at least one exponent is less than zero, \p false otherwise.
+     *
+     * @throws std::invalid_argument if the size of \p args is greater than \p N.
+     * @throws unspecified any exception thrown by the construction of an exponent from an \p int,
+     * or by the comparison operator of the exponent type.
+     */
+    bool has_negative_exponent(const symbol_set &args) const
+    {
+        check_args(args);
+        const value_type zero(0);
+        return std::any_of(m_value.begin(), m_value.end(), [&zero](const value_type &e) { return e < zero; });
+    }
+
+private:
+    container_type m_value;
+};
+
+template <typename T, std::size_t N>
+const std::size_t fixed_monomial<T, N>::multiply_arity;
+
+template <typename T, std::size_t N>
+const typename fixed_monomial<T, N>::size_type fixed_monomial<T, N>::max_size;
+
+template <typename T, std::size_t N>
+const std::array<std::size_t, N> fixed_monomial<T, N>::s_hash_mults
+    = fixed_monomial<T, N>::make_hash_mults();
+}
+
+namespace std
+{
+
+/// Specialisation of \p std::hash for piranha::fixed_monomial.
+template <typename T, std::size_t N>
+struct hash<piranha::fixed_monomial<T, N>> {
+    /// Result type.
+    typedef size_t result_type;
+    /// Argument type.
+    typedef piranha::fixed_monomial<T, N> argument_type;
+    /// Hash operator.
+    /**
+     * @param[in] a argument whose hash value will be computed.
+     *
+     * @return hash value of \p a computed via piranha::fixed_monomial::hash().
+     */
+    result_type operator()(const argument_type &a) const
+    {
+        return a.hash();
+    }
+};
+}
+
+#endif
@@ -0,0 +1,451 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PIRANHA_HORNER_PLAN_HPP
+#define PIRANHA_HORNER_PLAN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "detail/sfinae_types.hpp"
+#include "exceptions.hpp"
+#include "math.hpp"
+#include "mp_integer.hpp"
+#include "pow.hpp"
+#include "safe_cast.hpp"
+#include "series.hpp"
+#include "symbol_set.hpp"
+#include "type_traits.hpp"
+
+namespace piranha
+{
+
+namespace detail
+{
+
+// Detect keys whose exponents can be extracted via update_exponent_bounds().
+template <typename Key, typename = void>
+struct key_has_exponent_bounds {
+    static const bool value = false;
+};
+
+template <typename Key>
+struct key_has_exponent_bounds<Key, typename std::enable_if<std::is_integral<typename Key::value_type>::value>::type> {
+    using bounds_type = std::vector<std::pair<typename Key::value_type, typename Key::value_type>>;
+    template <typename K>
+    static auto test(const K &k) -> decltype(
+        k.update_exponent_bounds(std::declval<bounds_type &>(), std::declval<const symbol_set &>()), void(),
+        sfinae_types::yes());
+    static sfinae_types::no test(...);
+    static const bool value = std::is_same<decltype(test(std::declval<const Key &>())), sfinae_types::yes>::value;
+};
+
+template <typename Key, typename Enable>
+const bool key_has_exponent_bounds<Key, Enable>::value;
+
+template <typename Key>
+const bool key_has_exponent_bounds<
+    Key, typename std::enable_if<std::is_integral<typename Key::value_type>::value>::type>::value;
+
+// Enabler for horner_plan.
+template <typename T, typename = void>
+struct horner_plan_enabled : std::false_type {
+};
+
+template <typename T>
+struct horner_plan_enabled<T, typename std::enable_if<is_series<T>::value>::type>
+    : std::integral_constant<bool, key_has_exponent_bounds<typename T::term_type::key_type>::value> {
+};
+}
+
+/// Horner evaluation plan.
+/**
+ * This class compiles a series with monomial-like keys (e.g., a polynomial with integral exponents) into a
+ * multivariate Horner scheme, which can then be evaluated many times via the evaluate() method.
+ *
+ * The scheme is built greedily: the terms are grouped according to the exponent of the symbol appearing in the
+ * largest number of terms, the groups are compiled recursively (with that symbol removed) and then combined via
+ * the univariate Horner rule in the chosen symbol. For instance, the polynomial
+ * \f[
+ * x^3y + 2x^3 + xy^2 + 3
+ * \f]
+ * is evaluated as
+ * \f[
+ * x\left(x^2\left(y + 2\right) + y^2\right) + 3.
+ * \f]
+ * The scheme is stored as a flat sequence of instructions for a stack machine, in which the coefficients of the
+ * original series are kept untouched. The evaluation of the plan can thus be performed with any evaluation type
+ * supported by piranha::math::evaluate() for the original series, and it requires in general far fewer
+ * multiplications than the term-by-term evaluation performed by piranha::series::evaluate().
+ *
+ * ## Type requirements ##
+ *
+ * \p T must be an instance of piranha::series whose key type has an integral \p value_type and provides an
+ * <tt>update_exponent_bounds()</tt> method (as, e.g., piranha::monomial and piranha::kronecker_monomial).
+ *
+ * ## Exception safety guarantee ##
+ *
+ * This class provides the strong exception safety guarantee for all operations.
+ *
+ * ## Move semantics ##
+ *
+ * Move semantics is equivalent to the move semantics of the internal members.
+ */
+template <typename T>
+class horner_plan
+{
+    static_assert(detail::horner_plan_enabled<T>::value, "Invalid type.");
+    using term_type = typename T::term_type;
+    using cf_type = typename term_type::cf_type;
+    using key_type = typename term_type::key_type;
+    using expo_type = typename key_type::value_type;
+    using bounds_type = std::vector<std::pair<expo_type, expo_type>>;
+    // The instructions of the stack machine.
+    enum class op_type { push_cf, mul_pow, add };
+    struct instruction {
+        op_type m_op;
+        // Index of the coefficient for push_cf, index of the power in m_pows for mul_pow.
+        std::size_t m_idx;
+    };
+    // Map from (symbol index, exponent) to the index of the corresponding power in m_pows.
+    using pow_map_type = std::map<std::pair<std::size_t, expo_type>, std::size_t>;
+    // Compile the terms whose indices are in the range [begin, end). active[j] is false if the j-th symbol
+    // has already been taken care of by an outer level of the scheme.
+    template <typename It>
+    void compile(It begin, It end, std::vector<char> &active, pow_map_type &pow_map)
+    {
+        piranha_assert(begin != end);
+        if (end - begin == 1) {
+            // A single term: push the coefficient and multiply it by the powers of the remaining symbols.
+            m_program.push_back(instruction{op_type::push_cf, *begin});
+            for (std::size_t j = 0u; j < m_n_args; ++j) {
+                if (active[j] && expo(*begin, j) != expo_type(0)) {
+                    m_program.push_back(
+                        instruction{op_type::mul_pow, pow_index(pow_map, j, integer(expo(*begin, j)))});
+                }
+            }
+            return;
+        }
+        // Pick the symbol appearing in the largest number of terms.
+        std::fill(m_counts.begin(), m_counts.end(), std::size_t(0u));
+        for (auto it = begin; it != end; ++it) {
+            for (std::size_t j = 0u; j < m_n_args; ++j) {
+                m_counts[j] += static_cast<std::size_t>(expo(*it, j) != expo_type(0));
+            }
+        }
+        std::size_t best = 0u, best_count = 0u;
+        for (std::size_t j = 0u; j < m_n_args; ++j) {
+            if (active[j] && m_counts[j] > best_count) {
+                best = j;
+                best_count = m_counts[j];
+            }
+        }
+        // NOTE: as the keys in a series are unique, at least one symbol must have nonzero exponents.
+        piranha_assert(best_count);
+        sort_terms(begin, end, best);
+        active[best] = 0;
+        auto g_begin = begin;
+        while (true) {
+            const auto e = expo(*g_begin, best);
+            const auto g_end = std::find_if(g_begin, end, [this, best, &e](std::size_t i) {
+                return expo(i, best) != e;
+            });
+            compile(g_begin, g_end, active, pow_map);
+            if (g_begin != begin) {
+                m_program.push_back(instruction{op_type::add, 0u});
+            }
+            // Multiply by the power needed to reach the exponent of the next group (or zero).
+            const expo_type next = (g_end == end) ? expo_type(0) : expo(*g_end, best);
+            if (e != next) {
+                m_program.push_back(
+                    instruction{op_type::mul_pow, pow_index(pow_map, best, integer(e) - integer(next))});
+            }
+            if (g_end == end) {
+                break;
+            }
+            g_begin = g_end;
+        }
+        active[best] = 1;
+    }
+    // Sort the terms whose indices are in the range [begin, end) by descending exponent of the j-th symbol.
+    // A counting sort is used when the exponents span a small range.
+    template <typename It>
+    void sort_terms(It begin, It end, std::size_t j)
+    {
+        expo_type e_min = expo(*begin, j), e_max = e_min;
+        for (auto it = begin; it != end; ++it) {
+            e_min = std::min(e_min, expo(*it, j));
+            e_max = std::max(e_max, expo(*it, j));
+        }
+        const auto size = static_cast<std::size_t>(end - begin);
+        if (integer(e_max) - integer(e_min) >= size) {
+            std::sort(begin, end, [this, j](std::size_t i1, std::size_t i2) {
+                const auto &e1 = expo(i1, j), &e2 = expo(i2, j);
+                return e2 < e1 || (e1 == e2 && i1 < i2);
+            });
+            return;
+        }
+        const auto n_buckets = static_cast<std::size_t>(e_max - e_min) + 1u;
+        m_buckets.assign(n_buckets + 1u, 0u);
+        for (auto it = begin; it != end; ++it) {
+            ++m_buckets[static_cast<std::size_t>(e_max - expo(*it, j)) + 1u];
+        }
+        std::partial_sum(m_buckets.begin(), m_buckets.end(), m_buckets.begin());
+        m_tmp.resize(size);
+        for (auto it = begin; it != end; ++it) {
+            m_tmp[m_buckets[static_cast<std::size_t>(e_max - expo(*it, j))]++] = *it;
+        }
+        std::copy(m_tmp.begin(), m_tmp.end(), begin);
+    }
+    const expo_type &expo(std::size_t i, std::size_t j) const
+    {
+        return m_expos[i * m_n_args + j];
+    }
+    // Index of the power of the j-th symbol to the exponent n in m_pows, which is appended if not present.
+    std::size_t pow_index(pow_map_type &pow_map, std::size_t j, const integer &n)
+    {
+        const auto p = std::make_pair(j, safe_cast<expo_type>(n));
+        const auto it = pow_map.find(p);
+        if (it != pow_map.end()) {
+            return it->second;
+        }
+        m_pows.push_back(p);
+        pow_map.emplace(p, m_pows.size() - 1u);
+        return m_pows.size() - 1u;
+    }
+    // Types involved in the evaluation.
+    template <typename U>
+    using e_type = decltype(math::evaluate(std::declval<const T &>(),
+                                           std::declval<const std::unordered_map<std::string, U> &>()));
+    template <typename U>
+    using cf_e_type = decltype(
+        math::evaluate(std::declval<const cf_type &>(), std::declval<const std::unordered_map<std::string, U> &>()));
+    template <typename U>
+    using pow_type = decltype(math::pow(std::declval<const U &>(), std::declval<const expo_type &>()));
+    template <typename U>
+    using eval_type = typename std::enable_if<
+        std::is_constructible<e_type<U>, cf_e_type<U>>::value && std::is_constructible<e_type<U>, int>::value
+            && std::is_same<decltype(std::declval<e_type<U> &>() *= std::declval<const pow_type<U> &>()),
+                            e_type<U> &>::value
+            && std::is_same<decltype(std::declval<e_type<U> &>() += std::declval<e_type<U>>()), e_type<U> &>::value,
+        e_type<U>>::type;
+
+public:
+    /// Constructor.
+    /**
+     * The constructor will compile \p x into a Horner scheme.
+     *
+     * @param[in] x the series that will be compiled.
+     *
+     * @throws unspecified any exception thrown by:
+     * - memory errors in standard containers,
+     * - the copy constructor of the coefficient type of \p T,
+     * - the <tt>update_exponent_bounds()</tt> method of the key type of \p T,
+     * - piranha::safe_cast(), if the difference between two exponents of a symbol is not representable
+     *   by the exponent type.
+     */
+    explicit horner_plan(const T &x) : m_args(x.get_symbol_set()), m_n_args(x.get_symbol_set().size())
+    {
+        m_cfs.reserve(x.size());
+        m_expos.reserve(x.size() * m_n_args);
+        bounds_type expos;
+        for (const auto &t : x._container()) {
+            m_cfs.push_back(t.m_cf);
+            // NOTE: the bounds computed from a single key are its exponents.
+            expos.clear();
+            t.m_key.update_exponent_bounds(expos, m_args);
+            for (const auto &p : expos) {
+                m_expos.push_back(p.first);
+            }
+        }
+        if (m_cfs.empty()) {
+            return;
+        }
+        std::vector<std::size_t> idx(m_cfs.size());
+        for (std::size_t i = 0u; i < idx.size(); ++i) {
+            idx[i] = i;
+        }
+        std::vector<char> active(m_n_args, 1);
+        pow_map_type pow_map;
+        m_counts.resize(m_n_args);
+        compile(idx.begin(), idx.end(), active, pow_map);
+        // The exponents and the scratch buffers are not needed anymore.
+        std::vector<expo_type>().swap(m_expos);
+        std::vector<std::size_t>().swap(m_counts);
+        std::vector<std::size_t>().swap(m_buckets);
+        std::vector<std::size_t>().swap(m_tmp);
+    }
+    /// Evaluation.
+    /**
+     * \note
+     * This method is enabled only if the return type of piranha::math::evaluate() for \p T and \p U (the
+     * evaluation type) can be constructed from \p int and from the evaluation type of the coefficients,
+     * and it supports in-place addition and in-place multiplication by the powers of \p U.
+     *
+     * The plan is evaluated with the values in \p dict, and the result is mathematically equivalent to
+     * the result of piranha::math::evaluate() on the compiled series. For floating-point types, the result
+     * might differ slightly, as the operations are performed in a different order.
+     *
+     * @param[in] dict the evaluation dictionary.
+     *
+     * @return the value of the compiled series evaluated according to \p dict.
+     *
+     * @throws std::invalid_argument if \p dict does not contain all the symbols of the compiled series.
+     * @throws unspecified any exception thrown by:
+     * - piranha::math::evaluate() and piranha::math::pow(),
+     * - the arithmetic operations on the evaluation type,
+     * - memory errors in standard containers.
+     */
+    template <typename U>
+    eval_type<U> evaluate(const std::unordered_map<std::string, U> &dict) const
+    {
+        using ret_type = eval_type<U>;
+        const symbol_set::positions_map<U> pmap(m_args, dict);
+        if (unlikely(pmap.size() != m_n_args)) {
+            // Locate the first missing symbol.
+            decltype(m_args.size()) i = 0u;
+            for (const auto &p : pmap) {
+                if (p.first != i) {
+                    break;
+                }
+                ++i;
+            }
+            piranha_throw(std::invalid_argument, "the symbol '" + m_args[i].get_name()
+                                                     + "' is missing from the evaluation dictionary");
+        }
+        if (m_program.empty()) {
+            return ret_type(0);
+        }
+        // Compute the powers.
+        std::vector<pow_type<U>> pows;
+        pows.reserve(m_pows.size());
+        for (const auto &p : m_pows) {
+            pows.push_back(math::pow((pmap.begin() + static_cast<std::ptrdiff_t>(p.first))->second, p.second));
+        }
+        return run<U>(pows, dict);
+    }
+    /// Evaluation with a vector of values.
+    /**
+     * \note
+     * This method is enabled only if the evaluation with a dictionary is enabled, and the coefficient type
+     * of \p T is not an instance of piranha::series.
+     *
+     * The result is the same as the evaluation with a dictionary in which the <tt>i</tt>-th symbol of the compiled
+     * series (in the order of its piranha::symbol_set) is mapped to <tt>values[i]</tt>. No dictionary
+     * is built or searched, hence this method is faster when the same plan is evaluated many times.
+     *
+     * @param[in] values the evaluation values.
+     *
+     * @return the value of the compiled series evaluated with \p values.
+     *
+     * @throws std::invalid_argument if the size of \p values differs from the number of symbols of the compiled
+     * series.
+     * @throws unspecified any exception thrown by:
+     * - piranha::math::evaluate() and piranha::math::pow(),
+     * - the arithmetic operations on the evaluation type,
+     * - memory errors in standard containers.
+     */
+    template <typename U, typename Cf = cf_type, typename std::enable_if<!is_series<Cf>::value, int>::type = 0>
+    eval_type<U> evaluate(const std::vector<U> &values) const
+    {
+        using ret_type = eval_type<U>;
+        if (unlikely(values.size() != m_n_args)) {
+            piranha_throw(std::invalid_argument, "the number of evaluation values differs from the number of "
+                                                 "symbols of the compiled series");
+        }
+        if (m_program.empty()) {
+            return ret_type(0);
+        }
+        std::vector<pow_type<U>> pows;
+        pows.reserve(m_pows.size());
+        for (const auto &p : m_pows) {
+            pows.push_back(math::pow(values[p.first], p.second));
+        }
+        // NOTE: the coefficients are not series, hence their evaluation does not depend on the dictionary.
+        return run<U>(pows, std::unordered_map<std::string, U>{});
+    }
+    /// Size of the plan.
+    /**
+     * @return the number of instructions in the plan, which is a rough measure of the cost of the evaluation.
+     */
+    std::size_t size() const
+    {
+        return m_program.size();
+    }
+
+private:
+    // Run the program with the powers pows, evaluating the coefficients with dict.
+    template <typename U>
+    eval_type<U> run(const std::vector<pow_type<U>> &pows, const std::unordered_map<std::string, U> &dict) const
+    {
+        using ret_type = eval_type<U>;
+        std::vector<ret_type> stack;
+        for (const auto &ins : m_program) {
+            switch (ins.m_op) {
+                case op_type::push_cf:
+                    stack.emplace_back(math::evaluate(m_cfs[ins.m_idx], dict));
+                    break;
+                case op_type::mul_pow:
+                    piranha_assert(!stack.empty());
+                    stack.back() *= pows[ins.m_idx];
+                    break;
+                case op_type::add:
+                    piranha_assert(stack.size() >= 2u);
+                    {
+                        ret_type tmp(std::move(stack.back()));
+                        stack.pop_back();
+                        stack.back() += std::move(tmp);
+                    }
+            }
+        }
+        piranha_assert(stack.size() == 1u);
+        return std::move(stack.back());
+    }
+    symbol_set m_args;
+    std::size_t m_n_args;
+    std::vector<cf_type> m_cfs;
+    std::vector<expo_type> m_expos;
+    // Scratch buffers for the compilation.
+    std::vector<std::size_t> m_counts;
+    std::vector<std::size_t> m_buckets;
+    std::vector<std::size_t> m_tmp;
+    std::vector<std::pair<std::size_t, expo_type>> m_pows;
+    std::vector<instruction> m_program;
+};
+}
+
+#endif
@@ -33,6 +33,8 @@ see https://www.gnu.org/licenses/. */
 #include <cstdlib>
 #include <iostream>
 
+#include "config.hpp"
+#include "detail/gmp_memory_pool.hpp"
 #include "detail/mpfr.hpp"
 
 namespace piranha
@@ -81,6 +83,11 @@ inline bool shutdown()
  * It will register cleanup functions that will be run on program exit (e.g.,
  * the MPFR <tt>mpfr_free_cache()</tt> function).
  *
+ * If the compiler supports the \p thread_local keyword, this function will also route the memory allocations
+ * performed by GMP through thread-local pools of recently freed blocks, via <tt>mp_set_memory_functions()</tt>.
+ * The pools sit on top of the memory functions in use at the time of the first call to this function, and they
+ * reduce the cost of the allocations performed by multiprecision arithmetic in multithreaded code.
+ *
  * It is allowed to call this function concurrently from multiple threads: after the first
  * invocation, additional invocations will not perform any action.
  */
@@ -103,6 +110,9 @@ inline void init()
         std::cerr << "The MPFR library was not built thread-safe.\n";
         std::cerr.flush();
     }
+#if defined(PIRANHA_HAVE_THREAD_LOCAL)
+    detail::gmp_memory_pool<>::install();
+#endif
 }
 }
 
@@ -29,10 +29,13 @@ see https://www.gnu.org/licenses/. */
 #ifndef PIRANHA_IPOW_SUBSTITUTABLE_SERIES_HPP
 #define PIRANHA_IPOW_SUBSTITUTABLE_SERIES_HPP
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 
+#include "detail/grouped_subs.hpp"
 #include "forwarding.hpp"
 #include "mp_integer.hpp"
 #include "serialization.hpp"
@@ -166,6 +169,201 @@ class ipow_substitutable_series : public Series, detail::ipow_substitutable_seri
     using ipow_subs_type = typename std::enable_if<std::is_constructible<subs_type_<T>, int>::value
                                                        && is_addable_in_place<subs_type_<T>>::value,
                                                    subs_type_<T>>::type;
+    // Detect if the substitution can be performed by grouping the terms (i.e., only the keys are affected by
+    // the substitution and the key type supports splitting).
+    template <typename T, typename Term = typename Series::term_type, typename = void>
+    struct grouped_subs : std::false_type {
+    };
+    template <typename T, typename Term>
+    struct grouped_subs<
+        T, Term, typename std::enable_if<subs_term_score<Term, T>::value == 2u
+                                         && detail::key_has_ipow_subs_split<typename Term::key_type>::value>::type>
+        : std::true_type {
+    };
+    // Detect if the substitution affects only the coefficients, preserving their type.
+    template <typename T, typename Term = typename Series::term_type, typename = void>
+    struct cf_only_subs : std::false_type {
+    };
+    template <typename T, typename Term>
+    struct cf_only_subs<T, Term,
+                        typename std::enable_if<subs_term_score<Term, T>::value == 1u
+                                                && std::is_same<cf_subs_type<T, Term>, typename Term::cf_type>::value
+                                                && std::is_same<ipow_subs_type<T>, Derived>::value>::type>
+        : std::true_type {
+    };
+    template <typename T>
+    using grouped_subs_enabler = typename std::enable_if<grouped_subs<T>::value, int>::type;
+    template <typename T>
+    using cf_only_subs_enabler = typename std::enable_if<cf_only_subs<T>::value, int>::type;
+    template <typename T>
+    using generic_subs_enabler =
+        typename std::enable_if<!grouped_subs<T>::value && !cf_only_subs<T>::value, int>::type;
+    // Generic implementation of ipow_subs().
+    template <typename T, generic_subs_enabler<T> = 0>
+    ipow_subs_type<T> ipow_subs_impl(const std::string &name, const integer &n, const T &x) const
+    {
+        ipow_subs_type<T> retval(0);
+        for (const auto &t : this->m_container) {
+            retval += subs_term_impl(t, name, n, x, this->m_symbol_set);
+        }
+        return retval;
+    }
+    // Implementation by grouping of the terms.
+    template <typename T, grouped_subs_enabler<T> = 0>
+    ipow_subs_type<T> ipow_subs_impl(const std::string &name, const integer &n, const T &x) const
+    {
+        using key_type = typename Series::term_type::key_type;
+        const auto &s_set = this->m_symbol_set;
+        return detail::grouped_subs<ipow_subs_type<T>>(
+            *static_cast<Derived const *>(this),
+            [&name, &n, &s_set](const key_type &k) { return k.ipow_subs_split(name, n, s_set); },
+            [&name, &n, &x, &s_set](const key_type &k) { return k.ipow_subs(name, n, x, s_set); });
+    }
+    // Implementation when only the coefficients are affected.
+    template <typename T, cf_only_subs_enabler<T> = 0>
+    Derived ipow_subs_impl(const std::string &name, const integer &n, const T &x) const
+    {
+        using cf_type = typename Series::term_type::cf_type;
+        return detail::cf_only_subs(*static_cast<Derived const *>(this),
+                                    [&name, &n, &x](const cf_type &cf) { return math::ipow_subs(cf, name, n, x); });
+    }
+    // Simultaneous substitution of the integral powers of several symbols.
+    template <typename T>
+    using dict_type = std::unordered_map<std::string, std::pair<integer, T>>;
+    template <typename T>
+    using dict_items = detail::subs_dict_items<std::pair<integer, T>>;
+    // Type resulting from the simultaneous substitution in the coefficients.
+    template <typename T, typename Term>
+    using cf_dict_subs_type
+        = decltype(std::declval<typename Term::cf_type const &>().ipow_subs(std::declval<const dict_type<T> &>()));
+    // Requirements on the coefficients: if they are affected by the substitution, they must support simultaneous
+    // substitution, yielding the same type as the substitution of a single symbol.
+    template <typename T, typename Term, typename = void>
+    struct dict_cf_check : std::integral_constant<bool, (subs_term_score<Term, T>::value & 1u) == 0u> {
+    };
+    template <typename T, typename Term>
+    struct dict_cf_check<T, Term, typename std::enable_if<std::is_same<cf_dict_subs_type<T, Term>,
+                                                                       cf_subs_type<T, Term>>::value>::type>
+        : std::true_type {
+    };
+    // Requirements on the keys: if they are affected by the substitution, the values resulting from the substitution
+    // must be multipliable in place.
+    template <typename T, typename Term, typename = void>
+    struct dict_key_check : std::integral_constant<bool, (subs_term_score<Term, T>::value & 2u) == 0u> {
+    };
+    template <typename T, typename Term>
+    struct dict_key_check<T, Term,
+                          typename std::enable_if<is_multipliable_in_place<k_subs_type<T, Term>>::value>::type>
+        : std::true_type {
+    };
+    template <typename T>
+    using ipow_subs_dict_type = typename std::enable_if<dict_cf_check<T, typename Series::term_type>::value
+                                                            && dict_key_check<T, typename Series::term_type>::value
+                                                            && is_addable_in_place<ipow_subs_type<T>, Derived>::value,
+                                                        ipow_subs_type<T>>::type;
+    // Simultaneous substitution in a term, case 1: subs only on cf.
+    template <typename T, typename Term, typename std::enable_if<subs_term_score<Term, T>::value == 1u, int>::type = 0>
+    static ret_type_1<T, Term> subs_term_dict_impl(const Term &t, const dict_type<T> &dict, const dict_items<T> &,
+                                                   const symbol_set &s_set)
+    {
+        Derived tmp;
+        tmp.set_symbol_set(s_set);
+        tmp.insert(Term(typename Term::cf_type(1), t.m_key));
+        return t.m_cf.ipow_subs(dict) * std::move(tmp);
+    }
+    // Chained substitution of the items in a key.
+    template <typename T, typename Key>
+    using key_subs_type = decltype(std::declval<const Key &>().ipow_subs(
+        std::declval<const std::string &>(), std::declval<const integer &>(), std::declval<const T &>(),
+        std::declval<const symbol_set &>()));
+    template <typename T, typename Key>
+    static key_subs_type<T, Key> key_dict_subs(const Key &k, const dict_items<T> &items, const symbol_set &s_set)
+    {
+        return detail::chain_key_subs(k, items.size(), [&items, &s_set](std::size_t i, const Key &key) {
+            return key.ipow_subs(*items[i].first, items[i].second->first, items[i].second->second, s_set);
+        });
+    }
+    // Case 2: subs only on key.
+    template <typename T, typename Term, typename std::enable_if<subs_term_score<Term, T>::value == 2u, int>::type = 0>
+    static ret_type_2<T, Term> subs_term_dict_impl(const Term &t, const dict_type<T> &, const dict_items<T> &items,
+                                                   const symbol_set &s_set)
+    {
+        ret_type_2<T, Term> retval(0);
+        auto ksubs = key_dict_subs(t.m_key, items, s_set);
+        for (auto &p : ksubs) {
+            Derived tmp;
+            tmp.set_symbol_set(s_set);
+            tmp.insert(Term{t.m_cf, std::move(p.second)});
+            retval += std::move(tmp) * std::move(p.first);
+        }
+        return retval;
+    }
+    // Case 3: subs on cf and key.
+    template <typename T, typename Term, typename std::enable_if<subs_term_score<Term, T>::value == 3u, int>::type = 0>
+    static ret_type_3<T, Term> subs_term_dict_impl(const Term &t, const dict_type<T> &dict,
+                                                   const dict_items<T> &items, const symbol_set &s_set)
+    {
+        ret_type_2<T, Term> acc(0);
+        auto ksubs = key_dict_subs(t.m_key, items, s_set);
+        auto cf_subs = t.m_cf.ipow_subs(dict);
+        for (auto &p : ksubs) {
+            Derived tmp;
+            tmp.set_symbol_set(s_set);
+            tmp.insert(Term(typename Term::cf_type(1), std::move(p.second)));
+            acc += std::move(tmp) * std::move(p.first);
+        }
+        return std::move(cf_subs) * std::move(acc);
+    }
+    template <typename T>
+    using grouped_dict_subs = std::integral_constant<
+        bool, subs_term_score<typename Series::term_type, T>::value == 2u
+                  && detail::key_has_single_ipow_subs_split<typename Series::term_type::key_type>::value>;
+    template <typename T>
+    using grouped_dict_subs_enabler = typename std::enable_if<grouped_dict_subs<T>::value, int>::type;
+    template <typename T>
+    using generic_dict_subs_enabler =
+        typename std::enable_if<!grouped_dict_subs<T>::value && !cf_only_subs<T>::value, int>::type;
+    // Generic implementation of the simultaneous substitution: the terms are processed in parallel blocks.
+    template <typename T, generic_dict_subs_enabler<T> = 0>
+    ipow_subs_type<T> ipow_subs_dict_impl(const dict_type<T> &dict) const
+    {
+        const auto items = detail::sorted_subs_dict_items(dict);
+        const auto &s_set = this->m_symbol_set;
+        return detail::blocked_subs<ipow_subs_type<T>>(
+            *static_cast<Derived const *>(this), [&dict, &items, &s_set](const typename Series::term_type &t) {
+                return subs_term_dict_impl(t, dict, items, s_set);
+            });
+    }
+    // Implementation by grouping of the terms, with tables of the values of the substitution. The symbols which do not
+    // appear in the series are ignored.
+    template <typename T, grouped_dict_subs_enabler<T> = 0>
+    ipow_subs_type<T> ipow_subs_dict_impl(const dict_type<T> &dict) const
+    {
+        using key_type = typename Series::term_type::key_type;
+        const auto &s_set = this->m_symbol_set;
+        const auto items = detail::sorted_subs_dict_items(dict, &s_set);
+        if (items.empty()) {
+            ipow_subs_type<T> retval(0);
+            retval += *static_cast<Derived const *>(this);
+            return retval;
+        }
+        return detail::multi_grouped_subs<ipow_subs_type<T>>(
+            *static_cast<Derived const *>(this), items.size(),
+            [&items, &s_set](std::size_t i, const key_type &k) {
+                return k.ipow_subs_split(*items[i].first, items[i].second->first, s_set);
+            },
+            [&items, &s_set](std::size_t i, const key_type &k) {
+                return k.ipow_subs(*items[i].first, items[i].second->first, items[i].second->second, s_set);
+            });
+    }
+    // Implementation when only the coefficients are affected.
+    template <typename T, cf_only_subs_enabler<T> = 0>
+    Derived ipow_subs_dict_impl(const dict_type<T> &dict) const
+    {
+        using cf_type = typename Series::term_type::cf_type;
+        return detail::cf_only_subs(*static_cast<Derived const *>(this),
+                                    [&dict](const cf_type &cf) { return cf.ipow_subs(dict); });
+    }
     // Enabler for the alternate overload.
     template <typename Int>
     using ipow_subs_int_enabler = typename std::enable_if<std::is_integral<Int>::value, int>::type;
@@ -201,6 +399,12 @@ public:
      * name
      * in \p this with the generic object \p x.
      *
+     * If the substitution affects only the keys and the key type provides an <tt>ipow_subs_split()</tt> method
+     * (e.g., piranha::monomial::ipow_subs_split()), the terms are grouped by the power of \p x they require: each
+     * power is computed once and multiplied by the sum of the cofactors of its group, and the groups are processed
+     * in parallel. If the substitution affects only the coefficients and it does not change their type, the
+     * coefficients are substituted in parallel and the result is built directly from the original keys.
+     *
      * @param[in] name name of the symbol to be substituted.
      * @param[in] n integral power of the symbol to be substituted.
      * @param[in] x object used for the substitution.
@@ -210,16 +414,13 @@ public:
      * @throws unspecified any exception resulting from:
      * - the substitution routines for the coefficients and/or keys,
      * - the computation of the return value,
-     * - piranha::series::insert().
+     * - piranha::series::insert(),
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back().
      */
     template <typename T>
     ipow_subs_type<T> ipow_subs(const std::string &name, const integer &n, const T &x) const
     {
-        ipow_subs_type<T> retval(0);
-        for (const auto &t : this->m_container) {
-            retval += subs_term_impl(t, name, n, x, this->m_symbol_set);
-        }
-        return retval;
+        return ipow_subs_impl(name, n, x);
     }
     /// Substitution.
     /**
@@ -244,6 +445,52 @@ public:
     {
         return this->ipow_subs(name, integer(n), x);
     }
+    /// Simultaneous substitution.
+    /**
+     * \note
+     * This method is enabled only if the ipow_subs() overload for a single symbol is enabled, and if:
+     * - the coefficient type, if it supports substitution, provides a simultaneous substitution method
+     *   yielding the same type as piranha::math::ipow_subs(),
+     * - the values resulting from the substitution in the keys, if the keys support substitution, are multipliable
+     *   in place,
+     * - the return type is addable in place with \p Derived.
+     *
+     * This method will return an object resulting from the simultaneous substitution of the integral powers of the
+     * symbols in \p dict. Each element of \p dict associates the name of a symbol to a pair \f$\left(n,x\right)\f$,
+     * meaning that the symbol to the power of \f$n\f$ is substituted with \f$x\f$. The substitution is performed
+     * in a single pass over the terms of \p this, and the substituted values are never subject to further
+     * substitutions. The return type is the same as in the substitution of a single symbol, and an empty \p dict
+     * results in a copy of \p this.
+     *
+     * If the substitution affects only the keys and the key type provides an <tt>ipow_subs_split()</tt> method
+     * producing a single key (e.g., piranha::monomial::ipow_subs_split()), the terms are grouped by the powers
+     * they require, the powers of the values are tabulated per symbol and computed only once, and the new terms
+     * are accumulated as explained in piranha::substitutable_series::subs(). If the substitution affects only the
+     * coefficients and it does not change their type, the coefficients are substituted in parallel. In the other
+     * cases, the terms are processed in parallel blocks.
+     *
+     * @param[in] dict dictionary associating the names of the symbols to be substituted to the integral powers
+     * and the values of the substitution.
+     *
+     * @return the result of the simultaneous substitution.
+     *
+     * @throws unspecified any exception resulting from:
+     * - the substitution routines for the coefficients and/or keys,
+     * - the computation of the return value,
+     * - memory errors in standard containers,
+     * - piranha::series::insert(),
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back().
+     */
+    template <typename T>
+    ipow_subs_dict_type<T> ipow_subs(const std::unordered_map<std::string, std::pair<integer, T>> &dict) const
+    {
+        if (dict.empty()) {
+            ipow_subs_dict_type<T> retval(0);
+            retval += *static_cast<Derived const *>(this);
+            return retval;
+        }
+        return ipow_subs_dict_impl(dict);
+    }
 };
 
 namespace detail
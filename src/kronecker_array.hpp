@@ -32,6 +32,7 @@ see https://www.gnu.org/licenses/. */
 #include <algorithm>
 #include <boost/numeric/conversion/cast.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <limits>
 #include <numeric>
@@ -44,6 +45,7 @@ see https://www.gnu.org/licenses/. */
 #include "config.hpp"
 #include "exceptions.hpp"
 #include "mp_integer.hpp"
+#include "thread_pool.hpp"
 #include "type_traits.hpp"
 
 namespace piranha
@@ -52,9 +54,155 @@ namespace piranha
 namespace detail
 {
 
+// Detect the 128-bit signed integer type.
+template <typename T>
+struct ka_is_int128 : std::false_type {
+};
+
+#if defined(PIRANHA_INT128_T)
+
+template <>
+struct ka_is_int128<PIRANHA_INT128_T> : std::true_type {
+};
+
+#endif
+
 // Type requirement for Kronecker array.
 template <typename T>
-using ka_type_reqs = std::integral_constant<bool, std::is_integral<T>::value && std::is_signed<T>::value>;
+using ka_type_reqs = std::integral_constant<bool, (std::is_integral<T>::value && std::is_signed<T>::value)
+                                                      || ka_is_int128<T>::value>;
+
+// Conversions between piranha::integer and the types supported by kronecker_array. These are needed
+// because piranha::integer does not interoperate with the 128-bit integer type. As for the conversion
+// operator of piranha::integer, std::overflow_error is thrown if the value is not representable.
+template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+inline T ka_integer_cast(const integer &n)
+{
+    return static_cast<T>(n);
+}
+
+template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+inline integer ka_to_integer(const T &n)
+{
+    return integer(n);
+}
+
+#if defined(PIRANHA_INT128_T)
+
+// 2**64 as an integer.
+inline integer ka_two_64()
+{
+    const integer two_32(std::uint_least64_t(1) << 32u);
+    return two_32 * two_32;
+}
+
+template <typename T, typename std::enable_if<ka_is_int128<T>::value, int>::type = 0>
+inline T ka_integer_cast(const integer &n)
+{
+    static_assert(std::numeric_limits<T>::digits == 127, "Invalid number of bits.");
+    const integer two_64 = ka_two_64(), two_128 = two_64 * two_64, two_127 = two_128 / 2;
+    if (unlikely(n >= two_127 || n < -two_127)) {
+        piranha_throw(std::overflow_error, "the input integer is not representable as a 128-bit integer");
+    }
+    // Work on the two's complement representation of n.
+    const integer u = (n.sign() < 0) ? integer(n + two_128) : n;
+    const auto hi = static_cast<std::uint_least64_t>(u / two_64), lo = static_cast<std::uint_least64_t>(u % two_64);
+    // NOTE: the conversion of the out-of-range values of the unsigned type is modular on the compilers
+    // supporting the 128-bit integer.
+    return static_cast<T>((static_cast<PIRANHA_UINT128_T>(hi) << 64u) + lo);
+}
+
+template <typename T, typename std::enable_if<ka_is_int128<T>::value, int>::type = 0>
+inline integer ka_to_integer(const T &n)
+{
+    const auto u = static_cast<PIRANHA_UINT128_T>(n);
+    integer retval = ka_two_64() * integer(static_cast<std::uint_least64_t>(u >> 64u))
+                     + integer(static_cast<std::uint_least64_t>(u));
+    if (n < T(0)) {
+        retval -= ka_two_64() * ka_two_64();
+    }
+    return retval;
+}
+
+#endif
+
+// Unsigned integral type with at least twice the bits of the unsigned counterpart of T, if available.
+template <typename T, typename = void>
+struct ka_double_width {
+};
+
+template <typename T>
+struct ka_double_width<T, typename std::enable_if<(std::numeric_limits<T>::digits < 32)>::type> {
+    using type = std::uint_least64_t;
+};
+
+#if defined(PIRANHA_UINT128_T)
+
+template <typename T>
+struct ka_double_width<T, typename std::enable_if<(std::numeric_limits<T>::digits >= 32
+                                                   && std::numeric_limits<T>::digits < 64)>::type> {
+    using type = PIRANHA_UINT128_T;
+};
+
+#endif
+
+template <typename T, typename = void>
+struct ka_has_double_width : std::false_type {
+};
+
+template <typename T>
+struct ka_has_double_width<T, typename std::enable_if<true_tt<typename ka_double_width<T>::type>::value>::type>
+    : std::true_type {
+};
+
+// Division of non-negative values of the signed integral type T by a fixed positive divisor.
+// This is the fallback implementation using the division operator.
+template <typename T, typename = void>
+struct ka_divider {
+    explicit ka_divider(const T &d) : m_d(d)
+    {
+        piranha_assert(d > T(0));
+    }
+    T divide(const T &n) const
+    {
+        piranha_assert(n >= T(0));
+        return static_cast<T>(n / m_d);
+    }
+    T m_d;
+};
+
+// Implementation via multiplication by a precomputed reciprocal followed by a shift. See:
+// T. Granlund and P. L. Montgomery, "Division by invariant integers using multiplication", PLDI 1994.
+// Here we need to divide only values in the [0, 2**k) range, where k is the number of value bits of T.
+// With l = ceil(log2(d)), the magic number m = ceil(2**(k + l) / d) is less than 2**(k + 1) and
+// floor(n * m / 2**(k + l)) == floor(n / d) for all n in the range.
+template <typename T>
+struct ka_divider<T, typename std::enable_if<ka_has_double_width<T>::value>::type> {
+    using w_type = typename ka_double_width<T>::type;
+    static const unsigned k = static_cast<unsigned>(std::numeric_limits<T>::digits);
+    explicit ka_divider(const T &d) : m_d(d)
+    {
+        piranha_assert(d > T(0));
+        unsigned l = 0u;
+        while ((w_type(1) << l) < static_cast<w_type>(d)) {
+            ++l;
+        }
+        m_shift = k + l;
+        const w_type p = w_type(1) << m_shift;
+        m_mult = static_cast<w_type>((p + static_cast<w_type>(d) - 1u) / static_cast<w_type>(d));
+    }
+    T divide(const T &n) const
+    {
+        piranha_assert(n >= T(0));
+        return static_cast<T>((static_cast<w_type>(n) * m_mult) >> m_shift);
+    }
+    T m_d;
+    w_type m_mult;
+    unsigned m_shift;
+};
+
+template <typename T>
+const unsigned ka_divider<T, typename std::enable_if<ka_has_double_width<T>::value>::type>::k;
 }
 
 /// Kronecker array.
@@ -70,7 +218,9 @@ using ka_type_reqs = std::integral_constant<bool, std::is_integral<T>::value &&
  *
  * ## Type requirements ##
  *
- * \p SignedInteger must be a C++ signed integral type.
+ * \p SignedInteger must be a C++ signed integral type or, if supported by the compiler, the 128-bit signed integer
+ * type (\p __int128_t in GCC and Clang). With the 128-bit type, the dimension of the vectors that can be encoded
+ * and the bounds on the components are substantially larger than with the 64-bit integral types.
  *
  * ## Exception safety guarantee ##
  *
@@ -80,8 +230,6 @@ using ka_type_reqs = std::integral_constant<bool, std::is_integral<T>::value &&
  *
  * This class does not have any non-static data members, hence it has trivial move semantics.
  */
-// NOTE: we should optimise the decodification with only one element, there should be no need to do divisions
-// and modulo operations.
 template <typename SignedInteger>
 class kronecker_array
 {
@@ -110,13 +258,26 @@ public:
     typedef std::size_t size_type;
 
 private:
-    // Static vector of limits built at startup.
+    // Divider used in the decodification.
+    using divider_type = detail::ka_divider<int_type>;
+    // Static data built at startup:
+    // - the vector of limits,
+    // - for each vector size, the dividers for the components of the vector (the last component
+    //   does not need a divider),
+    // - for each vector size, the coding vector.
+    // NOTE: these are kept in a single object as the order of initialisation of the static data members
+    // of a class template is unspecified.
+    struct static_data {
+        limits_type m_limits;
+        std::vector<std::vector<divider_type>> m_dividers;
+        std::vector<std::vector<int_type>> m_coding;
+    };
     // NOTE: here we should not have problems when interoperating with libraries that modify the GMP allocation
     // functions,
     // as we do not store any static piranha::integer: the creation and destruction of integer objects is confined to
     // the determine_limit()
     // function.
-    static const limits_type m_limits;
+    static const static_data s_data;
     // Determine limits for m-dimensional vectors.
     // NOTE: when reasoning about this, keep in mind that this is not a completely generic
     // codification: min/max vectors are negative/positive and symmetric. This makes it easy
@@ -155,13 +316,13 @@ private:
             piranha_assert(diff >= 0);
             try {
                 // Try to cast everything to hardware integers.
-                (void)static_cast<int_type>(h_min);
-                (void)static_cast<int_type>(h_max);
+                (void)detail::ka_integer_cast<int_type>(h_min);
+                (void)detail::ka_integer_cast<int_type>(h_max);
                 // Here it is +1 because h_max - h_min must be strictly less than the maximum value
                 // of int_type. In the paper, in eq. (7), the Delta_i product appearing in the
                 // decoding of the last component of a vector is equal to (h_max - h_min + 1) so we need
                 // to be able to represent it.
-                (void)static_cast<int_type>(diff + 1);
+                (void)detail::ka_integer_cast<int_type>(diff + 1);
                 // NOTE: we do not need to cast the individual elements of m/M vecs, as the representability
                 // of h_min/max ensures the representability of m/M as well.
             } catch (const std::overflow_error &) {
@@ -171,9 +332,10 @@ private:
                     h_min = dot_prod(prev_c_vec, prev_m_vec);
                     h_max = dot_prod(prev_c_vec, prev_M_vec);
                     std::transform(prev_M_vec.begin(), prev_M_vec.end(), std::back_inserter(tmp),
-                                   [](const integer &n) { return static_cast<int_type>(n); });
-                    return std::make_tuple(tmp, static_cast<int_type>(h_min), static_cast<int_type>(h_max),
-                                           static_cast<int_type>(h_max - h_min));
+                                   [](const integer &n) { return detail::ka_integer_cast<int_type>(n); });
+                    return std::make_tuple(tmp, detail::ka_integer_cast<int_type>(h_min),
+                                           detail::ka_integer_cast<int_type>(h_max),
+                                           detail::ka_integer_cast<int_type>(h_max - h_min));
                 } else {
                     // Here it means m variables are too many, and we stopped at the first iteration
                     // of the cycle. Return tuple filled with zeroes.
@@ -224,6 +386,104 @@ private:
         }
         return retval;
     }
+    static static_data determine_static_data()
+    {
+        static_data retval;
+        retval.m_limits = determine_limits();
+        for (const auto &limit : retval.m_limits) {
+            const auto &minmax_vec = std::get<0u>(limit);
+            std::vector<divider_type> dividers;
+            std::vector<int_type> coding;
+            int_type cur_c(1);
+            for (decltype(minmax_vec.size()) i = 0u; i < minmax_vec.size(); ++i) {
+                piranha_assert(minmax_vec[i] > 0);
+                const auto delta = static_cast<int_type>(2 * minmax_vec[i] + 1);
+                if (i + 1u != minmax_vec.size()) {
+                    dividers.emplace_back(delta);
+                }
+                coding.push_back(cur_c);
+                // NOTE: the product of all the deltas is h_max - h_min + 1, which is representable.
+                cur_c = static_cast<int_type>(cur_c * delta);
+            }
+            retval.m_dividers.push_back(std::move(dividers));
+            retval.m_coding.push_back(std::move(coding));
+        }
+        return retval;
+    }
+    // Encode the m values starting at position offset in v, without checking m.
+    template <typename Vector>
+    static int_type encode_impl(const Vector &v, const std::size_t &offset, const size_type &m)
+    {
+        piranha_assert(m > 0u && m < s_data.m_limits.size());
+        const auto &limit = s_data.m_limits[m];
+        const auto &minmax_vec = std::get<0u>(limit);
+        const auto &coding = s_data.m_coding[m];
+        using v_size_type = typename Vector::size_type;
+        int_type retval(0);
+        for (size_type i = 0u; i < m; ++i) {
+            const auto tmp = boost::numeric_cast<int_type>(v[static_cast<v_size_type>(offset + i)]);
+            // Check that the vector's components are compatible with the limits.
+            if (unlikely(tmp < -minmax_vec[i] || tmp > minmax_vec[i])) {
+                piranha_throw(std::invalid_argument, "a component of the vector to be encoded is out of bounds");
+            }
+            retval = static_cast<int_type>(retval + (tmp + minmax_vec[i]) * coding[i]);
+        }
+        piranha_assert(retval >= 0);
+        return static_cast<int_type>(retval + std::get<1u>(limit));
+    }
+    // Decode n into the m values starting at position offset in retval, without checking m.
+    template <typename VType, typename Vector>
+    static void decode_impl(Vector &retval, const std::size_t &offset, const int_type &n, const size_type &m)
+    {
+        piranha_assert(m > 0u && m < s_data.m_limits.size());
+        const auto &limit = s_data.m_limits[m];
+        const auto &minmax_vec = std::get<0u>(limit);
+        const auto &dividers = s_data.m_dividers[m];
+        const auto hmin = std::get<1u>(limit), hmax = std::get<2u>(limit);
+        if (unlikely(n < hmin || n > hmax)) {
+            piranha_throw(std::invalid_argument, "the integer to be decoded is out of bounds");
+        }
+        // NOTE: the static_cast here is useful when working with int_type == char. In that case,
+        // the binary operation on the RHS produces an int (due to integer promotion rules), which gets
+        // assigned back to char causing the compiler to complain about potentially lossy conversion.
+        int_type code = static_cast<int_type>(n - hmin);
+        piranha_assert(code >= 0);
+        using v_size_type = typename Vector::size_type;
+        // Extract the components one by one as the digits of code in the mixed radix given by the deltas.
+        for (size_type i = 0u; i < m - 1u; ++i) {
+            const int_type q = dividers[i].divide(code);
+            retval[static_cast<v_size_type>(offset + i)]
+                = boost::numeric_cast<VType>(code - q * dividers[i].m_d - minmax_vec[i]);
+            code = q;
+        }
+        // The last component does not need any division, as code is now less than the last delta.
+        retval[static_cast<v_size_type>(offset + m - 1u)] = boost::numeric_cast<VType>(code - minmax_vec[m - 1u]);
+    }
+    // Run f(begin, end) on n_threads sub-ranges of [0, size).
+    template <typename F>
+    static void parallel_apply(unsigned n_threads, const std::size_t &size, const F &f)
+    {
+        if (unlikely(n_threads == 0u)) {
+            piranha_throw(std::invalid_argument, "invalid number of threads");
+        }
+        if (n_threads == 1u || size < n_threads) {
+            f(std::size_t(0u), size);
+            return;
+        }
+        const std::size_t block_size = size / n_threads;
+        future_list<decltype(f(std::size_t(0u), std::size_t(0u)))> ff_list;
+        try {
+            for (unsigned i = 0u; i < n_threads; ++i) {
+                const std::size_t b = i * block_size, e = (i == n_threads - 1u) ? size : (i + 1u) * block_size;
+                ff_list.push_back(thread_pool::enqueue(i, f, b, e));
+            }
+            ff_list.wait_all();
+            ff_list.get_all();
+        } catch (...) {
+            ff_list.wait_all();
+            throw;
+        }
+    }
 
 public:
     /// Get the limits of the Kronecker codification.
@@ -250,7 +510,7 @@ public:
      */
     static const limits_type &get_limits()
     {
-        return m_limits;
+        return s_data.m_limits;
     }
     /// Encode vector.
     /**
@@ -279,33 +539,13 @@ public:
         const auto size = v.size();
         // NOTE: here the check is >= because indices in the limits vector correspond to the sizes of the vectors to be
         // encoded.
-        if (unlikely(size >= m_limits.size())) {
+        if (unlikely(size >= s_data.m_limits.size())) {
             piranha_throw(std::invalid_argument, "size of vector to be encoded is too large");
         }
         if (unlikely(!size)) {
             return int_type(0);
         }
-        // Cache quantities.
-        const auto &limit = m_limits[size];
-        const auto &minmax_vec = std::get<0u>(limit);
-        // Check that the vector's components are compatible with the limits.
-        // NOTE: here size is not greater than m_limits.size(), which in turn is compatible with the minmax vectors.
-        for (min_int<decltype(v.size()), decltype(minmax_vec.size())> i = 0u; i < size; ++i) {
-            if (unlikely(boost::numeric_cast<int_type>(v[i]) < -minmax_vec[i]
-                         || boost::numeric_cast<int_type>(v[i]) > minmax_vec[i])) {
-                piranha_throw(std::invalid_argument, "a component of the vector to be encoded is out of bounds");
-            }
-        }
-        piranha_assert(minmax_vec[0u] > 0);
-        int_type retval = static_cast<int_type>(boost::numeric_cast<int_type>(v[0u]) + minmax_vec[0u]),
-                 cur_c = static_cast<int_type>(2 * minmax_vec[0u] + 1);
-        piranha_assert(retval >= 0);
-        for (decltype(v.size()) i = 1u; i < size; ++i) {
-            retval = static_cast<int_type>(retval + ((boost::numeric_cast<int_type>(v[i]) + minmax_vec[i]) * cur_c));
-            piranha_assert(minmax_vec[i] > 0);
-            cur_c = static_cast<int_type>(cur_c * (2 * minmax_vec[i] + 1));
-        }
-        return static_cast<int_type>(retval + std::get<1u>(limit));
+        return encode_impl(v, 0u, static_cast<size_type>(size));
     }
     /// Decode into vector.
     /**
@@ -334,7 +574,7 @@ public:
     {
         typedef typename Vector::value_type v_type;
         const auto m = retval.size();
-        if (unlikely(m >= m_limits.size())) {
+        if (unlikely(m >= s_data.m_limits.size())) {
             piranha_throw(std::invalid_argument, "size of vector to be decoded is too large");
         }
         if (unlikely(!m)) {
@@ -343,35 +583,107 @@ public:
             }
             return;
         }
-        // Cache values.
-        const auto &limit = m_limits[m];
-        const auto &minmax_vec = std::get<0u>(limit);
-        const auto hmin = std::get<1u>(limit), hmax = std::get<2u>(limit);
-        if (unlikely(n < hmin || n > hmax)) {
-            piranha_throw(std::invalid_argument, "the integer to be decoded is out of bounds");
+        decode_impl<v_type>(retval, 0u, n, static_cast<size_type>(m));
+    }
+    /// Encode a range of vectors.
+    /**
+     * \note
+     * This method is enabled only if \p T is an integral type or the 128-bit integer type.
+     *
+     * The vectors to be encoded are stored contiguously in \p v: the components of the <tt>i</tt>-th vector
+     * are the elements of \p v from index <tt>i * m</tt> to index <tt>(i + 1) * m</tt> (excluded). The codes will be
+     * written into \p retval, which will be resized to <tt>v.size() / m</tt>. The operation is equivalent to calling
+     * encode() on each vector, and it can be run in parallel using \p n_threads threads from piranha::thread_pool.
+     *
+     * In case of exceptions, \p retval will be left in a valid but undefined state.
+     *
+     * @param[out] retval the output codes.
+     * @param[in] v the vectors to be encoded.
+     * @param[in] m the size of each vector.
+     * @param[in] n_threads the number of threads to be used.
+     *
+     * @throws std::invalid_argument if any of these conditions hold:
+     * - \p n_threads or \p m is zero,
+     * - \p m is equal to or greater than the size of the output of get_limits(),
+     * - the size of \p v is not a multiple of \p m,
+     * - one of the components of the vectors is outside the bounds reported by get_limits().
+     * @throws unspecified any exception thrown by:
+     * - memory errors in standard containers,
+     * - <tt>boost::numeric_cast</tt>, if \p T is not \p SignedInteger,
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back().
+     */
+    template <typename T, typename std::enable_if<std::is_integral<T>::value || detail::ka_is_int128<T>::value,
+                                                  int>::type
+                          = 0>
+    static void encode_range(std::vector<int_type> &retval, const std::vector<T> &v, const size_type &m,
+                             unsigned n_threads = 1u)
+    {
+        if (unlikely(!m || m >= s_data.m_limits.size())) {
+            piranha_throw(std::invalid_argument, "invalid size for the vectors to be encoded");
         }
-        // NOTE: the static_cast here is useful when working with int_type == char. In that case,
-        // the binary operation on the RHS produces an int (due to integer promotion rules), which gets
-        // assigned back to char causing the compiler to complain about potentially lossy conversion.
-        const int_type code = static_cast<int_type>(n - hmin);
-        piranha_assert(code >= 0);
-        piranha_assert(minmax_vec[0u] > 0);
-        int_type mod_arg = static_cast<int_type>(2 * minmax_vec[0u] + 1);
-        // Do the first value manually.
-        retval[0u] = boost::numeric_cast<v_type>((code % mod_arg) - minmax_vec[0u]);
-        for (min_int<typename Vector::size_type, decltype(minmax_vec.size())> i = 1u; i < m; ++i) {
-            piranha_assert(minmax_vec[i] > 0);
-            retval[i]
-                = boost::numeric_cast<v_type>((code % (mod_arg * (2 * minmax_vec[i] + 1))) / mod_arg - minmax_vec[i]);
-            mod_arg = static_cast<int_type>(mod_arg * (2 * minmax_vec[i] + 1));
+        if (unlikely(v.size() % m)) {
+            piranha_throw(std::invalid_argument, "the size of the input range is not a multiple of the vector size");
+        }
+        retval.resize(static_cast<decltype(retval.size())>(v.size() / m));
+        parallel_apply(n_threads, retval.size(), [&retval, &v, &m](const std::size_t &b, const std::size_t &e) {
+            for (auto i = b; i < e; ++i) {
+                retval[i] = encode_impl(v, i * m, m);
+            }
+        });
+    }
+    /// Decode a range of codes.
+    /**
+     * \note
+     * This method is enabled only if \p T is an integral type or the 128-bit integer type.
+     *
+     * Decode the codes in \p c as vectors of size \p m, and store them contiguously in \p retval: the components
+     * of the <tt>i</tt>-th decoded vector will be the elements of \p retval from index <tt>i * m</tt> to index
+     * <tt>(i + 1) * m</tt> (excluded). \p retval will be resized to <tt>c.size() * m</tt>. The operation is equivalent
+     * to calling decode() on each code, and it can be run in parallel using \p n_threads threads from
+     * piranha::thread_pool.
+     *
+     * In case of exceptions, \p retval will be left in a valid but undefined state.
+     *
+     * @param[out] retval the output vectors.
+     * @param[in] c the codes to be decoded.
+     * @param[in] m the size of the decoded vectors.
+     * @param[in] n_threads the number of threads to be used.
+     *
+     * @throws std::invalid_argument if any of these conditions hold:
+     * - \p n_threads or \p m is zero,
+     * - \p m is equal to or greater than the size of the output of get_limits(),
+     * - one of the codes is out of the allowed bounds reported by get_limits().
+     * @throws std::overflow_error if the size of the output range cannot be represented.
+     * @throws unspecified any exception thrown by:
+     * - memory errors in standard containers,
+     * - <tt>boost::numeric_cast</tt>, if \p T is not \p SignedInteger,
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back().
+     */
+    template <typename T, typename std::enable_if<std::is_integral<T>::value || detail::ka_is_int128<T>::value,
+                                                  int>::type
+                          = 0>
+    static void decode_range(std::vector<T> &retval, const std::vector<int_type> &c, const size_type &m,
+                             unsigned n_threads = 1u)
+    {
+        if (unlikely(!m || m >= s_data.m_limits.size())) {
+            piranha_throw(std::invalid_argument, "invalid size for the vectors to be decoded");
         }
+        if (unlikely(c.size() > retval.max_size() / m)) {
+            piranha_throw(std::overflow_error, "the size of the output range is too large");
+        }
+        retval.resize(static_cast<decltype(retval.size())>(c.size() * m));
+        parallel_apply(n_threads, c.size(), [&retval, &c, &m](const std::size_t &b, const std::size_t &e) {
+            for (auto i = b; i < e; ++i) {
+                decode_impl<T>(retval, i * m, c[i], m);
+            }
+        });
     }
 };
 
 // Static initialization.
 template <typename SignedInteger>
-const typename kronecker_array<SignedInteger>::limits_type kronecker_array<SignedInteger>::m_limits
-    = kronecker_array<SignedInteger>::determine_limits();
+const typename kronecker_array<SignedInteger>::static_data kronecker_array<SignedInteger>::s_data
+    = kronecker_array<SignedInteger>::determine_static_data();
 }
 
 #endif
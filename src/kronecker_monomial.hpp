@@ -49,6 +49,7 @@ see https://www.gnu.org/licenses/. */
 #include "config.hpp"
 #include "detail/cf_mult_impl.hpp"
 #include "detail/km_commons.hpp"
+#include "detail/power_table.hpp"
 #include "detail/prepare_for_print.hpp"
 #include "detail/safe_integral_adder.hpp"
 #include "exceptions.hpp"
@@ -70,6 +71,48 @@ see https://www.gnu.org/licenses/. */
 namespace piranha
 {
 
+namespace detail
+{
+
+// Exponent type of a Kronecker monomial with integer type T. The exponents of a Kronecker monomial
+// with 128-bit codes are represented as long long, so that they interoperate with the rest of the library.
+template <typename T>
+struct km_expo_type {
+    using type = T;
+};
+
+#if defined(PIRANHA_INT128_T)
+
+template <>
+struct km_expo_type<PIRANHA_INT128_T> {
+    using type = long long;
+};
+
+#endif
+
+// Serialization of the integer type of a Kronecker monomial.
+template <typename Archive, typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+inline void km_serialize_int(Archive &ar, T &n)
+{
+    ar &n;
+}
+
+#if defined(PIRANHA_INT128_T)
+
+// The 128-bit integer is not supported by Boost.Serialization: it is serialized as two 64-bit halves.
+template <typename Archive, typename T, typename std::enable_if<ka_is_int128<T>::value, int>::type = 0>
+inline void km_serialize_int(Archive &ar, T &n)
+{
+    const auto u = static_cast<PIRANHA_UINT128_T>(n);
+    auto hi = static_cast<unsigned long long>(u >> 64u), lo = static_cast<unsigned long long>(u);
+    ar &hi;
+    ar &lo;
+    n = static_cast<T>((static_cast<PIRANHA_UINT128_T>(hi) << 64u) + lo);
+}
+
+#endif
+}
+
 /// Kronecker monomial class.
 /**
  * This class represents a multivariate monomial with integral exponents.
@@ -85,6 +128,10 @@ namespace piranha
  * \p T must be suitable for use in piranha::kronecker_array. The default type for \p T is the signed counterpart of \p
  * std::size_t.
  *
+ * If \p T is the 128-bit signed integer type, the exponents are represented as <tt>long long</tt> (see
+ * kronecker_monomial::value_type), while the Kronecker codes are 128-bit integers. This allows to use the
+ * packed representation with many more variables and larger exponents than with the 64-bit integral types.
+ *
  * ## Exception safety guarantee ##
  *
  * Unless otherwise specified, this class provides the strong exception safety guarantee for all operations.
@@ -103,11 +150,17 @@ template <typename T = std::make_signed<std::size_t>::type>
 class kronecker_monomial
 {
 public:
-    /// Alias for \p T.
-    typedef T value_type;
+    /// Integer type of the Kronecker code, alias for \p T.
+    typedef T int_type;
+    /// Exponent type.
+    /**
+     * This is an alias for \p T, unless \p T is the 128-bit integer type, in which case this type is
+     * <tt>long long</tt>.
+     */
+    typedef typename detail::km_expo_type<T>::type value_type;
 
 private:
-    typedef kronecker_array<value_type> ka;
+    typedef kronecker_array<int_type> ka;
 
 public:
     /// Size type.
@@ -140,16 +193,20 @@ private:
     // The final typedef.
     template <typename U>
     using eval_type = typename eval_type_<U>::type;
+    // Enabler for the evaluation via power tables.
+    template <typename U>
+    using power_table_enabler = typename std::enable_if<std::is_integral<U>::value, int>::type;
     // Enabler for pow.
     template <typename U>
     using pow_enabler = typename std::
-        enable_if<has_safe_cast<T, decltype(std::declval<integer &&>() * std::declval<const U &>())>::value, int>::type;
+        enable_if<has_safe_cast<value_type, decltype(std::declval<integer &&>() * std::declval<const U &>())>::value,
+                  int>::type;
     // Serialization support.
     friend class boost::serialization::access;
     template <typename Archive>
     void serialize(Archive &ar, unsigned int)
     {
-        ar &m_value;
+        detail::km_serialize_int(ar, m_value);
     }
     // Enabler for multiply().
     template <typename Cf>
@@ -186,7 +243,7 @@ private:
     template <typename U>
     using container_ctor_enabler =
         typename std::enable_if<has_begin_end<const U>::value
-                                    && has_safe_cast<T, typename std::iterator_traits<decltype(
+                                    && has_safe_cast<value_type, typename std::iterator_traits<decltype(
                                                             std::begin(std::declval<const U &>()))>::value_type>::value,
                                 int>::type;
     template <typename U>
@@ -209,7 +266,7 @@ private:
         return tmp.size();
     }
     // Degree utils.
-    using degree_type = decltype(std::declval<const T &>() + std::declval<const T &>());
+    using degree_type = decltype(std::declval<const value_type &>() + std::declval<const value_type &>());
 #endif
 public:
     /// Arity of the multiply() method.
@@ -354,14 +411,14 @@ public:
             piranha_throw(std::invalid_argument, "incompatible arguments");
         }
     }
-    /// Constructor from \p value_type.
+    /// Constructor from \p int_type.
     /**
      * This constructor will initialise the internal integer instance
      * to \p n.
      *
      * @param[in] n initializer for the internal integer instance.
      */
-    explicit kronecker_monomial(const value_type &n) : m_value(n)
+    explicit kronecker_monomial(const int_type &n) : m_value(n)
     {
     }
     /// Trivial destructor.
@@ -380,7 +437,7 @@ public:
     /**
      * @param[in] n value to which the internal integer instance will be set.
      */
-    void set_int(const value_type &n)
+    void set_int(const int_type &n)
     {
         m_value = n;
     }
@@ -388,7 +445,7 @@ public:
     /**
      * @return value of the internal integer instance.
      */
-    value_type get_int() const
+    int_type get_int() const
     {
         return m_value;
     }
@@ -604,6 +661,9 @@ public:
      */
     std::size_t hash() const
     {
+        // NOTE: for integer types wider than std::size_t, this is the code modulo 2**N, where N is the bit
+        // width of std::size_t. The hash thus remains additive (modulo 2**N), a property on which the
+        // task scheduling of the Kronecker polynomial multiplier relies.
         return static_cast<std::size_t>(m_value);
     }
     /// Equality operator.
@@ -792,7 +852,7 @@ public:
      * - piranha::math::is_zero(),
      * - piranha::kronecker_array::encode().
      */
-    std::pair<T, kronecker_monomial> partial(const symbol_set::positions &p, const symbol_set &args) const
+    std::pair<value_type, kronecker_monomial> partial(const symbol_set::positions &p, const symbol_set &args) const
     {
         auto v = unpack(args);
         // Cannot take derivative wrt more than one variable, and the position of that variable
@@ -805,17 +865,17 @@ public:
         // NOTE: safe to take v.begin() here, as the checks on the positions above ensure
         // there is a valid position and hence the size must be not zero.
         if (!p.size() || math::is_zero(v.begin()[*p.begin()])) {
-            return std::make_pair(T(0), kronecker_monomial(args));
+            return std::make_pair(value_type(0), kronecker_monomial(args));
         }
         auto v_b = v.begin();
         // Original exponent.
-        T n(v_b[*p.begin()]);
+        value_type n(v_b[*p.begin()]);
         // Decrement the exponent in the monomial.
-        if (unlikely(n == std::numeric_limits<T>::min())) {
+        if (unlikely(n == std::numeric_limits<value_type>::min())) {
             piranha_throw(std::invalid_argument, "negative overflow error in the calculation of the "
                                                  "partial derivative of a monomial");
         }
-        v_b[*p.begin()] = static_cast<T>(n - T(1));
+        v_b[*p.begin()] = static_cast<value_type>(n - value_type(1));
         kronecker_monomial tmp_km;
         tmp_km.m_value = ka::encode(v);
         return std::make_pair(n, std::move(tmp_km));
@@ -841,7 +901,7 @@ public:
      * - piranha::static_vector::push_back(),
      * - piranha::kronecker_array::encode().
      */
-    std::pair<T, kronecker_monomial> integrate(const symbol &s, const symbol_set &args) const
+    std::pair<value_type, kronecker_monomial> integrate(const symbol &s, const symbol_set &args) const
     {
         v_type v = unpack(args), retval;
         value_type expo(0), one(1);
@@ -920,6 +980,61 @@ public:
         piranha_assert(it == pmap.end());
         return retval;
     }
+    /// Update the bounds of the exponents.
+    /**
+     * \note
+     * This method is enabled only if the exponent type is a C++ integral type.
+     *
+     * The pairs in \p bounds will be updated so that they contain, respectively, lower and upper bounds for the
+     * exponents of \p this. If \p bounds is empty, it will be initialised from the exponents of \p this.
+     * This method is used in series evaluation, together with the evaluation via power tables.
+     *
+     * @param[in,out] bounds the vector of bounds to be updated.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @throws std::invalid_argument if the sizes of \p this, \p args and \p bounds (if not empty) differ.
+     * @throws unspecified any exception thrown by memory errors in standard containers.
+     */
+    template <typename U = value_type, power_table_enabler<U> = 0>
+    void update_exponent_bounds(std::vector<std::pair<U, U>> &bounds, const symbol_set &args) const
+    {
+        if (unlikely(!bounds.empty() && bounds.size() != args.size())) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set or exponent bounds");
+        }
+        const auto v = unpack(args);
+        detail::power_table<U, U>::update_bounds(bounds, v.begin(), v.end());
+    }
+    /// Evaluation via power tables.
+    /**
+     * \note
+     * This method is enabled only if the exponent type is a C++ integral type, and the other requirements
+     * of the evaluation via piranha::symbol_set::positions_map are satisfied.
+     *
+     * This method will return the same value as the evaluation via piranha::symbol_set::positions_map,
+     * but the powers of the evaluation values are read from \p table, which must cover the exponents of \p this.
+     *
+     * @param[in] table the table of the powers of the evaluation values.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the result of evaluating \p this with the powers provided by \p table.
+     *
+     * @throws std::invalid_argument if the sizes of \p this, \p args and \p table differ.
+     * @throws unspecified any exception thrown by
+     * the construction and the in-place multiplication of the return type.
+     */
+    template <typename U, typename V = value_type, power_table_enabler<V> = 0>
+    eval_type<U> evaluate(const detail::power_table<U, V> &table, const symbol_set &args) const
+    {
+        if (unlikely(table.size() != args.size())) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set or power table");
+        }
+        const auto v = unpack(args);
+        eval_type<U> retval(1);
+        for (decltype(args.size()) i = 0u; i < args.size(); ++i) {
+            retval *= table(i, v[static_cast<typename v_type::size_type>(i)]);
+        }
+        return retval;
+    }
     /// Substitution.
     /**
      * \note
@@ -1012,6 +1127,73 @@ public:
         retval.push_back(std::make_pair(std::move(retval_s), kronecker_monomial(ka::encode(new_v))));
         return retval;
     }
+    /// Split for substitution.
+    /**
+     * This method works in the same way as piranha::monomial::subs_split().
+     *
+     * @param[in] s name of the symbol that will be substituted.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the exponent of \p s and the monomial resulting from the substitution of \p s.
+     *
+     * @throws unspecified any exception thrown by:
+     * - unpack(),
+     * - piranha::static_vector::push_back(),
+     * - piranha::kronecker_array::encode().
+     */
+    std::pair<value_type, std::array<kronecker_monomial, 1u>> subs_split(const std::string &s,
+                                                                         const symbol_set &args) const
+    {
+        const auto v = unpack(args);
+        v_type new_v;
+        value_type e(0);
+        for (min_int<typename v_type::size_type, decltype(args.size())> i = 0u; i < args.size(); ++i) {
+            if (args[i].get_name() == s) {
+                e = v[i];
+                new_v.push_back(value_type(0));
+            } else {
+                new_v.push_back(v[i]);
+            }
+        }
+        return std::make_pair(e, std::array<kronecker_monomial, 1u>{{kronecker_monomial(ka::encode(new_v))}});
+    }
+    /// Split for integral power substitution.
+    /**
+     * This method works in the same way as piranha::monomial::ipow_subs_split().
+     *
+     * @param[in] s name of the symbol that will be substituted.
+     * @param[in] n power of \p s that will be substituted.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the power of the substituted quantity and the monomial resulting from the substitution.
+     *
+     * @throws unspecified any exception thrown by:
+     * - unpack(),
+     * - construction of piranha::rational,
+     * - piranha::safe_cast(),
+     * - piranha::static_vector::push_back(),
+     * - the in-place subtraction operator of the exponent type,
+     * - piranha::kronecker_array::encode().
+     */
+    std::pair<integer, std::array<kronecker_monomial, 1u>> ipow_subs_split(const std::string &s, const integer &n,
+                                                                           const symbol_set &args) const
+    {
+        const auto v = unpack(args);
+        v_type new_v;
+        integer q(0);
+        for (min_int<typename v_type::size_type, decltype(args.size())> i = 0u; i < args.size(); ++i) {
+            new_v.push_back(v[i]);
+            if (args[i].get_name() == s) {
+                const rational tmp(safe_cast<integer>(v[i]), n);
+                if (tmp >= 1) {
+                    q = static_cast<integer>(tmp);
+                    new_v[i] -= q * n;
+                }
+            }
+        }
+        return std::make_pair(std::move(q),
+                              std::array<kronecker_monomial, 1u>{{kronecker_monomial(ka::encode(new_v))}});
+    }
     /// Identify symbols that can be trimmed.
     /**
      * This method is used in piranha::series::trim(). The input parameter \p candidates
@@ -1119,7 +1301,7 @@ public:
     }
 
 private:
-    value_type m_value;
+    int_type m_value;
 };
 
 /// Alias for piranha::kronecker_monomial with default type.
@@ -30,6 +30,7 @@ see https://www.gnu.org/licenses/. */
 #define PIRANHA_LAMBDIFY_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -40,9 +41,18 @@ see https://www.gnu.org/licenses/. */
 #include <utility>
 #include <vector>
 
+#include "config.hpp"
+#include "detail/power_table.hpp"
 #include "detail/sfinae_types.hpp"
 #include "exceptions.hpp"
+#include "horner_plan.hpp"
 #include "math.hpp"
+#include "mp_integer.hpp"
+#include "mp_rational.hpp"
+#include "real.hpp"
+#include "series.hpp"
+#include "symbol_set.hpp"
+#include "thread_pool.hpp"
 #include "type_traits.hpp"
 
 namespace piranha
@@ -56,6 +66,239 @@ template <typename T, typename U>
 using math_lambdified_reqs
     = std::integral_constant<bool, is_evaluable<T, U>::value && is_mappable<U>::value
                                        && std::is_copy_constructible<T>::value && std::is_move_constructible<T>::value>;
+
+// Numerical coefficient types, whose evaluation does not depend on the evaluation values.
+template <typename T>
+using lambdified_numerical_cf
+    = std::integral_constant<bool, std::is_arithmetic<T>::value || is_mp_integer<T>::value || is_mp_rational<T>::value
+                                       || std::is_same<T, real>::value>;
+
+// Detect series that can be compiled into a lambdified_program: the coefficients must be numerical
+// and the keys must support the evaluation via power tables.
+template <typename T, typename U, typename = void>
+struct lambdified_program_enabled : std::false_type {
+};
+
+template <typename T, typename U>
+struct lambdified_program_enabled<T, U, typename std::enable_if<is_series<T>::value>::type>
+    : std::integral_constant<bool, lambdified_numerical_cf<typename T::term_type::cf_type>::value
+                                       && key_has_power_table_evaluate<typename T::term_type::key_type, U>::value> {
+};
+
+// Flat representation of an object of type T, used in the batch evaluation of lambdified objects. The default
+// implementation is used for the objects that cannot be compiled, which are evaluated via math::evaluate().
+template <typename T, typename U, typename = void>
+struct lambdified_program {
+    static const bool compilable = false;
+};
+
+template <typename T, typename U, typename Enable>
+const bool lambdified_program<T, U, Enable>::compilable;
+
+// The compiled form of a series consists of the evaluated coefficients and, for each term, of the indices
+// of the powers of the evaluation values in a power table, which is computed for blocks of points. The innermost
+// loops run over the points of a block, so that they can be vectorised by the compiler.
+template <typename T, typename U>
+class lambdified_program<T, U, typename std::enable_if<lambdified_program_enabled<T, U>::value>::type>
+{
+    using term_type = typename T::term_type;
+    using key_type = typename term_type::key_type;
+    using expo_type = typename key_type::value_type;
+    using table_type = power_table<U, expo_type>;
+    using bounds_type = typename table_type::bounds_type;
+    using pow_type = typename table_type::pow_type;
+    using cf_eval_type = decltype(math::evaluate(std::declval<const typename term_type::cf_type &>(),
+                                                 std::declval<const std::unordered_map<std::string, U> &>()));
+    using key_eval_type = decltype(std::declval<const key_type &>().evaluate(std::declval<const table_type &>(),
+                                                                             std::declval<const symbol_set &>()));
+
+public:
+    static const bool compilable = true;
+    // Number of points evaluated together.
+    static const std::size_t block_size = 16u;
+    using eval_type = decltype(
+        math::evaluate(std::declval<const T &>(), std::declval<const std::unordered_map<std::string, U> &>()));
+    // Default constructor: the program is not valid.
+    lambdified_program() : m_n_args(0u), m_n_rows(0u), m_valid(false)
+    {
+    }
+    // Compile x. The evaluation values of the symbols are passed to evaluate() as a vector of columns of values,
+    // one for each symbol in names. If x contains symbols not in names, or if the power tables would be larger than
+    // the number of exponents in x, the program is not valid.
+    explicit lambdified_program(const T &x, const std::vector<std::string> &names)
+        : m_n_args(x.get_symbol_set().size()), m_n_rows(0u), m_valid(false)
+    {
+        const auto &args = x.get_symbol_set();
+        for (const auto &s : args) {
+            const auto it = std::find(names.begin(), names.end(), s.get_name());
+            if (it == names.end()) {
+                return;
+            }
+            m_positions.push_back(static_cast<std::size_t>(it - names.begin()));
+        }
+        for (const auto &t : x._container()) {
+            t.m_key.update_exponent_bounds(m_bounds, args);
+        }
+        if (table_type::table_size(m_bounds) > integer(x.size()) * m_n_args) {
+            return;
+        }
+        std::size_t n_rows = 0u;
+        for (const auto &b : m_bounds) {
+            m_bases.push_back(n_rows);
+            n_rows += static_cast<std::size_t>(b.second - b.first) + 1u;
+        }
+        m_n_rows = n_rows;
+        const std::unordered_map<std::string, U> empty_dict;
+        bounds_type expos;
+        for (const auto &t : x._container()) {
+            m_cfs.push_back(math::evaluate(t.m_cf, empty_dict));
+            // NOTE: the bounds computed from a single key are its exponents.
+            expos.clear();
+            t.m_key.update_exponent_bounds(expos, args);
+            for (std::size_t j = 0u; j < m_n_args; ++j) {
+                m_rows.push_back(m_bases[j] + static_cast<std::size_t>(expos[j].first - m_bounds[j].first));
+            }
+        }
+        m_valid = true;
+    }
+    bool valid() const
+    {
+        return m_valid;
+    }
+    // Number of terms.
+    std::size_t size() const
+    {
+        return m_cfs.size();
+    }
+    // Evaluate a single point. The values of the symbols in names are the elements of values, followed
+    // by the elements of extra.
+    eval_type evaluate(const std::vector<U> &values, const std::vector<U> &extra) const
+    {
+        piranha_assert(m_valid);
+        std::vector<pow_type> table(m_n_rows);
+        // Tabulate the powers of the values of the symbols.
+        for (std::size_t j = 0u; j < m_bounds.size(); ++j) {
+            const auto p = m_positions[j];
+            const U &val = p < values.size() ? values[p] : extra[p - values.size()];
+            auto row = table.begin() + static_cast<std::ptrdiff_t>(m_bases[j]);
+            for (expo_type e = m_bounds[j].first;; ++e, ++row) {
+                *row = math::pow(val, e);
+                if (e == m_bounds[j].second) {
+                    break;
+                }
+            }
+        }
+        // Accumulate the terms, in the same order as in the evaluation of blocks of points.
+        sum_accumulator<eval_type> acc;
+        auto r = m_rows.begin();
+        for (const auto &cf : m_cfs) {
+            key_eval_type prod(1);
+            for (std::size_t j = 0u; j < m_n_args; ++j, ++r) {
+                prod *= table[*r];
+            }
+            acc.multiply_accumulate(cf, prod);
+        }
+        return acc.get();
+    }
+    // Evaluate the points in the range [begin, end) of the columns of values cols, appending the results to out.
+    void evaluate(const std::vector<const U *> &cols, std::size_t begin, std::size_t end,
+                  std::vector<eval_type> &out) const
+    {
+        piranha_assert(m_valid && begin <= end);
+        std::vector<pow_type> table(m_n_rows * block_size);
+        std::vector<key_eval_type> prods(block_size);
+        for (; begin != end;) {
+            const auto nw = std::min(block_size, static_cast<std::size_t>(end - begin));
+            // Tabulate the powers of the values of the symbols.
+            for (std::size_t j = 0u; j < m_bounds.size(); ++j) {
+                const U *col = cols[m_positions[j]] + begin;
+                auto row = table.begin() + static_cast<std::ptrdiff_t>(m_bases[j] * block_size);
+                for (expo_type e = m_bounds[j].first;; ++e, row += static_cast<std::ptrdiff_t>(block_size)) {
+                    for (std::size_t w = 0u; w < nw; ++w) {
+                        row[static_cast<std::ptrdiff_t>(w)] = math::pow(col[w], e);
+                    }
+                    if (e == m_bounds[j].second) {
+                        break;
+                    }
+                }
+            }
+            // Accumulate the terms.
+            std::vector<sum_accumulator<eval_type>> accs(nw);
+            auto r = m_rows.begin();
+            for (const auto &cf : m_cfs) {
+                for (std::size_t w = 0u; w < nw; ++w) {
+                    prods[w] = key_eval_type(1);
+                }
+                for (std::size_t j = 0u; j < m_n_args; ++j, ++r) {
+                    const auto row = table.begin() + static_cast<std::ptrdiff_t>(*r * block_size);
+                    for (std::size_t w = 0u; w < nw; ++w) {
+                        prods[w] *= row[static_cast<std::ptrdiff_t>(w)];
+                    }
+                }
+                for (std::size_t w = 0u; w < nw; ++w) {
+                    accs[w].multiply_accumulate(cf, prods[w]);
+                }
+            }
+            for (auto &acc : accs) {
+                out.push_back(acc.get());
+            }
+            begin += nw;
+        }
+    }
+
+private:
+    std::size_t m_n_args;
+    std::size_t m_n_rows;
+    bool m_valid;
+    std::vector<std::size_t> m_positions;
+    bounds_type m_bounds;
+    std::vector<std::size_t> m_bases;
+    std::vector<cf_eval_type> m_cfs;
+    std::vector<std::size_t> m_rows;
+};
+
+template <typename T, typename U>
+const bool lambdified_program<T, U, typename std::enable_if<lambdified_program_enabled<T, U>::value>::type>::compilable;
+
+template <typename T, typename U>
+const std::size_t
+    lambdified_program<T, U, typename std::enable_if<lambdified_program_enabled<T, U>::value>::type>::block_size;
+
+// Detect if T can be evaluated with values of type U via a horner_plan.
+template <typename T, typename U, typename = void>
+struct lambdified_has_horner : std::false_type {
+};
+
+template <typename T, typename U>
+struct lambdified_has_horner<T, U, typename std::enable_if<horner_plan_enabled<T>::value>::type> {
+    template <typename T1>
+    static auto test(const T1 &h) -> decltype(h.evaluate(std::declval<const std::unordered_map<std::string, U> &>()));
+    static sfinae_types::no test(...);
+    static const bool value
+        = std::is_same<decltype(test(std::declval<const horner_plan<T> &>())),
+                       decltype(math::evaluate(std::declval<const T &>(),
+                                               std::declval<const std::unordered_map<std::string, U> &>()))>::value;
+};
+
+// Detect if the horner_plan of T can be evaluated with a vector of values of type U.
+template <typename T, typename U, typename = void>
+struct lambdified_horner_values : std::false_type {
+};
+
+template <typename T, typename U>
+struct lambdified_horner_values<T, U, typename std::enable_if<lambdified_has_horner<T, U>::value>::type> {
+    template <typename T1>
+    static auto test(const T1 &h) -> decltype(h.evaluate(std::declval<const std::vector<U> &>()));
+    static sfinae_types::no test(...);
+    static const bool value
+        = std::is_same<decltype(test(std::declval<const horner_plan<T> &>())),
+                       decltype(math::evaluate(std::declval<const T &>(),
+                                               std::declval<const std::unordered_map<std::string, U> &>()))>::value;
+};
+
+// Placeholder for the objects that are not evaluated via a horner_plan.
+struct lambdified_no_horner {
+};
 }
 
 namespace math
@@ -66,6 +309,11 @@ namespace math
  * This class exposes a function-like interface for the evaluation of instances of type \p T with objects of type \p U.
  * The class acts as a small wrapper for piranha::math::evaluate() which replaces the interface
  * based on \p std::unordered_map with an interface based on vectors and positional arguments.
+ * The method evaluate_batch() can be used to evaluate the same object at many points: series with numerical
+ * coefficients and integral exponents are compiled upon construction into a flat representation, which is then
+ * evaluated on blocks of points by multiple threads, and which is also used by operator()() for single points.
+ * For series with monomial-like keys, a piranha::horner_plan can be built on request via build_horner_plan(),
+ * and it is then used by operator()().
  *
  * The convenience function piranha::math::lambdify() can be used to easily construct objects of this class.
  *
@@ -90,6 +338,11 @@ class lambdified
     static_assert(std::is_same<T, typename std::decay<T>::type>::value, "Invalid type.");
     static_assert(std::is_same<U, typename std::decay<U>::type>::value, "Invalid type.");
     static_assert(detail::math_lambdified_reqs<T, U>::value, "Invalid types.");
+    using eval_type_ = decltype(
+        math::evaluate(std::declval<const T &>(), std::declval<const std::unordered_map<std::string, U> &>()));
+    using program_type = detail::lambdified_program<T, U>;
+    using horner_type = typename std::conditional<detail::lambdified_has_horner<T, U>::value, horner_plan<T>,
+                                                  detail::lambdified_no_horner>::type;
     // Constructor implementation.
     void construct()
     {
@@ -99,8 +352,7 @@ class lambdified
         if (std::unique(names_copy.begin(), names_copy.end()) != names_copy.end()) {
             piranha_throw(std::invalid_argument, "the list of evaluation symbols contains duplicates");
         }
-        // Fill in the eval dict and the vector of pointers, and make sure
-        // that m_extra_map does not contain anything that is already in m_names.
+        // Make sure that m_extra_map does not contain anything that is already in m_names.
         for (const auto &s : m_names) {
             if (m_extra_map.find(s) != m_extra_map.end()) {
                 piranha_throw(std::invalid_argument,
@@ -108,37 +360,184 @@ class lambdified
                                   + "', which is already in the symbol list used for the construction "
                                     "of the lambdified object");
             }
-            const auto ret = m_eval_dict.emplace(std::make_pair(s, U{}));
-            piranha_assert(ret.second);
-            m_ptrs.push_back(std::addressof(ret.first->second));
         }
-        // Fill in the extra symbols.
+        // Establish the order in which the symbols in the extra map are evaluated.
         for (const auto &p : m_extra_map) {
-            const auto ret = m_eval_dict.emplace(std::make_pair(p.first, U{}));
-            piranha_assert(ret.second);
-            m_ptrs.push_back(std::addressof(ret.first->second));
+            m_extra_names.push_back(p.first);
         }
+        compile();
+    }
+    // Compile m_x for batch evaluation, if possible.
+    template <typename P = program_type, typename std::enable_if<P::compilable, int>::type = 0>
+    void compile()
+    {
+        auto all_names(m_names);
+        all_names.insert(all_names.end(), m_extra_names.begin(), m_extra_names.end());
+        m_program = program_type(m_x, all_names);
     }
-    // Reconstruct the vector of pointers following copy or move construction.
-    void reconstruct_ptrs()
+    template <typename P = program_type, typename std::enable_if<!P::compilable, int>::type = 0>
+    void compile()
     {
-        // m_ptrs must be empty because we assume this method is called only as part of
-        // the copy/move ctors.
-        piranha_assert(m_ptrs.empty());
-        piranha_assert(m_eval_dict.size() >= m_extra_map.size()
-                       && m_names.size() == m_eval_dict.size() - m_extra_map.size());
-        // Take care first of the positional argument.
+    }
+    // Evaluate the points in the range [begin, end) of the columns of values cols one by one via evaluate_dict(),
+    // appending the results to out. The columns contain the values of the symbols in m_names, followed by the values
+    // of the symbols in m_extra_names. The dictionary is built only once, and its values are then overwritten
+    // for each point.
+    void evaluate_points(const std::vector<const U *> &cols, std::size_t begin, std::size_t end,
+                         std::vector<eval_type_> &out) const
+    {
+        piranha_assert(cols.size() == m_names.size() + m_extra_names.size());
+        if (begin == end) {
+            return;
+        }
+        std::unordered_map<std::string, U> dict;
+        std::vector<U *> slots;
+        auto it = cols.begin();
         for (const auto &s : m_names) {
-            piranha_assert(m_eval_dict.count(s) == 1u);
-            m_ptrs.push_back(std::addressof(m_eval_dict.find(s)->second));
+            slots.push_back(std::addressof(dict.emplace(s, (*it)[begin]).first->second));
+            ++it;
         }
-        // The extra symbols.
-        for (const auto &p : m_extra_map) {
-            piranha_assert(m_eval_dict.count(p.first) == 1u);
-            m_ptrs.push_back(std::addressof(m_eval_dict.find(p.first)->second));
+        for (const auto &s : m_extra_names) {
+            slots.push_back(std::addressof(dict.emplace(s, (*it)[begin]).first->second));
+            ++it;
+        }
+        for (; begin != end; ++begin) {
+            for (std::size_t j = 0u; j < slots.size(); ++j) {
+                *slots[j] = cols[j][begin];
+            }
+            out.push_back(evaluate_dict(dict));
+        }
+    }
+    // Evaluate a single point. The values of the symbols in m_names are the elements of values, followed by
+    // the values of the symbols in m_extra_names in extra. The Horner plan, if built, takes precedence
+    // over the compiled program.
+    template <typename H = horner_type,
+              typename std::enable_if<std::is_same<H, horner_plan<T>>::value, int>::type = 0>
+    eval_type_ evaluate_values(const std::vector<U> &values, const std::vector<U> &extra) const
+    {
+        if (m_horner) {
+            return evaluate_values_horner(values, extra);
+        }
+        return evaluate_values_program(values, extra);
+    }
+    template <typename H = horner_type,
+              typename std::enable_if<!std::is_same<H, horner_plan<T>>::value, int>::type = 0>
+    eval_type_ evaluate_values(const std::vector<U> &values, const std::vector<U> &extra) const
+    {
+        return evaluate_values_program(values, extra);
+    }
+    // NOTE: the positions of the symbols of the plan are computed only if the plan can be evaluated
+    // with a vector of values and if all its symbols are available.
+    template <typename T1 = T, typename std::enable_if<detail::lambdified_horner_values<T1, U>::value, int>::type = 0>
+    eval_type_ evaluate_values_horner(const std::vector<U> &values, const std::vector<U> &extra) const
+    {
+        if (m_horner_positions.size() != m_x.get_symbol_set().size()) {
+            return evaluate_values_dict(values, extra);
         }
-        // Make sure the sizes are consistent.
-        piranha_assert(m_ptrs.size() == static_cast<decltype(m_ptrs.size())>(m_names.size()) + m_extra_map.size());
+        std::vector<U> args;
+        args.reserve(m_horner_positions.size());
+        for (const auto &p : m_horner_positions) {
+            args.push_back(p < values.size() ? values[p] : extra[p - values.size()]);
+        }
+        return m_horner->evaluate(args);
+    }
+    template <typename T1 = T, typename std::enable_if<!detail::lambdified_horner_values<T1, U>::value, int>::type = 0>
+    eval_type_ evaluate_values_horner(const std::vector<U> &values, const std::vector<U> &extra) const
+    {
+        return evaluate_values_dict(values, extra);
+    }
+    template <typename P = program_type, typename std::enable_if<P::compilable, int>::type = 0>
+    eval_type_ evaluate_values_program(const std::vector<U> &values, const std::vector<U> &extra) const
+    {
+        if (m_program.valid()) {
+            return m_program.evaluate(values, extra);
+        }
+        return evaluate_values_dict(values, extra);
+    }
+    template <typename P = program_type, typename std::enable_if<!P::compilable, int>::type = 0>
+    eval_type_ evaluate_values_program(const std::vector<U> &values, const std::vector<U> &extra) const
+    {
+        return evaluate_values_dict(values, extra);
+    }
+    // Positions of the symbols of the Horner plan in the list formed by m_names followed by m_extra_names.
+    template <typename T1 = T, typename std::enable_if<detail::lambdified_horner_values<T1, U>::value, int>::type = 0>
+    std::vector<std::size_t> horner_positions() const
+    {
+        std::vector<std::size_t> retval;
+        for (const auto &s : m_x.get_symbol_set()) {
+            auto it = std::find(m_names.begin(), m_names.end(), s.get_name());
+            if (it != m_names.end()) {
+                retval.push_back(static_cast<std::size_t>(it - m_names.begin()));
+                continue;
+            }
+            it = std::find(m_extra_names.begin(), m_extra_names.end(), s.get_name());
+            if (it == m_extra_names.end()) {
+                // Missing symbol: the evaluation will go through the dictionary, which will raise an error.
+                return std::vector<std::size_t>{};
+            }
+            retval.push_back(m_names.size() + static_cast<std::size_t>(it - m_extra_names.begin()));
+        }
+        return retval;
+    }
+    template <typename T1 = T, typename std::enable_if<!detail::lambdified_horner_values<T1, U>::value, int>::type = 0>
+    std::vector<std::size_t> horner_positions() const
+    {
+        return std::vector<std::size_t>{};
+    }
+    eval_type_ evaluate_values_dict(const std::vector<U> &values, const std::vector<U> &extra) const
+    {
+        std::unordered_map<std::string, U> dict;
+        for (std::size_t i = 0u; i < values.size(); ++i) {
+            dict.emplace(m_names[i], values[i]);
+        }
+        for (std::size_t i = 0u; i < extra.size(); ++i) {
+            dict.emplace(m_extra_names[i], extra[i]);
+        }
+        return evaluate_dict(dict);
+    }
+    template <typename H = horner_type,
+              typename std::enable_if<std::is_same<H, horner_plan<T>>::value, int>::type = 0>
+    eval_type_ evaluate_dict(const std::unordered_map<std::string, U> &dict) const
+    {
+        if (m_horner) {
+            return m_horner->evaluate(dict);
+        }
+        return math::evaluate(m_x, dict);
+    }
+    template <typename H = horner_type,
+              typename std::enable_if<!std::is_same<H, horner_plan<T>>::value, int>::type = 0>
+    eval_type_ evaluate_dict(const std::unordered_map<std::string, U> &dict) const
+    {
+        return math::evaluate(m_x, dict);
+    }
+    // Evaluate the points in the range [begin, end) of the columns of values cols, appending the results to out.
+    template <typename P = program_type, typename std::enable_if<P::compilable, int>::type = 0>
+    void evaluate_range(const std::vector<const U *> &cols, std::size_t begin, std::size_t end,
+                        std::vector<eval_type_> &out) const
+    {
+        if (m_program.valid()) {
+            m_program.evaluate(cols, begin, end, out);
+            return;
+        }
+        evaluate_points(cols, begin, end, out);
+    }
+    template <typename P = program_type, typename std::enable_if<!P::compilable, int>::type = 0>
+    void evaluate_range(const std::vector<const U *> &cols, std::size_t begin, std::size_t end,
+                        std::vector<eval_type_> &out) const
+    {
+        evaluate_points(cols, begin, end, out);
+    }
+    // Minimum number of points per thread in batch evaluation.
+    template <typename P = program_type, typename std::enable_if<P::compilable, int>::type = 0>
+    std::size_t min_points_per_thread() const
+    {
+        return m_program.valid() ? std::max(std::size_t(1u), std::size_t(100000u) / (m_program.size() + 1u))
+                                 : std::size_t(100u);
+    }
+    template <typename P = program_type, typename std::enable_if<!P::compilable, int>::type = 0>
+    std::size_t min_points_per_thread() const
+    {
+        return 100u;
     }
 
 public:
@@ -147,8 +546,7 @@ public:
      * This is the type resulting from evaluating objects of type \p T with objects of type \p U
      * via piranha::math::evaluate().
      */
-    using eval_type = decltype(
-        math::evaluate(std::declval<const T &>(), std::declval<const std::unordered_map<std::string, U> &>()));
+    using eval_type = eval_type_;
     /// The map type for the custom evaluation of symbols.
     /**
      * See the constructor documentation for an explanation of how this type is used.
@@ -173,6 +571,10 @@ public:
      * value for \p s in the subsequent call to math::evaluate(). \p extra_map must not contain symbol names appearing
      * in \p names.
      *
+     * If \p x is a series with numerical coefficients whose keys support the evaluation via power tables
+     * (e.g., a polynomial with integral exponents), \p x is also compiled into the flat representation
+     * used by evaluate_batch().
+     *
      * @param[in] x the object that will be evaluated by operator()().
      * @param[in] names the list of symbols to which the values passed to operator()() will be mapped.
      * @param[in] extra_map the custom symbol evaluation map.
@@ -183,7 +585,8 @@ public:
      * - memory errors in standard containers,
      * - the public interface of std::unordered_map,
      * - the copy constructor of \p T,
-     * - the construction of objects of type \p U.
+     * - the compilation of \p x for batch evaluation, which requires the evaluation of the coefficients
+     *   and the extraction of the exponents of the keys of \p x.
      */
     explicit lambdified(const T &x, const std::vector<std::string> &names, extra_map_type extra_map = extra_map_type{})
         : m_x(x), m_names(names), m_extra_map(extra_map)
@@ -205,7 +608,8 @@ public:
      * - memory errors in standard containers,
      * - the public interface of std::unordered_map,
      * - the move constructor of \p T,
-     * - the construction of objects of type \p U.
+     * - the compilation of \p x for batch evaluation, which requires the evaluation of the coefficients
+     *   and the extraction of the exponents of the keys of \p x.
      */
     explicit lambdified(T &&x, const std::vector<std::string> &names, extra_map_type extra_map = extra_map_type{})
         : m_x(std::move(x)), m_names(names), m_extra_map(extra_map)
@@ -218,25 +622,14 @@ public:
      *
      * @throws unspecified any exception thrown by the copy constructor of the internal members.
      */
-    lambdified(const lambdified &other)
-        : m_x(other.m_x), m_names(other.m_names), m_eval_dict(other.m_eval_dict), m_extra_map(other.m_extra_map)
-    {
-        reconstruct_ptrs();
-    }
+    lambdified(const lambdified &other) = default;
     /// Move constructor.
     /**
      * @param[in] other move argument.
      *
      * @throws unspecified any exception thrown by the move constructor of the internal members.
      */
-    lambdified(lambdified &&other)
-        : m_x(std::move(other.m_x)), m_names(std::move(other.m_names)), m_eval_dict(std::move(other.m_eval_dict)),
-          m_extra_map(std::move(other.m_extra_map))
-    {
-        // NOTE: it looks like we cannot be sure the moved-in pointers are still valid.
-        // Let's just make sure.
-        reconstruct_ptrs();
-    }
+    lambdified(lambdified &&other) = default;
     /// Deleted copy assignment operator.
     lambdified &operator=(const lambdified &) = delete;
     /// Deleted move assignment operator.
@@ -246,53 +639,175 @@ public:
      * The call operator will first associate the elements of \p values to the vector of names used to construct \p
      * this,
      * and it will then call piranha::math::evaluate() on the stored internal instance of the object of type \p T used
-     * during construction.
+     * during construction. If a piranha::horner_plan was built via build_horner_plan(), the plan is evaluated instead.
+     * Otherwise, if the internal object has been compiled into a flat representation during construction, the point
+     * is evaluated via the compiled representation, in the same way as in evaluate_batch(). In both cases the result is
+     * mathematically the same, but floating-point results might differ slightly, and for series with numerical
+     * coefficients no evaluation dictionary is built.
      *
      * If a non-empty \p extra_map parameter was used during construction, the symbols in it are evaluated according
      * to the mapped functions before being passed down in the evaluation dictionary to piranha::math::evaluate().
      *
-     * Note that this function needs to modify the internal state of the object, and thus it is not const and it is
-     * not thread-safe.
+     * This function does not modify the internal state of the object, and it can be called concurrently from
+     * multiple threads (provided that the same holds for the mapped functions in the \p extra_map parameter
+     * used during construction).
      *
      * @param[in] values the values that will be used for evaluation.
      *
-     * @return the output of piranha::math::evaluate() called on the instance of type \p T stored internally.
+     * @return the evaluation of the instance of type \p T stored internally.
      *
      * @throws std::invalid_argument if the size of \p values is not equal to the size of the vector of names
      * used during construction.
      * @throws unspecified any exception raised by:
-     * - the copy-assignment operator of \p U,
+     * - the copy constructor of \p U,
+     * - the public interface of std::unordered_map,
      * - math::evaluate(),
+     * - piranha::horner_plan::evaluate(),
      * - the call operator of the mapped functions in the \p extra_map parameter used during construction.
      */
-    eval_type operator()(const std::vector<U> &values)
+    eval_type operator()(const std::vector<U> &values) const
     {
-        if (unlikely(values.size() != m_eval_dict.size() - m_extra_map.size())) {
+        if (unlikely(values.size() != m_names.size())) {
             piranha_throw(std::invalid_argument, "the size of the vector of evaluation values does not "
                                                  "match the size of the symbol list used during construction");
         }
-        piranha_assert(values.size() == m_names.size());
-        decltype(values.size()) i = 0u;
-        for (; i < values.size(); ++i) {
-            auto ptr = m_ptrs[static_cast<decltype(m_ptrs.size())>(i)];
-            piranha_assert(
-                ptr == std::addressof(m_eval_dict.find(m_names[static_cast<decltype(m_names.size())>(i)])->second));
-            *ptr = values[i];
-        }
-        // NOTE: here it is crucial that the iteration order on m_extra_map is the same
-        // as it was during the construction of the m_ptrs vector, otherwise we are associating
-        // values to the wrong symbols. Luckily, it seems like iterating on a const unordered_map
-        // multiple times yields the same order:
-        // http://stackoverflow.com/questions/18301302/is-forauto-i-unordered-map-guaranteed-to-have-the-same-order-every-time
-        // https://groups.google.com/a/isocpp.org/forum/#!topic/std-discussion/kHYFUhsauhU
-        for (const auto &p : m_extra_map) {
-            piranha_assert(i < m_ptrs.size());
-            auto ptr = m_ptrs[static_cast<decltype(m_ptrs.size())>(i)];
-            piranha_assert(ptr == std::addressof(m_eval_dict.find(p.first)->second));
-            *ptr = p.second(values);
-            ++i;
+        std::vector<U> extra_values;
+        for (const auto &s : m_extra_names) {
+            extra_values.push_back(m_extra_map.find(s)->second(values));
+        }
+        return evaluate_values(values, extra_values);
+    }
+    /// Batch evaluation.
+    /**
+     * This method will evaluate the internal instance of the object of type \p T at multiple points.
+     * The evaluation values are passed in a structure-of-arrays layout: \p values must contain a vector of values
+     * for each symbol in the vector of names used during construction, and the <tt>i</tt>-th point
+     * is formed by the <tt>i</tt>-th elements of these vectors. The result is the same as calling
+     * operator()() on each point, with the following differences:
+     * - the mapped functions in the \p extra_map parameter used during construction are called for all the points
+     *   before the evaluation, from the calling thread;
+     * - if the internal object has been compiled into a flat representation during construction, the terms of
+     *   the series are evaluated on blocks of points, with the powers of the evaluation values tabulated for each
+     *   block of points;
+     * - the points are split among the threads returned by piranha::thread_pool::use_threads().
+     *
+     * If the vector of names used during construction is empty, the returned vector is empty.
+     *
+     * @param[in] values the values that will be used for evaluation.
+     *
+     * @return a vector containing the evaluation of the internal object of type \p T at each point.
+     *
+     * @throws std::invalid_argument if the size of \p values is not equal to the size of the vector of names
+     * used during construction, or if the vectors in \p values do not all have the same size.
+     * @throws unspecified any exception raised by:
+     * - operator()(),
+     * - the evaluation of the coefficients and keys of the internal object of type \p T, and the exponentiation
+     *   of objects of type \p U via piranha::math::pow(),
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back(),
+     * - memory errors in standard containers.
+     */
+    std::vector<eval_type> evaluate_batch(const std::vector<std::vector<U>> &values) const
+    {
+        if (unlikely(values.size() != m_names.size())) {
+            piranha_throw(std::invalid_argument, "the number of vectors of evaluation values does not "
+                                                 "match the size of the symbol list used during construction");
+        }
+        const std::size_t n_points = values.empty() ? 0u : values[0u].size();
+        for (const auto &v : values) {
+            if (unlikely(v.size() != n_points)) {
+                piranha_throw(std::invalid_argument, "the vectors of evaluation values do not all have the same size");
+            }
         }
-        return math::evaluate(m_x, m_eval_dict);
+        std::vector<eval_type> retval;
+        if (!n_points) {
+            return retval;
+        }
+        // Compute the values of the symbols in the extra map.
+        std::vector<std::vector<U>> extra_values(m_extra_names.size());
+        if (!m_extra_names.empty()) {
+            std::vector<U> point;
+            for (std::size_t i = 0u; i < n_points; ++i) {
+                point.clear();
+                for (const auto &v : values) {
+                    point.push_back(v[i]);
+                }
+                auto it = extra_values.begin();
+                for (const auto &s : m_extra_names) {
+                    it->push_back(m_extra_map.find(s)->second(point));
+                    ++it;
+                }
+            }
+        }
+        std::vector<const U *> cols;
+        for (const auto &v : values) {
+            cols.push_back(v.data());
+        }
+        for (const auto &v : extra_values) {
+            cols.push_back(v.data());
+        }
+        const auto n_threads = thread_pool::use_threads(n_points, min_points_per_thread());
+        if (n_threads == 1u) {
+            retval.reserve(n_points);
+            evaluate_range(cols, 0u, n_points, retval);
+            return retval;
+        }
+        // Split the points among the threads, each one writing into its own vector of results.
+        std::vector<std::vector<eval_type>> partials(n_threads);
+        const auto block_size = n_points / n_threads;
+        future_list<void> ff_list;
+        try {
+            for (unsigned i = 0u; i < n_threads; ++i) {
+                const auto b = block_size * i, e = (i == n_threads - 1u) ? n_points : b + block_size;
+                ff_list.push_back(thread_pool::enqueue(
+                    i, [this, &cols, &partials, b, e, i]() { evaluate_range(cols, b, e, partials[i]); }));
+            }
+            // First let's wait for everything to finish.
+            ff_list.wait_all();
+            // Then, let's handle the exceptions.
+            ff_list.get_all();
+        } catch (...) {
+            ff_list.wait_all();
+            throw;
+        }
+        retval.reserve(n_points);
+        for (auto &p : partials) {
+            std::move(p.begin(), p.end(), std::back_inserter(retval));
+        }
+        return retval;
+    }
+    /// Build a Horner plan.
+    /**
+     * \note
+     * This method is enabled only if the internal object of type \p T can be evaluated with objects of type \p U
+     * via a piranha::horner_plan.
+     *
+     * This method will compile the internal object into a piranha::horner_plan, which will then be used by
+     * operator()() (and by evaluate_batch() for the objects which are not compiled into a flat representation).
+     * The plan requires far fewer operations than the term-by-term evaluation, but its construction
+     * can be more expensive than several evaluations of large series. Hence, it is not built upon construction.
+     * The plan is immutable, and it is shared among the copies of \p this.
+     *
+     * This method must not be called concurrently with the evaluation methods.
+     *
+     * @throws unspecified any exception thrown by the constructor of piranha::horner_plan, or by memory errors
+     * in standard containers.
+     */
+    template <typename H = horner_type,
+              typename std::enable_if<std::is_same<H, horner_plan<T>>::value, int>::type = 0>
+    void build_horner_plan()
+    {
+        auto positions = horner_positions();
+        m_horner = std::make_shared<const horner_type>(m_x);
+        m_horner_positions = std::move(positions);
+    }
+    /// Detect the Horner plan.
+    /**
+     * @return \p true if build_horner_plan() was called on \p this (or on the object \p this was copied from),
+     * \p false otherwise.
+     */
+    bool has_horner_plan() const
+    {
+        return static_cast<bool>(m_horner);
     }
     /// Get evaluation object.
     /**
@@ -328,9 +843,11 @@ public:
 private:
     T m_x;
     std::vector<std::string> m_names;
-    std::unordered_map<std::string, U> m_eval_dict;
-    std::vector<U *> m_ptrs;
     extra_map_type m_extra_map;
+    std::vector<std::string> m_extra_names;
+    program_type m_program;
+    std::shared_ptr<const horner_type> m_horner;
+    std::vector<std::size_t> m_horner_positions;
 };
 }
 
@@ -0,0 +1,575 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PIRANHA_LAZY_RATIONAL_FUNCTION_HPP
+#define PIRANHA_LAZY_RATIONAL_FUNCTION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+#include "config.hpp"
+#include "exceptions.hpp"
+#include "math.hpp"
+#include "rational_function.hpp"
+
+namespace piranha
+{
+
+/// Lazily-reduced rational function.
+/**
+ * This class is an arithmetic wrapper around piranha::rational_function which avoids the canonicalisation
+ * (and thus the polynomial GCD computation) after each arithmetic operation. The numerator and the denominator
+ * of a piranha::lazy_rational_function are in general not coprime: they are reduced to the canonical form only
+ * when the size of the fraction (that is, the total number of terms in the numerator and in the denominator)
+ * exceeds both the threshold returned by get_reduction_threshold() and twice the size of the fraction
+ * at the time of the last reduction, or when reduce() is called. Long chains of additions, subtractions,
+ * multiplications and divisions thus require only a logarithmic number of GCD computations, instead of one GCD
+ * computation per operation. Note that get() and the stream operator work on a reduced copy and leave the stored
+ * fraction untouched, so that each call on a non-reduced fraction repeats the GCD computation: reduce() should be
+ * called first if the value is going to be observed more than once.
+ *
+ * Some cheap simplifications are applied eagerly: fractions with a zero numerator are reset to <tt>0 / 1</tt>,
+ * and fractions with identical denominators are added and subtracted without multiplying the denominators.
+ *
+ * ## Interoperability with other types ##
+ *
+ * Instances of piranha::lazy_rational_function can interoperate with piranha::rational_function and all the types
+ * from which piranha::rational_function can be constructed.
+ *
+ * ## Exception safety guarantee ##
+ *
+ * Unless noted otherwise, this class provides the strong exception safety guarantee.
+ *
+ * ## Move semantics ##
+ *
+ * Move operations will leave objects of this class in a state which is destructible and assignable.
+ */
+template <typename Key>
+class lazy_rational_function
+{
+public:
+    /// The canonical rational function type.
+    using r_type = rational_function<Key>;
+    /// The polynomial type of numerator and denominator.
+    using p_type = typename r_type::p_type;
+    /// Size type.
+    using size_type = typename p_type::size_type;
+
+private:
+    // Shortcut from C++14.
+    template <typename T>
+    using decay_t = typename std::decay<T>::type;
+    // Types which can be converted to lazy_rational_function.
+    template <typename T>
+    using is_interoperable
+        = std::integral_constant<bool, !std::is_same<decay_t<T>, lazy_rational_function>::value
+                                           && std::is_constructible<r_type, const decay_t<T> &>::value>;
+    // Enabler for the binary operators: at least one argument must be lazy_rational_function,
+    // the other one must be lazy_rational_function or an interoperable type.
+    template <typename T, typename U>
+    using binary_op_enabler = typename std::enable_if<
+        (std::is_same<decay_t<T>, lazy_rational_function>::value
+         && (std::is_same<decay_t<U>, lazy_rational_function>::value || is_interoperable<U>::value))
+            || (is_interoperable<T>::value && std::is_same<decay_t<U>, lazy_rational_function>::value),
+        int>::type;
+    // Enabler for the in-place operators.
+    template <typename T>
+    using in_place_enabler =
+        typename std::enable_if<std::is_same<decay_t<T>, lazy_rational_function>::value || is_interoperable<T>::value,
+                                int>::type;
+    // Conversion to lazy_rational_function.
+    static const lazy_rational_function &to_lazy(const lazy_rational_function &x)
+    {
+        return x;
+    }
+    template <typename T, typename std::enable_if<is_interoperable<T>::value, int>::type = 0>
+    static lazy_rational_function to_lazy(const T &x)
+    {
+        return lazy_rational_function(x);
+    }
+    // Size of a fraction.
+    static size_type fraction_size(const p_type &n, const p_type &d)
+    {
+        return static_cast<size_type>(n.size() + d.size());
+    }
+    // Build the result of an arithmetic operation from numerator and denominator.
+    static lazy_rational_function make_result(p_type &&n, p_type &&d, const lazy_rational_function &a,
+                                              const lazy_rational_function &b)
+    {
+        lazy_rational_function retval;
+        retval.m_num = std::move(n);
+        retval.m_den = std::move(d);
+        retval.m_canonical = false;
+        retval.m_ref_size = std::max(a.m_ref_size, b.m_ref_size);
+        retval.cheap_reduce();
+        return retval;
+    }
+    // Cheap reductions, and full reduction if the size of the fraction grew enough.
+    void cheap_reduce()
+    {
+        if (math::is_zero(m_num)) {
+            m_num = p_type{};
+            m_den = p_type{1};
+            m_canonical = true;
+            m_ref_size = 1u;
+            return;
+        }
+        if (math::is_unitary(m_den)) {
+            // A unitary denominator is already canonical.
+            m_canonical = true;
+            m_ref_size = fraction_size(m_num, m_den);
+            return;
+        }
+        const auto size = fraction_size(m_num, m_den);
+        // Reduce only when the fraction has at least doubled in size since the last reduction,
+        // so that the cost of the GCDs is amortised over the operations.
+        if (size > get_reduction_threshold() && size / 2u > m_ref_size) {
+            reduce();
+        }
+    }
+    static lazy_rational_function dispatch_add(const lazy_rational_function &a, const lazy_rational_function &b)
+    {
+        if (a.m_den == b.m_den) {
+            // Same denominator (this includes the case of unitary denominators).
+            return make_result(a.m_num + b.m_num, p_type(a.m_den), a, b);
+        }
+        if (math::is_unitary(a.m_den)) {
+            return make_result(a.m_num * b.m_den + b.m_num, p_type(b.m_den), a, b);
+        }
+        if (math::is_unitary(b.m_den)) {
+            return make_result(a.m_num + b.m_num * a.m_den, p_type(a.m_den), a, b);
+        }
+        return make_result(a.m_num * b.m_den + a.m_den * b.m_num, a.m_den * b.m_den, a, b);
+    }
+    static lazy_rational_function dispatch_mul(const lazy_rational_function &a, const lazy_rational_function &b)
+    {
+        if (math::is_unitary(a.m_den) && math::is_unitary(b.m_den)) {
+            return make_result(a.m_num * b.m_num, p_type{1}, a, b);
+        }
+        return make_result(a.m_num * b.m_num, a.m_den * b.m_den, a, b);
+    }
+    static lazy_rational_function dispatch_div(const lazy_rational_function &a, const lazy_rational_function &b)
+    {
+        if (unlikely(math::is_zero(b.m_num))) {
+            piranha_throw(zero_division_error, "division by zero in lazy rational function");
+        }
+        if (math::is_unitary(b.m_num)) {
+            return make_result(a.m_num * b.m_den, p_type(a.m_den), a, b);
+        }
+        return make_result(a.m_num * b.m_den, a.m_den * b.m_num, a, b);
+    }
+
+public:
+    /// Default constructor.
+    /**
+     * The value will be initialised to zero.
+     *
+     * @throws unspecified any exception thrown by the constructor of lazy_rational_function::p_type from \p int.
+     */
+    lazy_rational_function() : m_num(), m_den(1), m_canonical(true), m_ref_size(1u)
+    {
+    }
+    /// Defaulted copy constructor.
+    lazy_rational_function(const lazy_rational_function &) = default;
+    /// Defaulted move constructor.
+    lazy_rational_function(lazy_rational_function &&) = default;
+    /// Constructor from piranha::rational_function.
+    /**
+     * @param[in] r construction argument.
+     *
+     * @throws unspecified any exception thrown by the copy constructor of lazy_rational_function::p_type.
+     */
+    explicit lazy_rational_function(const r_type &r)
+        : m_num(r.num()), m_den(r.den()), m_canonical(true), m_ref_size(fraction_size(r.num(), r.den()))
+    {
+    }
+    /// Generic constructor.
+    /**
+     * \note
+     * This constructor is enabled only if piranha::rational_function can be constructed from \p T
+     * and \p T is not piranha::rational_function.
+     *
+     * The value of \p this will be the canonical rational function constructed from \p x.
+     *
+     * @param[in] x construction argument.
+     *
+     * @throws unspecified any exception thrown by the constructor of piranha::rational_function from \p x.
+     */
+    template <typename T, typename std::enable_if<is_interoperable<T>::value
+                                                      && !std::is_same<decay_t<T>, r_type>::value,
+                                                  int>::type = 0>
+    explicit lazy_rational_function(const T &x) : lazy_rational_function(r_type(x))
+    {
+    }
+    /// Defaulted copy-assignment operator.
+    lazy_rational_function &operator=(const lazy_rational_function &) = default;
+    /// Defaulted move-assignment operator.
+    lazy_rational_function &operator=(lazy_rational_function &&) = default;
+    /// Get the reduction threshold.
+    /**
+     * This method is thread-safe.
+     *
+     * @return the minimum size of a fraction (that is, the total number of terms in numerator and denominator)
+     * that can trigger a reduction to canonical form after an arithmetic operation.
+     */
+    static size_type get_reduction_threshold()
+    {
+        return s_reduction_threshold.load();
+    }
+    /// Set the reduction threshold.
+    /**
+     * This method is thread-safe.
+     *
+     * @param[in] n the desired reduction threshold.
+     */
+    static void set_reduction_threshold(size_type n)
+    {
+        s_reduction_threshold.store(n);
+    }
+    /// Reset the reduction threshold.
+    /**
+     * This method will set the reduction threshold to its default value, 64.
+     * This method is thread-safe.
+     */
+    static void reset_reduction_threshold()
+    {
+        s_reduction_threshold.store(size_type(64u));
+    }
+    /// Reduce to canonical form.
+    /**
+     * This method will put the numerator and the denominator of \p this in the canonical form of
+     * piranha::rational_function. If \p this is already in canonical form, this method is a no-op.
+     *
+     * @throws unspecified any exception thrown by piranha::rational_function::canonicalise().
+     */
+    void reduce()
+    {
+        if (m_canonical) {
+            return;
+        }
+        r_type tmp;
+        tmp._num() = m_num;
+        tmp._den() = m_den;
+        tmp.canonicalise();
+        m_num = std::move(tmp._num());
+        m_den = std::move(tmp._den());
+        m_canonical = true;
+        m_ref_size = fraction_size(m_num, m_den);
+    }
+    /// Canonical value.
+    /**
+     * The canonical form is computed on a copy of \p this, which is not modified. If \p this is not reduced,
+     * every call to this method will compute the canonical form again.
+     *
+     * @return the canonical piranha::rational_function equivalent to \p this.
+     *
+     * @throws unspecified any exception thrown by reduce() or by the copy constructor.
+     */
+    r_type get() const
+    {
+        lazy_rational_function tmp(*this);
+        tmp.reduce();
+        r_type retval;
+        retval._num() = std::move(tmp.m_num);
+        retval._den() = std::move(tmp.m_den);
+        return retval;
+    }
+    /// Reduction status.
+    /**
+     * @return \p true if \p this is known to be in canonical form, \p false otherwise.
+     */
+    bool is_reduced() const
+    {
+        return m_canonical;
+    }
+    /// Size.
+    /**
+     * @return the total number of terms in the numerator and in the denominator of \p this.
+     */
+    size_type size() const
+    {
+        return fraction_size(m_num, m_den);
+    }
+    /// Numerator.
+    /**
+     * @return a const reference to the numerator, which is not necessarily coprime with the denominator.
+     */
+    const p_type &num() const
+    {
+        return m_num;
+    }
+    /// Denominator.
+    /**
+     * @return a const reference to the denominator, which is not necessarily coprime with the numerator.
+     */
+    const p_type &den() const
+    {
+        return m_den;
+    }
+    /// Stream operator.
+    /**
+     * Will print the canonical form of \p r to \p os.
+     *
+     * @param[in] os target stream.
+     * @param[in] r the piranha::lazy_rational_function to be printed.
+     *
+     * @return a reference to \p os.
+     *
+     * @throws unspecified any exception thrown by get() or by the stream operator of piranha::rational_function.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const lazy_rational_function &r)
+    {
+        return os << r.get();
+    }
+    /// Identity operator.
+    /**
+     * @return a copy of \p this.
+     *
+     * @throws unspecified any exception thrown by the copy constructor.
+     */
+    lazy_rational_function operator+() const
+    {
+        return *this;
+    }
+    /// Negation operator.
+    /**
+     * @return the negation of \p this.
+     *
+     * @throws unspecified any exception thrown by the copy constructor or by math::negate().
+     */
+    lazy_rational_function operator-() const
+    {
+        lazy_rational_function retval(*this);
+        math::negate(retval.m_num);
+        return retval;
+    }
+    /// Binary addition.
+    /**
+     * \note
+     * This operator is enabled only if at least one of the arguments is piranha::lazy_rational_function,
+     * and the other argument is either piranha::lazy_rational_function or an interoperable type.
+     *
+     * The operation is performed without computing any GCD, unless the size of the result triggers
+     * a reduction (see the class description).
+     *
+     * @param[in] a first argument.
+     * @param[in] b second argument.
+     *
+     * @return <tt>a + b</tt>.
+     *
+     * @throws unspecified any exception thrown by the arithmetic operators of lazy_rational_function::p_type,
+     * by the constructors of piranha::lazy_rational_function or by reduce().
+     */
+    template <typename T, typename U, binary_op_enabler<T, U> = 0>
+    friend lazy_rational_function operator+(T &&a, U &&b)
+    {
+        return dispatch_add(to_lazy(a), to_lazy(b));
+    }
+    /// Binary subtraction.
+    /**
+     * \note
+     * This operator is enabled only if at least one of the arguments is piranha::lazy_rational_function,
+     * and the other argument is either piranha::lazy_rational_function or an interoperable type.
+     *
+     * @param[in] a first argument.
+     * @param[in] b second argument.
+     *
+     * @return <tt>a - b</tt>.
+     *
+     * @throws unspecified any exception thrown by the binary addition and negation operators.
+     */
+    template <typename T, typename U, binary_op_enabler<T, U> = 0>
+    friend lazy_rational_function operator-(T &&a, U &&b)
+    {
+        return dispatch_add(to_lazy(a), -to_lazy(b));
+    }
+    /// Binary multiplication.
+    /**
+     * \note
+     * This operator is enabled only if at least one of the arguments is piranha::lazy_rational_function,
+     * and the other argument is either piranha::lazy_rational_function or an interoperable type.
+     *
+     * @param[in] a first argument.
+     * @param[in] b second argument.
+     *
+     * @return <tt>a * b</tt>.
+     *
+     * @throws unspecified any exception thrown by the arithmetic operators of lazy_rational_function::p_type,
+     * by the constructors of piranha::lazy_rational_function or by reduce().
+     */
+    template <typename T, typename U, binary_op_enabler<T, U> = 0>
+    friend lazy_rational_function operator*(T &&a, U &&b)
+    {
+        return dispatch_mul(to_lazy(a), to_lazy(b));
+    }
+    /// Binary division.
+    /**
+     * \note
+     * This operator is enabled only if at least one of the arguments is piranha::lazy_rational_function,
+     * and the other argument is either piranha::lazy_rational_function or an interoperable type.
+     *
+     * @param[in] a first argument.
+     * @param[in] b second argument.
+     *
+     * @return <tt>a / b</tt>.
+     *
+     * @throws piranha::zero_division_error if \p b is zero.
+     * @throws unspecified any exception thrown by the arithmetic operators of lazy_rational_function::p_type,
+     * by the constructors of piranha::lazy_rational_function or by reduce().
+     */
+    template <typename T, typename U, binary_op_enabler<T, U> = 0>
+    friend lazy_rational_function operator/(T &&a, U &&b)
+    {
+        return dispatch_div(to_lazy(a), to_lazy(b));
+    }
+    /// In-place addition.
+    /**
+     * \note
+     * This operator is enabled only if \p T is piranha::lazy_rational_function or an interoperable type.
+     *
+     * @param[in] x argument.
+     *
+     * @return a reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the binary addition operator.
+     */
+    template <typename T, in_place_enabler<T> = 0>
+    lazy_rational_function &operator+=(const T &x)
+    {
+        return *this = *this + x;
+    }
+    /// In-place subtraction.
+    /**
+     * \note
+     * This operator is enabled only if \p T is piranha::lazy_rational_function or an interoperable type.
+     *
+     * @param[in] x argument.
+     *
+     * @return a reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the binary subtraction operator.
+     */
+    template <typename T, in_place_enabler<T> = 0>
+    lazy_rational_function &operator-=(const T &x)
+    {
+        return *this = *this - x;
+    }
+    /// In-place multiplication.
+    /**
+     * \note
+     * This operator is enabled only if \p T is piranha::lazy_rational_function or an interoperable type.
+     *
+     * @param[in] x argument.
+     *
+     * @return a reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the binary multiplication operator.
+     */
+    template <typename T, in_place_enabler<T> = 0>
+    lazy_rational_function &operator*=(const T &x)
+    {
+        return *this = *this * x;
+    }
+    /// In-place division.
+    /**
+     * \note
+     * This operator is enabled only if \p T is piranha::lazy_rational_function or an interoperable type.
+     *
+     * @param[in] x argument.
+     *
+     * @return a reference to \p this.
+     *
+     * @throws unspecified any exception thrown by the binary division operator.
+     */
+    template <typename T, in_place_enabler<T> = 0>
+    lazy_rational_function &operator/=(const T &x)
+    {
+        return *this = *this / x;
+    }
+    /// Equality operator.
+    /**
+     * \note
+     * This operator is enabled only if at least one of the arguments is piranha::lazy_rational_function,
+     * and the other argument is either piranha::lazy_rational_function or an interoperable type.
+     *
+     * The comparison is performed via cross-multiplication, without reducing the arguments.
+     *
+     * @param[in] a first argument.
+     * @param[in] b second argument.
+     *
+     * @return \p true if \p a and \p b represent the same rational function, \p false otherwise.
+     *
+     * @throws unspecified any exception thrown by the constructors of piranha::lazy_rational_function,
+     * or by the multiplication and comparison operators of lazy_rational_function::p_type.
+     */
+    template <typename T, typename U, binary_op_enabler<T, U> = 0>
+    friend bool operator==(const T &a, const U &b)
+    {
+        const lazy_rational_function &la = to_lazy(a), &lb = to_lazy(b);
+        if (la.m_den == lb.m_den) {
+            return la.m_num == lb.m_num;
+        }
+        return la.m_num * lb.m_den == lb.m_num * la.m_den;
+    }
+    /// Inequality operator.
+    /**
+     * \note
+     * This operator is enabled only if at least one of the arguments is piranha::lazy_rational_function,
+     * and the other argument is either piranha::lazy_rational_function or an interoperable type.
+     *
+     * @param[in] a first argument.
+     * @param[in] b second argument.
+     *
+     * @return the opposite of the equality operator.
+     *
+     * @throws unspecified any exception thrown by the equality operator.
+     */
+    template <typename T, typename U, binary_op_enabler<T, U> = 0>
+    friend bool operator!=(const T &a, const U &b)
+    {
+        return !(a == b);
+    }
+
+private:
+    p_type m_num;
+    p_type m_den;
+    bool m_canonical;
+    // The size of the fraction at the time of the last reduction.
+    size_type m_ref_size;
+    static std::atomic<size_type> s_reduction_threshold;
+};
+
+template <typename Key>
+std::atomic<typename lazy_rational_function<Key>::size_type>
+    lazy_rational_function<Key>::s_reduction_threshold(typename lazy_rational_function<Key>::size_type(64u));
+}
+
+#endif
@@ -446,6 +446,86 @@ inline void multiply_accumulate(T &x, U &&y, V &&z)
     multiply_accumulate_impl<T, typename std::decay<U>::type, typename std::decay<V>::type>{}(x, std::forward<U>(y),
                                                                                               std::forward<V>(z));
 }
+}
+
+namespace detail
+{
+
+// Accumulator for sums of products, used in accumulation loops such as series evaluation.
+// The default implementation is a thin wrapper around math::multiply_accumulate(). Specialisations
+// are allowed to keep the accumulated value in a non-normalised internal representation, which
+// will be normalised only once when the final value is extracted via get() (see, e.g., the
+// specialisation for mp_rational).
+template <typename T, typename = void>
+class sum_accumulator
+{
+public:
+    sum_accumulator() : m_value(0)
+    {
+    }
+    template <typename U, typename V>
+    void multiply_accumulate(U &&y, V &&z)
+    {
+        math::multiply_accumulate(m_value, std::forward<U>(y), std::forward<V>(z));
+    }
+    template <typename U>
+    void add(U &&y)
+    {
+        m_value += std::forward<U>(y);
+    }
+    // NOTE: this will leave the accumulator in an unspecified state, it must be called
+    // only once at the end of the accumulation.
+    T get()
+    {
+        return std::move(m_value);
+    }
+
+private:
+    T m_value;
+};
+
+// Specialisation for floating-point types. The accumulation uses Neumaier's variant of Kahan's compensated
+// summation, so that the rounding error of the sum does not grow with the number of terms.
+template <typename T>
+class sum_accumulator<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+public:
+    sum_accumulator() : m_sum(0), m_comp(0)
+    {
+    }
+    template <typename U, typename V>
+    void multiply_accumulate(U &&y, V &&z)
+    {
+        add(T(std::forward<U>(y) * std::forward<V>(z)));
+    }
+    void add(const T &x)
+    {
+        const T t = m_sum + x;
+        if (unlikely(!std::isfinite(t))) {
+            // Non-finite values: the compensation would only produce NaNs.
+            m_sum = t;
+            return;
+        }
+        if (std::abs(m_sum) >= std::abs(x)) {
+            m_comp += (m_sum - t) + x;
+        } else {
+            m_comp += (x - t) + m_sum;
+        }
+        m_sum = t;
+    }
+    T get()
+    {
+        return std::isfinite(m_sum) ? m_sum + m_comp : m_sum;
+    }
+
+private:
+    T m_sum;
+    T m_comp;
+};
+}
+
+namespace math
+{
 
 /// Default functor for the implementation of piranha::math::cos().
 /**
@@ -631,6 +711,190 @@ inline detail::math_sin_type<T> sin(const T &x)
     return sin_impl<T>{}(x);
 }
 
+/// Default functor for the implementation of piranha::math::exp().
+/**
+ * This functor should be specialised via the \p std::enable_if mechanism. Default implementation will not define
+ * the call operator, and will hence result in a compilation error when used.
+ */
+template <typename T, typename Enable = void>
+struct exp_impl {
+};
+
+/// Specialisation of the piranha::math::exp() functor for floating-point types.
+/**
+ * This specialisation is activated when \p T is a C++ floating-point type.
+ * The result will be computed via the standard <tt>std::exp()</tt> function.
+ */
+template <typename T>
+struct exp_impl<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    /// Call operator.
+    /**
+     * The exponential will be computed via <tt>std::exp()</tt>.
+     *
+     * @param[in] x argument.
+     *
+     * @return exponential of \p x.
+     */
+    T operator()(const T &x) const
+    {
+        return std::exp(x);
+    }
+};
+
+/// Specialisation of the piranha::math::exp() functor for integral types.
+/**
+ * This specialisation is activated when \p T is an integral type.
+ */
+template <typename T>
+struct exp_impl<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in] x argument.
+     *
+     * @return exponential of \p x.
+     *
+     * @throws std::invalid_argument if the argument is not zero.
+     */
+    T operator()(const T &x) const
+    {
+        if (x == T(0)) {
+            return T(1);
+        }
+        piranha_throw(std::invalid_argument, "cannot compute the exponential of a non-zero integral");
+    }
+};
+}
+
+namespace detail
+{
+
+// Type for the result of math::exp().
+template <typename T>
+using math_exp_type_ = decltype(math::exp_impl<T>{}(std::declval<const T &>()));
+
+template <typename T>
+using math_exp_type = typename std::enable_if<is_returnable<math_exp_type_<T>>::value, math_exp_type_<T>>::type;
+}
+
+namespace math
+{
+
+/// Exponential.
+/**
+ * \note
+ * This function is enabled only if the expression <tt>exp_impl<T>{}(x)</tt> is valid, returning
+ * a type which satisfies piranha::is_returnable.
+ *
+ * Returns the exponential of \p x. The actual implementation of this function is in the piranha::math::exp_impl
+ * functor's call operator. The body of this function is equivalent to:
+ * @code
+ * return exp_impl<T>{}(x);
+ * @endcode
+ *
+ * @param[in] x exponential argument.
+ *
+ * @return exponential of \p x.
+ *
+ * @throws unspecified any exception thrown by the call operator of the piranha::math::exp_impl functor.
+ */
+template <typename T>
+inline detail::math_exp_type<T> exp(const T &x)
+{
+    return exp_impl<T>{}(x);
+}
+
+/// Default functor for the implementation of piranha::math::log().
+/**
+ * This functor should be specialised via the \p std::enable_if mechanism. Default implementation will not define
+ * the call operator, and will hence result in a compilation error when used.
+ */
+template <typename T, typename Enable = void>
+struct log_impl {
+};
+
+/// Specialisation of the piranha::math::log() functor for floating-point types.
+/**
+ * This specialisation is activated when \p T is a C++ floating-point type.
+ * The result will be computed via the standard <tt>std::log()</tt> function.
+ */
+template <typename T>
+struct log_impl<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    /// Call operator.
+    /**
+     * The natural logarithm will be computed via <tt>std::log()</tt>.
+     *
+     * @param[in] x argument.
+     *
+     * @return natural logarithm of \p x.
+     */
+    T operator()(const T &x) const
+    {
+        return std::log(x);
+    }
+};
+
+/// Specialisation of the piranha::math::log() functor for integral types.
+/**
+ * This specialisation is activated when \p T is an integral type.
+ */
+template <typename T>
+struct log_impl<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in] x argument.
+     *
+     * @return natural logarithm of \p x.
+     *
+     * @throws std::invalid_argument if the argument is not one.
+     */
+    T operator()(const T &x) const
+    {
+        if (x == T(1)) {
+            return T(0);
+        }
+        piranha_throw(std::invalid_argument, "cannot compute the logarithm of an integral different from one");
+    }
+};
+}
+
+namespace detail
+{
+
+// Type for the result of math::log().
+template <typename T>
+using math_log_type_ = decltype(math::log_impl<T>{}(std::declval<const T &>()));
+
+template <typename T>
+using math_log_type = typename std::enable_if<is_returnable<math_log_type_<T>>::value, math_log_type_<T>>::type;
+}
+
+namespace math
+{
+
+/// Natural logarithm.
+/**
+ * \note
+ * This function is enabled only if the expression <tt>log_impl<T>{}(x)</tt> is valid, returning
+ * a type which satisfies piranha::is_returnable.
+ *
+ * Returns the natural logarithm of \p x. The actual implementation of this function is in the
+ * piranha::math::log_impl functor's call operator. The body of this function is equivalent to:
+ * @code
+ * return log_impl<T>{}(x);
+ * @endcode
+ *
+ * @param[in] x logarithm argument.
+ *
+ * @return natural logarithm of \p x.
+ *
+ * @throws unspecified any exception thrown by the call operator of the piranha::math::log_impl functor.
+ */
+template <typename T>
+inline detail::math_log_type<T> log(const T &x)
+{
+    return log_impl<T>{}(x);
+}
+
 /// Default functor for the implementation of piranha::math::partial().
 /**
  * This functor should be specialised via the \p std::enable_if mechanism. Default implementation will not define
@@ -935,6 +1199,62 @@ inline detail::math_t_subs_type<T, U, V> t_subs(const T &x, const std::string &n
     return t_subs_impl<T, U, V>{}(x, name, c, s);
 }
 
+/// Default functor for the implementation of piranha::math::compose().
+/**
+ * This functor should be specialised via the \p std::enable_if mechanism. Default implementation will not define
+ * the call operator, and will hence result in a compilation error when used.
+ */
+template <typename T, typename U, typename Enable = void>
+struct compose_impl {
+};
+}
+
+namespace detail
+{
+
+// Return type for math::compose().
+template <typename T, typename U>
+using math_compose_type_ = decltype(math::compose_impl<T, U>{}(std::declval<const T &>(),
+                                                               std::declval<const std::string &>(),
+                                                               std::declval<const U &>()));
+
+template <typename T, typename U>
+using math_compose_type =
+    typename std::enable_if<is_returnable<math_compose_type_<T, U>>::value, math_compose_type_<T, U>>::type;
+}
+
+namespace math
+{
+
+/// Composition.
+/**
+ * \note
+ * This function is enabled only if <tt>compose_impl<T,U>{}(x,name,y)</tt> is a valid expression, returning
+ * a type which satisfies piranha::is_returnable.
+ *
+ * Compose \p x with \p y, that is, substitute the symbolic variable \p name in \p x with \p y. The result
+ * is mathematically equivalent to piranha::math::subs(), but the implementation can exploit the structure of
+ * the arguments (e.g., the truncation of power series).
+ * The actual implementation of this function is in the piranha::math::compose_impl functor.
+ * The body of this function is equivalent to:
+ * @code
+ * return compose_impl<T,U>{}(x,name,y);
+ * @endcode
+ *
+ * @param[in] x the outer function of the composition.
+ * @param[in] name name of the symbolic variable that will be substituted.
+ * @param[in] y the inner function of the composition.
+ *
+ * @return \p x composed with \p y.
+ *
+ * @throws unspecified any exception thrown by the call operator of piranha::math::compose_impl.
+ */
+template <typename T, typename U>
+inline detail::math_compose_type<T, U> compose(const T &x, const std::string &name, const U &y)
+{
+    return compose_impl<T, U>{}(x, name, y);
+}
+
 /// Default functor for the implementation of piranha::math::abs().
 /**
  * This functor should be specialised via the \p std::enable_if mechanism. Default implementation will not define
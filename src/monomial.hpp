@@ -48,6 +48,7 @@ see https://www.gnu.org/licenses/. */
 #include "array_key.hpp"
 #include "config.hpp"
 #include "detail/cf_mult_impl.hpp"
+#include "detail/power_table.hpp"
 #include "detail/prepare_for_print.hpp"
 #include "detail/safe_integral_adder.hpp"
 #include "exceptions.hpp"
@@ -116,6 +117,9 @@ class monomial : public array_key<T, monomial<T, S>, S>
     };
     template <typename U>
     using eval_type = typename eval_type_<U>::type;
+    // Enabler for the evaluation via power tables.
+    template <typename U>
+    using power_table_enabler = typename std::enable_if<std::is_integral<U>::value, int>::type;
     // Enabler for ctor from init list.
     template <typename U>
     using init_list_enabler =
@@ -177,6 +181,64 @@ class monomial : public array_key<T, monomial<T, S>, S>
     {
         retval += x;
     }
+    // Fast degree computation for small integral exponents. If the sum of any number of exponents (up to the
+    // maximum size of the monomial) is representable in long long, we can accumulate without checking each addition
+    // for overflow (which allows the compiler to vectorise the loop), and then check only the final result.
+    template <typename U>
+    using fast_degree = std::integral_constant<
+        bool, std::is_integral<U>::value && std::numeric_limits<U>::digits
+                                                    + std::numeric_limits<typename base::size_type>::digits
+                                                <= std::numeric_limits<long long>::digits>;
+    template <typename U>
+    static degree_type<U> fast_degree_check(long long n)
+    {
+        using d_type = degree_type<U>;
+        if (unlikely(n > static_cast<long long>(std::numeric_limits<d_type>::max())
+                     || n < static_cast<long long>(std::numeric_limits<d_type>::min()))) {
+            piranha_throw(std::overflow_error, "overflow in the computation of the degree of a monomial");
+        }
+        return static_cast<d_type>(n);
+    }
+    template <typename U, typename std::enable_if<fast_degree<U>::value, int>::type = 0>
+    degree_type<U> degree_impl() const
+    {
+        const auto ptr = this->begin();
+        const auto size = this->size();
+        long long retval = 0;
+        for (typename base::size_type i = 0u; i < size; ++i) {
+            retval += ptr[i];
+        }
+        return fast_degree_check<U>(retval);
+    }
+    template <typename U, typename std::enable_if<!fast_degree<U>::value, int>::type = 0>
+    degree_type<U> degree_impl() const
+    {
+        degree_type<U> retval(0);
+        for (const auto &x : *this) {
+            expo_add(retval, x);
+        }
+        return retval;
+    }
+    template <typename U, typename std::enable_if<fast_degree<U>::value, int>::type = 0>
+    degree_type<U> degree_impl(const symbol_set::positions &p) const
+    {
+        const auto ptr = this->begin();
+        long long retval = 0;
+        for (const auto &i : p) {
+            retval += ptr[i];
+        }
+        return fast_degree_check<U>(retval);
+    }
+    template <typename U, typename std::enable_if<!fast_degree<U>::value, int>::type = 0>
+    degree_type<U> degree_impl(const symbol_set::positions &p) const
+    {
+        auto cit = this->begin();
+        degree_type<U> retval(0);
+        for (const auto &i : p) {
+            expo_add(retval, cit[i]);
+        }
+        return retval;
+    }
     // Integrate utils.
     // In-place increment by one, checked for integral types.
     template <typename U, typename std::enable_if<std::is_integral<U>::value, int>::type = 0>
@@ -253,6 +315,11 @@ class monomial : public array_key<T, monomial<T, S>, S>
     };
     template <typename U>
     using ipow_subs_type = typename ipow_subs_type_<U>::type;
+    // Enabler for ipow_subs_split().
+    template <typename U>
+    using ipow_split_enabler = typename std::enable_if<has_safe_cast<rational, U>::value
+                                                           && is_subtractable_in_place<U, integer>::value,
+                                                       int>::type;
     // Enabler for ctor from range.
     template <typename Iterator>
     using it_ctor_enabler =
@@ -400,7 +467,8 @@ public:
      * and monomial::value_type can be added in-place to it.
      *
      * This method will return the degree of the monomial, computed via the summation of the exponents of the monomial.
-     * If \p T is a C++ integral type, the addition of the exponents will be checked for overflow.
+     * If \p T is a C++ integral type, the addition of the exponents will be checked for overflow (for small
+     * integral types, the exponents are summed in a wider type and only the final result is checked).
      *
      * @param[in] args reference set of piranha::symbol.
      *
@@ -418,11 +486,7 @@ public:
         if (unlikely(args.size() != this->size())) {
             piranha_throw(std::invalid_argument, "invalid arguments set");
         }
-        degree_type<U> retval(0);
-        for (const auto &x : *this) {
-            expo_add(retval, x);
-        }
-        return retval;
+        return degree_impl<U>();
     }
     /// Partial degree.
     /**
@@ -433,7 +497,8 @@ public:
      *
      * This method will return the partial degree of the monomial, computed via the summation of the exponents of the
      * monomial.
-     * If \p T is a C++ integral type, the addition of the exponents will be checked for overflow.
+     * If \p T is a C++ integral type, the addition of the exponents will be checked for overflow (for small
+     * integral types, the exponents are summed in a wider type and only the final result is checked).
      *
      * The \p p argument is used to indicate which exponents are to be taken into account when computing the partial
      * degree.
@@ -456,12 +521,7 @@ public:
         if (unlikely(args.size() != this->size() || (p.size() && p.back() >= this->size()))) {
             piranha_throw(std::invalid_argument, "invalid arguments set or positions");
         }
-        auto cit = this->begin();
-        degree_type<U> retval(0);
-        for (const auto &i : p) {
-            expo_add(retval, cit[i]);
-        }
-        return retval;
+        return degree_impl<U>(p);
     }
     /// Low degree (equivalent to the degree).
     template <typename U = T>
@@ -800,6 +860,59 @@ public:
         piranha_assert(it == pmap.end());
         return retval;
     }
+    /// Update the bounds of the exponents.
+    /**
+     * \note
+     * This method is enabled only if the exponent type is a C++ integral type.
+     *
+     * The pairs in \p bounds will be updated so that they contain, respectively, lower and upper bounds for the
+     * exponents of \p this. If \p bounds is empty, it will be initialised from the exponents of \p this.
+     * This method is used in series evaluation, together with the evaluation via power tables.
+     *
+     * @param[in,out] bounds the vector of bounds to be updated.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @throws std::invalid_argument if the sizes of \p this, \p args and \p bounds (if not empty) differ.
+     * @throws unspecified any exception thrown by memory errors in standard containers.
+     */
+    template <typename U = T, power_table_enabler<U> = 0>
+    void update_exponent_bounds(std::vector<std::pair<U, U>> &bounds, const symbol_set &args) const
+    {
+        if (unlikely(this->size() != args.size() || (!bounds.empty() && bounds.size() != args.size()))) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set or exponent bounds");
+        }
+        detail::power_table<U, U>::update_bounds(bounds, this->begin(), this->end());
+    }
+    /// Evaluation via power tables.
+    /**
+     * \note
+     * This method is enabled only if the exponent type is a C++ integral type, and the other requirements
+     * of the evaluation via piranha::symbol_set::positions_map are satisfied.
+     *
+     * This method will return the same value as the evaluation via piranha::symbol_set::positions_map,
+     * but the powers of the evaluation values are read from \p table, which must cover the exponents of \p this.
+     *
+     * @param[in] table the table of the powers of the evaluation values.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the result of evaluating \p this with the powers provided by \p table.
+     *
+     * @throws std::invalid_argument if the sizes of \p this, \p args and \p table differ.
+     * @throws unspecified any exception thrown by
+     * the construction and the in-place multiplication of the return type.
+     */
+    template <typename U, typename V = T, power_table_enabler<V> = 0>
+    eval_type<U> evaluate(const detail::power_table<U, V> &table, const symbol_set &args) const
+    {
+        if (unlikely(this->size() != args.size() || table.size() != args.size())) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set or power table");
+        }
+        eval_type<U> retval(1);
+        for (decltype(args.size()) i = 0u; i < args.size(); ++i) {
+            retval *= table(i, (*this)[static_cast<typename base::size_type>(i)]);
+        }
+        return retval;
+    }
     /// Substitution.
     /**
      * \note
@@ -914,6 +1027,84 @@ public:
         retval.push_back(std::make_pair(std::move(retval_s), std::move(retval_key)));
         return retval;
     }
+    /// Split for substitution.
+    /**
+     * This method returns a pair whose first element is the exponent of the symbol called \p s (or zero, if \p s
+     * is not in \p args), and whose second element contains the monomial that would be produced by subs().
+     * For a given \p args, the value produced by subs() depends only on the first element of the pair, which
+     * allows to group the monomials of a series by exponent and to compute each power only once.
+     *
+     * @param[in] s name of the symbol that will be substituted.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the exponent of \p s and the monomial resulting from the substitution of \p s.
+     *
+     * @throws std::invalid_argument if the sizes of \p args and \p this differ.
+     * @throws unspecified any exception thrown by:
+     * - construction of an exponent from zero,
+     * - piranha::array_key::push_back().
+     */
+    std::pair<T, std::array<monomial, 1u>> subs_split(const std::string &s, const symbol_set &args) const
+    {
+        if (unlikely(args.size() != this->size())) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set");
+        }
+        std::pair<T, std::array<monomial, 1u>> retval(T(0), std::array<monomial, 1u>{});
+        for (typename base::size_type i = 0u; i < this->size(); ++i) {
+            if (args[i].get_name() == s) {
+                retval.first = (*this)[i];
+                retval.second[0u].push_back(T(0));
+            } else {
+                retval.second[0u].push_back((*this)[i]);
+            }
+        }
+        return retval;
+    }
+    /// Split for integral power substitution.
+    /**
+     * \note
+     * This method is enabled only if the value type of the monomial can be cast safely to piranha::rational and it
+     * supports in-place subtraction with piranha::integer.
+     *
+     * This method returns a pair whose first element is the power of \p x that would be computed by ipow_subs()
+     * (zero if no power is computed), and whose second element contains the monomial that would be produced by
+     * ipow_subs(). For a given \p args, the value produced by ipow_subs() depends only on the first element of the
+     * pair.
+     *
+     * @param[in] s name of the symbol that will be substituted.
+     * @param[in] n power of \p s that will be substituted.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the power of the substituted quantity and the monomial resulting from the substitution.
+     *
+     * @throws std::invalid_argument if the sizes of \p args and \p this differ.
+     * @throws unspecified any exception thrown by:
+     * - construction of piranha::rational,
+     * - piranha::safe_cast(),
+     * - piranha::array_key::push_back(),
+     * - the in-place subtraction operator of the exponent type.
+     */
+    template <typename U = T, ipow_split_enabler<U> = 0>
+    std::pair<integer, std::array<monomial, 1u>> ipow_subs_split(const std::string &s, const integer &n,
+                                                                 const symbol_set &args) const
+    {
+        if (unlikely(args.size() != this->size())) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set");
+        }
+        std::pair<integer, std::array<monomial, 1u>> retval(integer(0), std::array<monomial, 1u>{});
+        auto &key = retval.second[0u];
+        for (typename base::size_type i = 0u; i < this->size(); ++i) {
+            key.push_back((*this)[i]);
+            if (args[i].get_name() == s) {
+                const rational tmp(safe_cast<rational>((*this)[i]) / n);
+                if (tmp >= 1) {
+                    retval.first = static_cast<integer>(tmp);
+                    key[i] -= retval.first * n;
+                }
+            }
+        }
+        return retval;
+    }
     /// Multiply terms with a monomial key.
     /**
      * \note
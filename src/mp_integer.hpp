@@ -4295,6 +4295,52 @@ struct cos_impl<T, typename std::enable_if<detail::is_mp_integer<T>::value>::typ
     }
 };
 
+/// Specialisation of the piranha::math::exp() functor for piranha::mp_integer.
+/**
+ * This specialisation is enabled when \p T is an instance of piranha::mp_integer.
+ */
+template <typename T>
+struct exp_impl<T, typename std::enable_if<detail::is_mp_integer<T>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in] n argument.
+     *
+     * @return exponential of \p n.
+     *
+     * @throws std::invalid_argument if the argument is not zero.
+     */
+    T operator()(const T &n) const
+    {
+        if (is_zero(n)) {
+            return T(1);
+        }
+        piranha_throw(std::invalid_argument, "cannot compute the exponential of a non-zero integer");
+    }
+};
+
+/// Specialisation of the piranha::math::log() functor for piranha::mp_integer.
+/**
+ * This specialisation is enabled when \p T is an instance of piranha::mp_integer.
+ */
+template <typename T>
+struct log_impl<T, typename std::enable_if<detail::is_mp_integer<T>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in] n argument.
+     *
+     * @return logarithm of \p n.
+     *
+     * @throws std::invalid_argument if the argument is not one.
+     */
+    T operator()(const T &n) const
+    {
+        if (math::is_unitary(n)) {
+            return T(0);
+        }
+        piranha_throw(std::invalid_argument, "cannot compute the logarithm of an integer different from one");
+    }
+};
+
 /// Specialisation of the piranha::math::partial() functor for piranha::mp_integer.
 /**
  * This specialisation is enabled when \p T is an instance of piranha::mp_integer.
@@ -29,6 +29,7 @@ see https://www.gnu.org/licenses/. */
 #ifndef PIRANHA_MP_RATIONAL_HPP
 #define PIRANHA_MP_RATIONAL_HPP
 
+#include <algorithm>
 #include <boost/functional/hash.hpp>
 #include <climits>
 #include <cmath>
@@ -247,9 +248,9 @@ private:
             m_num += other.m_num;
         } else if (u1) {
             // Only this is an integer.
-            // NOTE: figure out a way here to use multiply_accumulate(). Most likely we need
-            // a tmp copy, so better profile it first.
-            m_num = m_num * other.m_den + other.m_num;
+            // NOTE: this and other cannot be the same object here, as other is not an integer.
+            m_num *= other.m_den;
+            m_num += other.m_num;
             m_den = other.m_den;
         } else if (u2) {
             // Only other is an integer.
@@ -982,7 +983,14 @@ public:
         }
         // NOTE: here we can avoid the further division by gcd if it is one or -one.
         // Consider this as a possible optimisation in the future.
+#if defined(PIRANHA_HAVE_THREAD_LOCAL)
+        // Re-use a thread-local scratch value for the gcd, so that we do not allocate
+        // a new mpz when the operands are in dynamic storage.
+        static thread_local int_type gcd;
+        math::gcd3(gcd, m_num, m_den);
+#else
         const int_type gcd = math::gcd(m_num, m_den);
+#endif
         piranha_assert(!math::is_zero(gcd));
         int_type::_divexact(m_num, m_num, gcd);
         int_type::_divexact(m_den, m_den, gcd);
@@ -2006,6 +2014,46 @@ struct cos_impl<T, typename std::enable_if<detail::is_mp_rational<T>::value>::ty
     }
 };
 
+/// Specialisation of the piranha::math::exp() functor for piranha::mp_rational.
+template <typename T>
+struct exp_impl<T, typename std::enable_if<detail::is_mp_rational<T>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in] q argument.
+     *
+     * @return exponential of \p q.
+     *
+     * @throws std::invalid_argument if the argument is not zero.
+     */
+    T operator()(const T &q) const
+    {
+        if (is_zero(q)) {
+            return T(1);
+        }
+        piranha_throw(std::invalid_argument, "cannot compute the exponential of a non-zero rational");
+    }
+};
+
+/// Specialisation of the piranha::math::log() functor for piranha::mp_rational.
+template <typename T>
+struct log_impl<T, typename std::enable_if<detail::is_mp_rational<T>::value>::type> {
+    /// Call operator.
+    /**
+     * @param[in] q argument.
+     *
+     * @return logarithm of \p q.
+     *
+     * @throws std::invalid_argument if the argument is not one.
+     */
+    T operator()(const T &q) const
+    {
+        if (math::is_unitary(q)) {
+            return T(0);
+        }
+        piranha_throw(std::invalid_argument, "cannot compute the logarithm of a rational different from one");
+    }
+};
+
 /// Specialisation of the piranha::math::abs() functor for piranha::mp_rational.
 template <typename T>
 struct abs_impl<T, typename std::enable_if<detail::is_mp_rational<T>::value>::type> {
@@ -2172,6 +2220,128 @@ const bool has_exact_ring_operations<T, typename std::enable_if<detail::is_mp_ra
 namespace detail
 {
 
+// Specialisation of the sum accumulator for mp_rational.
+// The accumulated value is kept as an unreduced num/den pair: the GCD that mp_rational would compute
+// after every addition is replaced by cheap checks on the denominators, and the canonicalisation
+// is performed only once in get(). In order to avoid an unbounded growth of the intermediate
+// denominator (e.g., when accumulating values with coprime denominators), the pair is reduced
+// whenever the size of the denominator exceeds an adaptive threshold.
+template <typename T>
+class sum_accumulator<T, typename std::enable_if<is_mp_rational<T>::value>::type>
+{
+    using int_type = typename T::int_type;
+    // Enabler for the generic multiply-accumulate overload.
+    template <typename U, typename V>
+    using generic_ma_enabler =
+        typename std::enable_if<!std::is_same<typename std::decay<U>::type, T>::value
+                                    || !std::is_same<typename std::decay<V>::type, T>::value,
+                                int>::type;
+    // Initial size limit (in bits) for the unreduced denominator.
+    static const std::size_t base_den_limit = 1024u;
+    // Add n/d to the accumulated value, without canonicalising. d must be positive.
+    void add_nd(const int_type &n, const int_type &d)
+    {
+        piranha_assert(d.sign() > 0);
+        if (d == m_den) {
+            // Common case of identical denominators.
+            m_num += n;
+        } else if (d.is_unitary()) {
+            math::multiply_accumulate(m_num, m_den, n);
+        } else if (m_den.is_unitary()) {
+            m_num *= d;
+            m_num += n;
+            m_den = d;
+        } else if (m_den.bits_size() >= d.bits_size()) {
+            // Check if d divides the current denominator.
+            int_type::divrem(m_q, m_r, m_den, d);
+            if (math::is_zero(m_r)) {
+                math::multiply_accumulate(m_num, m_q, n);
+            } else {
+                cross_add(n, d);
+            }
+        } else {
+            // Check if the current denominator divides d.
+            int_type::divrem(m_q, m_r, d, m_den);
+            if (math::is_zero(m_r)) {
+                m_num *= m_q;
+                m_num += n;
+                m_den = d;
+            } else {
+                cross_add(n, d);
+            }
+        }
+    }
+    void cross_add(const int_type &n, const int_type &d)
+    {
+        m_num *= d;
+        math::multiply_accumulate(m_num, m_den, n);
+        m_den *= d;
+        if (unlikely(m_den.bits_size() > m_den_limit)) {
+            reduce();
+            // Adapt the limit, so that we do not end up reducing at every step if the
+            // reduced denominator is genuinely large.
+            m_den_limit = std::max(m_den_limit, m_den.bits_size() * 2u);
+        }
+    }
+    void reduce()
+    {
+        if (math::is_zero(m_num)) {
+            m_den = 1;
+            return;
+        }
+        const int_type gcd = math::gcd(m_num, m_den);
+        int_type::_divexact(m_num, m_num, gcd);
+        int_type::_divexact(m_den, m_den, gcd);
+        if (m_den.sign() < 0) {
+            m_num.negate();
+            m_den.negate();
+        }
+    }
+
+public:
+    sum_accumulator() : m_num(), m_den(1), m_den_limit(base_den_limit)
+    {
+    }
+    void add(const T &q)
+    {
+        add_nd(q.num(), q.den());
+    }
+    void multiply_accumulate(const T &y, const T &z)
+    {
+        // NOTE: the product of the numerators and denominators is not reduced.
+        math::mul3(m_tmp_num, y.num(), z.num());
+        math::mul3(m_tmp_den, y.den(), z.den());
+        add_nd(m_tmp_num, m_tmp_den);
+    }
+    template <typename U, typename V, generic_ma_enabler<U, V> = 0>
+    void multiply_accumulate(U &&y, V &&z)
+    {
+        add(T(std::forward<U>(y) * std::forward<V>(z)));
+    }
+    T get()
+    {
+        reduce();
+        T retval;
+        retval._num() = std::move(m_num);
+        retval._set_den(m_den);
+        piranha_assert(retval.is_canonical());
+        return retval;
+    }
+
+private:
+    int_type m_num;
+    int_type m_den;
+    std::size_t m_den_limit;
+    // Scratch variables.
+    int_type m_tmp_num;
+    int_type m_tmp_den;
+    int_type m_q;
+    int_type m_r;
+};
+
+template <typename T>
+const std::size_t sum_accumulator<T, typename std::enable_if<is_mp_rational<T>::value>::type>::base_den_limit;
+
 template <typename To, typename From>
 using sc_rat_enabler = typename std::enable_if<(is_mp_rational<To>::value
                                                 && (std::is_arithmetic<From>::value || is_mp_integer<From>::value))
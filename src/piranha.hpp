@@ -326,9 +326,12 @@ inline namespace literals
 #include "debug_access.hpp"
 #include "divisor.hpp"
 #include "divisor_series.hpp"
+#include "double_double.hpp"
 #include "dynamic_aligning_allocator.hpp"
 #include "exceptions.hpp"
+#include "fixed_monomial.hpp"
 #include "hash_set.hpp"
+#include "horner_plan.hpp"
 #include "init.hpp"
 #include "invert.hpp"
 #include "ipow_substitutable_series.hpp"
@@ -339,6 +342,7 @@ inline namespace literals
 #include "kronecker_array.hpp"
 #include "kronecker_monomial.hpp"
 #include "lambdify.hpp"
+#include "lazy_rational_function.hpp"
 #include "math.hpp"
 #include "memory.hpp"
 #include "monomial.hpp"
@@ -53,12 +53,15 @@ see https://www.gnu.org/licenses/. */
 #include "detail/atomic_utils.hpp"
 #include "detail/cf_mult_impl.hpp"
 #include "detail/divisor_series_fwd.hpp"
+#include "detail/grouped_subs.hpp"
+#include "detail/modular_gcd.hpp"
 #include "detail/parallel_vector_transform.hpp"
 #include "detail/poisson_series_fwd.hpp"
 #include "detail/polynomial_fwd.hpp"
 #include "detail/safe_integral_adder.hpp"
 #include "detail/sfinae_types.hpp"
 #include "exceptions.hpp"
+#include "fixed_monomial.hpp"
 #include "forwarding.hpp"
 #include "ipow_substitutable_series.hpp"
 #include "is_cf.hpp"
@@ -110,6 +113,11 @@ struct is_polynomial_key<monomial<T, U>> {
     static const bool value = true;
 };
 
+template <typename T, std::size_t N>
+struct is_polynomial_key<fixed_monomial<T, N>> {
+    static const bool value = true;
+};
+
 // Implementation detail to check if the monomial key supports the linear_argument() method.
 template <typename Key>
 struct key_has_linarg : detail::sfinae_types {
@@ -327,112 +335,328 @@ poly_establish_limits(const PType &n, const PType &d)
     return retval;
 }
 
-// Simple dot product.
-template <typename It1, typename It2>
-inline auto poly_dot_product(It1 begin1, It1 end1, It2 begin2) -> decltype((*begin1) * (*begin2))
+// Sparse exact division, implementation. This is the heap-based division algorithm of Johnson, in the formulation
+// of Monagan and Pearce ("Sparse polynomial division using a heap", 2011). The terms of the quotient are produced in
+// decreasing monomial order, and the terms of the product quotient * divisor are merged via a heap containing at
+// most one entry per quotient term, with the chaining of equal monomials described in the paper. The monomials are
+// codified as non-negative integers of type C in a mixed-radix representation in which the radix of each variable
+// is the degree of n in that variable plus one. In an exact
+// division, the exponents of the quotient, of the divisor and of all the intermediate products are bounded by the
+// exponents of n, so that the codification never overflows and it is compatible with monomial multiplication: the
+// ordering of the codes is then a valid monomial ordering. Quotient terms violating the bounds signal an inexact
+// division. Preconditions:
+// - identical symbol sets with at least one symbol,
+// - non-null input polys,
+// - the exponents in n_expos and d_expos are those of n and d, in the iteration order of their containers,
+// - n_max and d_max are the max exponents of n and d in each variable, non-negative and with d_max <= n_max.
+template <typename C, typename PType>
+inline PType poly_heap_divexact_impl(const PType &n, const PType &d,
+                                     const std::vector<typename PType::term_type::key_type::value_type> &n_expos,
+                                     const std::vector<typename PType::term_type::key_type::value_type> &d_expos,
+                                     const std::vector<typename PType::term_type::key_type::value_type> &n_max,
+                                     const std::vector<typename PType::term_type::key_type::value_type> &d_max)
 {
-    using ret_type = decltype((*begin1) * (*begin2));
-    return std::inner_product(begin1, end1, begin2, ret_type(0));
+    using term_type = typename PType::term_type;
+    using cf_type = typename term_type::cf_type;
+    using key_type = typename term_type::key_type;
+    using expo_type = typename key_type::value_type;
+    using e_size_type = typename std::vector<expo_type>::size_type;
+    const auto &args = n.get_symbol_set();
+    const auto nv = static_cast<e_size_type>(args.size());
+    // The radices and the coding vector.
+    std::vector<C> radix, cv;
+    for (e_size_type i = 0u; i < nv; ++i) {
+        radix.push_back(static_cast<C>(integer(n_max[i]) + 1));
+        cv.push_back(i == 0u ? C(1) : C(cv.back() * radix[i - 1u]));
+    }
+    // Codification of the terms, sorted in decreasing order.
+    using c_term = std::pair<C, const cf_type *>;
+    auto encode = [&cv, nv](const PType &p, const std::vector<expo_type> &expos) -> std::vector<c_term> {
+        std::vector<c_term> retval;
+        retval.reserve(static_cast<typename std::vector<c_term>::size_type>(p.size()));
+        e_size_type idx = 0u;
+        for (const auto &t : p._container()) {
+            C code(0);
+            for (e_size_type i = 0u; i < nv; ++i, ++idx) {
+                code += static_cast<C>(expos[idx]) * cv[i];
+            }
+            retval.emplace_back(std::move(code), &t.m_cf);
+        }
+        std::sort(retval.begin(), retval.end(), [](const c_term &a, const c_term &b) { return b.first < a.first; });
+        return retval;
+    };
+    const auto nt = encode(n, n_expos), dt = encode(d, d_expos);
+    using ct_size_type = typename std::vector<c_term>::size_type;
+    // Digits of the leading monomial of the divisor, and the negated coefficients of the divisor.
+    std::vector<C> d0_digits;
+    for (e_size_type i = 0u; i < nv; ++i) {
+        d0_digits.push_back(C(C(dt[0u].first / cv[i]) % radix[i]));
+    }
+    std::vector<cf_type> neg_dcf;
+    neg_dcf.reserve(dt.size());
+    for (const auto &t : dt) {
+        neg_dcf.push_back(-*t.second);
+    }
+    // The quotient.
+    std::vector<C> q_codes;
+    std::vector<cf_type> q_cfs;
+    std::vector<expo_type> q_expos;
+    using q_size_type = typename std::vector<C>::size_type;
+    // The heap. Each quotient term j is associated to at most one product q_j * d_i at a time,
+    // stored in q_next_d[j]. Products with the same monomial can be chained together in a single
+    // heap slot, via the q_chain vector.
+    std::vector<ct_size_type> q_next_d;
+    std::vector<q_size_type> q_chain;
+    const auto chain_end = std::numeric_limits<q_size_type>::max();
+    struct heap_slot {
+        C code;
+        q_size_type head;
+    };
+    std::vector<heap_slot> heap;
+    using h_size_type = typename std::vector<heap_slot>::size_type;
+    // Insert the product of quotient term j and divisor term q_next_d[j] in the heap.
+    auto heap_insert = [&heap, &q_chain, &q_codes, &q_next_d, &dt, chain_end](q_size_type j) {
+        C code = q_codes[j] + dt[q_next_d[j]].first;
+        // Determine the insertion point. If the parent of the insertion point holds a product with the same
+        // monomial, chain the new product to it. Other entries with the same monomial might be elsewhere in
+        // the heap: this is fine, as the extraction loop below pops all the entries with equal codes.
+        h_size_type pos = heap.size(), ins = pos;
+        while (ins != 0u && heap[(ins - 1u) / 2u].code < code) {
+            ins = (ins - 1u) / 2u;
+        }
+        if (ins != 0u && heap[(ins - 1u) / 2u].code == code) {
+            auto &slot = heap[(ins - 1u) / 2u];
+            q_chain[j] = slot.head;
+            slot.head = j;
+            return;
+        }
+        q_chain[j] = chain_end;
+        heap.push_back(heap_slot{std::move(code), j});
+        for (; pos != ins; pos = (pos - 1u) / 2u) {
+            std::swap(heap[pos], heap[(pos - 1u) / 2u]);
+        }
+    };
+    // Remove the top of the heap.
+    auto heap_pop = [&heap]() {
+        piranha_assert(!heap.empty());
+        const auto size = static_cast<h_size_type>(heap.size() - 1u);
+        if (size != 0u) {
+            heap_slot last(std::move(heap.back()));
+            h_size_type pos = 0u;
+            while (true) {
+                auto child = static_cast<h_size_type>(2u * pos + 1u);
+                if (child >= size) {
+                    break;
+                }
+                if (child + 1u < size && heap[child].code < heap[child + 1u].code) {
+                    ++child;
+                }
+                if (!(last.code < heap[child].code)) {
+                    break;
+                }
+                heap[pos] = std::move(heap[child]);
+                pos = child;
+            }
+            heap[pos] = std::move(last);
+        }
+        heap.pop_back();
+    };
+    ct_size_type k = 0u;
+    C cur, tmp;
+    while (k != nt.size() || !heap.empty()) {
+        // Determine the current monomial and accumulate all the contributions to it.
+        if (heap.empty() || (k != nt.size() && !(nt[k].first < heap.front().code))) {
+            cur = nt[k].first;
+        } else {
+            cur = heap.front().code;
+        }
+        sum_accumulator<cf_type> acc;
+        if (k != nt.size() && nt[k].first == cur) {
+            acc.add(*nt[k].second);
+            ++k;
+        }
+        while (!heap.empty() && heap.front().code == cur) {
+            auto j = heap.front().head;
+            heap_pop();
+            while (j != chain_end) {
+                const auto next = q_chain[j];
+                acc.multiply_accumulate(q_cfs[j], neg_dcf[q_next_d[j]]);
+                if (++q_next_d[j] != dt.size()) {
+                    heap_insert(j);
+                }
+                j = next;
+            }
+        }
+        auto c = acc.get();
+        if (math::is_zero(c)) {
+            continue;
+        }
+        // The leading term of the remainder must be divisible by the leading term of the divisor,
+        // and the exponents of the new quotient term must be within the bounds.
+        for (e_size_type i = 0u; i < nv; ++i) {
+            tmp = C(cur / cv[i]) % radix[i];
+            if (tmp < d0_digits[i] || n_max[i] - d_max[i] < static_cast<expo_type>(C(tmp - d0_digits[i]))) {
+                piranha_throw(math::inexact_division, );
+            }
+            q_expos.push_back(static_cast<expo_type>(C(tmp - d0_digits[i])));
+        }
+        math::divexact(c, c, *dt[0u].second);
+        q_codes.push_back(cur - dt[0u].first);
+        q_cfs.push_back(std::move(c));
+        q_next_d.push_back(ct_size_type(1u));
+        q_chain.push_back(chain_end);
+        if (dt.size() > 1u) {
+            heap_insert(static_cast<q_size_type>(q_codes.size() - 1u));
+        }
+    }
+    // Assemble the return value.
+    PType retval;
+    retval.set_symbol_set(args);
+    retval._container().rehash(boost::numeric_cast<typename PType::size_type>(
+        std::ceil(static_cast<double>(q_cfs.size()) / retval._container().max_load_factor())));
+    auto it = q_expos.begin();
+    for (q_size_type j = 0u; j < q_cfs.size(); ++j, it += static_cast<std::ptrdiff_t>(nv)) {
+        retval.insert(term_type{std::move(q_cfs[j]), key_type(it, it + static_cast<std::ptrdiff_t>(nv))});
+    }
+    return retval;
 }
 
-// Convert multivariate polynomial to univariate. Preconditions:
-// - at least 1 symbolic argument,
-// - identical symbol set for n and d,
+// Sparse exact division of multivariate polynomials. The codification of the monomials
+// uses 64-bit unsigned integers when possible, piranha::integer otherwise.
+// Preconditions:
+// - identical symbol sets with at least one symbol,
 // - non-null input polys.
-template <typename Cf, typename Key>
-inline std::tuple<polynomial<Cf, k_monomial>, polynomial<Cf, k_monomial>, std::vector<typename k_monomial::value_type>>
-poly_to_univariate(const polynomial<Cf, Key> &n, const polynomial<Cf, Key> &d)
+template <typename PType>
+inline PType poly_heap_divexact(const PType &n, const PType &d)
 {
+    using expo_type = typename PType::term_type::key_type::value_type;
+    using e_size_type = typename std::vector<expo_type>::size_type;
     piranha_assert(n.get_symbol_set().size() > 0u);
     piranha_assert(n.get_symbol_set() == d.get_symbol_set());
     piranha_assert(n.size() != 0u && d.size() != 0u);
-    using k_expo_type = typename k_monomial::value_type;
-    using expo_type = typename Key::value_type;
-    // Cache the args.
     const auto &args = n.get_symbol_set();
-    // Establish the limits of the two polynomials.
-    auto limits = poly_establish_limits(n, d);
-    // Extract just the vector of max exponents.
-    std::vector<expo_type> max_expos;
-    std::transform(limits.begin(), limits.end(), std::back_inserter(max_expos),
-                   [](const std::pair<expo_type, expo_type> &p) { return p.second; });
-    using me_size_type = decltype(max_expos.size());
-    // Next we need to check the limits of the codification. We do everything in multiprecision and
-    // then we will attempt to cast back.
-    std::vector<integer> mp_cv;
-    mp_cv.push_back(integer(1));
-    for (decltype(args.size()) i = 0u; i < args.size(); ++i) {
-        mp_cv.push_back(mp_cv.back() * (integer(1) + max_expos[static_cast<me_size_type>(i)]));
-    }
-    // Determine the max univariate expo.
-    integer mp_kM = poly_dot_product(max_expos.begin(), max_expos.end(), mp_cv.begin());
-    // Attempt casting everything down.
-    auto kM = static_cast<k_expo_type>(mp_kM);
-    (void)kM;
-    std::vector<k_expo_type> cv;
-    std::transform(mp_cv.begin(), mp_cv.end(), std::back_inserter(cv),
-                   [](const integer &z) { return static_cast<k_expo_type>(z); });
-    // Proceed to the codification.
-    auto encode_poly = [&args, &cv](const polynomial<Cf, Key> &p) -> polynomial<Cf, k_monomial> {
-        using term_type = typename polynomial<Cf, k_monomial>::term_type;
-        polynomial<Cf, k_monomial> retval;
-        // The only symbol will be the first symbol from the input polys.
-        symbol_set ss;
-        ss.add(*args.begin());
-        retval.set_symbol_set(ss);
-        // Prepare rehashed.
-        retval._container().rehash(p._container().bucket_count());
-        // Go with the codification.
-        std::vector<expo_type> tmp_expos;
+    const auto nv = static_cast<e_size_type>(args.size());
+    // Extract the exponents and establish the max exponents in each variable, checking for negative exponents.
+    auto extract = [&args, nv](const PType &p, std::vector<expo_type> &expos, std::vector<expo_type> &max) {
+        std::vector<expo_type> tmp;
+        expos.reserve(static_cast<e_size_type>(nv * p.size()));
         for (const auto &t : p._container()) {
-            // Extract the exponents.
-            t.m_key.extract_exponents(tmp_expos, args);
-            // NOTE: unique insertion?
-            retval.insert(term_type{t.m_cf, k_monomial(static_cast<k_expo_type>(
-                                                poly_dot_product(tmp_expos.begin(), tmp_expos.end(), cv.begin())))});
+            t.m_key.extract_exponents(tmp, args);
+            for (e_size_type i = 0u; i < nv; ++i) {
+                if (unlikely(tmp[i] < expo_type(0))) {
+                    piranha_throw(std::invalid_argument, "negative exponents are not allowed");
+                }
+            }
+            if (max.empty()) {
+                max = tmp;
+            } else {
+                for (e_size_type i = 0u; i < nv; ++i) {
+                    if (max[i] < tmp[i]) {
+                        max[i] = tmp[i];
+                    }
+                }
+            }
+            expos.insert(expos.end(), tmp.begin(), tmp.end());
         }
-        return retval;
     };
-    return std::make_tuple(encode_poly(n), encode_poly(d), cv);
+    std::vector<expo_type> n_expos, d_expos, n_max, d_max;
+    extract(n, n_expos, n_max);
+    extract(d, d_expos, d_max);
+    // The degree of the divisor in each variable cannot exceed the degree of the numerator.
+    for (e_size_type i = 0u; i < nv; ++i) {
+        if (n_max[i] < d_max[i]) {
+            piranha_throw(math::inexact_division, );
+        }
+    }
+    // Select the codification type.
+    integer c_range(1);
+    for (const auto &e : n_max) {
+        c_range *= integer(e) + 1;
+    }
+    if (c_range <= integer(std::numeric_limits<unsigned long long>::max())) {
+        return poly_heap_divexact_impl<unsigned long long>(n, d, n_expos, d_expos, n_max, d_max);
+    }
+    return poly_heap_divexact_impl<integer>(n, d, n_expos, d_expos, n_max, d_max);
 }
 
-// From univariate to multivariate. Preconditions:
-// - n has only 1 symbol,
-// - coding vector and args are consistent,
-// - non-empty poly.
-template <typename Key, typename Cf>
-inline polynomial<Cf, Key> poly_from_univariate(const polynomial<Cf, k_monomial> &n,
-                                                const std::vector<typename k_monomial::value_type> &cv,
-                                                const symbol_set &args)
+// Dense univariate division with remainder. r and d contain the coefficients of the numerator and of the denominator,
+// indexed by degree. On output, q will contain the coefficients of the quotient and the first d.size() - 1 elements
+// of r the coefficients of the remainder. Preconditions:
+// - d is not empty and its last element is not zero,
+// - r.size() >= d.size(),
+// - n_threads is not zero.
+// The quotient coefficients are computed in blocks: inside a block, only the part of the remainder needed by the
+// block itself is updated serially, the rest of the multiply-subtract step is then done in parallel, with each
+// thread owning a contiguous range of the remainder.
+template <typename Cf>
+inline void poly_udivrem_dense(std::vector<Cf> &r, const std::vector<Cf> &d, std::vector<Cf> &q, unsigned n_threads)
 {
-    piranha_assert(n.get_symbol_set().size() == 1u);
-    piranha_assert(cv.size() > 1u);
-    piranha_assert(args.size() == cv.size() - 1u);
-    piranha_assert(*n.get_symbol_set().begin() == *args.begin());
-    piranha_assert(n.size() != 0u);
-    using expo_type = typename Key::value_type;
-    using cv_size_type = decltype(cv.size());
-    auto decode_poly = [&args, &cv](const polynomial<Cf, k_monomial> &p) -> polynomial<Cf, Key> {
-        using term_type = typename polynomial<Cf, Key>::term_type;
-        // Init the return value.
-        polynomial<Cf, Key> retval;
-        retval.set_symbol_set(args);
-        retval._container().rehash(p._container().bucket_count());
-        // Go with the decodification.
-        std::vector<expo_type> tmp_expos;
-        using v_size_type = typename std::vector<expo_type>::size_type;
-        tmp_expos.resize(safe_cast<v_size_type>(args.size()));
-        for (const auto &t : p._container()) {
-            for (v_size_type i = 0u; i < tmp_expos.size(); ++i) {
-                // NOTE: use construction here rather than static_cast as expo_type could be integer.
-                tmp_expos[i] = expo_type((t.m_key.get_int() % cv[static_cast<cv_size_type>(i + 1u)])
-                                         / cv[static_cast<cv_size_type>(i)]);
+    using size_type = typename std::vector<Cf>::size_type;
+    piranha_assert(!d.empty() && !math::is_zero(d.back()));
+    piranha_assert(r.size() >= d.size());
+    piranha_assert(n_threads > 0u);
+    const auto dd = static_cast<size_type>(d.size() - 1u), qs = static_cast<size_type>(r.size() - dd);
+    const Cf &lc = d.back();
+    q.clear();
+    q.resize(qs);
+    // The negated quotient coefficients, used in the multiply-accumulate operations.
+    std::vector<Cf> nq(qs);
+    // The block size: with a single thread, we process the whole quotient in one block.
+    const size_type block_size = (n_threads == 1u) ? qs : std::min(qs, size_type(64u));
+    // Vector of thread indices, and dummy output vector for parallel_vector_transform().
+    std::vector<unsigned> t_idx(n_threads);
+    std::iota(t_idx.begin(), t_idx.end(), 0u);
+    std::vector<char> t_out(n_threads);
+    // The blocks are processed from the highest degree of the quotient.
+    for (size_type k_high = qs; k_high != 0u;) {
+        const auto k_low = static_cast<size_type>(k_high > block_size ? k_high - block_size : 0u);
+        // Serial phase: compute the quotient coefficients of the block, updating the remainder only
+        // in the region of degree not less than k_low + dd.
+        for (size_type k = k_high; k != k_low;) {
+            --k;
+            auto &c = r[static_cast<size_type>(k + dd)];
+            if (math::is_zero(c)) {
+                continue;
+            }
+            // NOTE: this will throw if the division is not exact.
+            math::divexact(q[k], c, lc);
+            nq[k] = -q[k];
+            c = Cf(0);
+            for (size_type j = (k_low + dd > k ? static_cast<size_type>(k_low + dd - k) : size_type(0u)); j < dd;
+                 ++j) {
+                math::multiply_accumulate(r[static_cast<size_type>(k + j)], nq[k], d[j]);
             }
-            retval.insert(term_type{t.m_cf, Key(tmp_expos.begin(), tmp_expos.end())});
         }
-        return retval;
-    };
-    return decode_poly(n);
+        // Multiply-subtract phase: update the remainder in the region [k_low, k_low + dd) with the contributions
+        // of all the quotient coefficients in the block.
+        const auto region = dd;
+        const auto n_t = static_cast<unsigned>(std::min(size_type(n_threads), std::max(region, size_type(1u))));
+        const auto t_size = static_cast<size_type>(region / n_t);
+        auto update = [&](unsigned t) -> char {
+            const auto m_begin = static_cast<size_type>(k_low + t * t_size),
+                       m_end = static_cast<size_type>(t == n_t - 1u ? k_low + region : m_begin + t_size);
+            for (auto m = m_begin; m < m_end; ++m) {
+                // Quotient coefficients k contributing to degree m: k_low <= k < k_high and m - dd <= k <= m.
+                const auto k_begin = static_cast<size_type>(m > dd && m - dd > k_low ? m - dd : k_low),
+                           k_end = std::min(k_high, static_cast<size_type>(m + 1u));
+                for (auto k = k_begin; k < k_end; ++k) {
+                    if (!math::is_zero(nq[k])) {
+                        math::multiply_accumulate(r[m], nq[k], d[static_cast<size_type>(m - k)]);
+                    }
+                }
+            }
+            return 0;
+        };
+        if (n_t == 1u) {
+            update(0u);
+        } else {
+            t_idx.resize(n_t);
+            t_out.resize(n_t);
+            parallel_vector_transform(n_t, t_idx, t_out, update);
+        }
+        k_high = k_low;
+    }
+    r.resize(dd);
 }
 
 // Exception to signal that heuristic GCD failed.
@@ -598,6 +822,296 @@ std::pair<bool, std::tuple<Poly, Poly, Poly>> gcdheu_geddes(const Poly &a, const
     return std::make_pair(true, std::make_tuple(Poly{}, Poly{}, Poly{}));
 }
 
+// Modular GCD of multivariate polynomials with integer coefficients, via the algorithms of Brown (dense)
+// and Zippel (sparse). The GCD G of the primitive parts of a and b is reconstructed from images modulo
+// word-sized primes, each image being the monic GCD in Z_p scaled by the GCD gamma of the leading coefficients
+// of a and b (so that the images are images of (gamma / lc(G)) * G). The images are combined via the Chinese
+// remainder theorem, and, when the reconstruction stabilises, its primitive part is validated via trial division.
+// Primes dividing the leading coefficients of a or b are skipped, images with a leading monomial larger than the
+// smallest one seen so far are discarded (unlucky primes), while a smaller leading monomial restarts the
+// reconstruction. With Zippel's algorithm, the first dense image provides the skeleton of the GCD, which is then
+// used to compute the subsequent images via sparse interpolation (falling back to the dense algorithm
+// for the primes in which the skeleton cannot be used).
+// The images are computed in parallel, either across primes (dense images) or across the evaluation points
+// of the sparse interpolation.
+// The mode parameter selects the algorithm: 0 for automatic selection, 1 for Brown, 2 for Zippel.
+// Like gcdheu_geddes(), this function returns a failure flag (true if the computation failed), and the GCD
+// with the cofactors.
+// Preconditions:
+// - identical symbol sets with at least one symbol,
+// - non-null input polys.
+template <typename Poly>
+std::pair<bool, std::tuple<Poly, Poly, Poly>> gcd_modular(const Poly &a, const Poly &b, int mode)
+{
+    using term_type = typename Poly::term_type;
+    using cf_type = typename term_type::cf_type;
+    using key_type = typename term_type::key_type;
+    using expo_type = typename key_type::value_type;
+    static_assert(is_mp_integer<cf_type>::value, "Invalid type.");
+    piranha_assert(a.get_symbol_set() == b.get_symbol_set());
+    piranha_assert(a.get_symbol_set().size() > 0u);
+    piranha_assert(a.size() != 0u && b.size() != 0u);
+    const auto &args = a.get_symbol_set();
+    const auto nv = safe_cast<unsigned>(args.size());
+    // The max degree in each variable beyond which the dense univariate images become unreasonably large.
+    const unsigned max_degree = 1u << 16;
+    std::vector<unsigned> degs(nv, 0u);
+    // Extract the exponents and the coefficients of a poly, sorted in decreasing lexicographic order.
+    auto extract = [&args, nv, &degs](const Poly &p, std::vector<unsigned> &expos, std::vector<cf_type> &cfs) {
+        std::vector<expo_type> tmp;
+        std::vector<unsigned> p_expos;
+        std::vector<const cf_type *> p_cfs;
+        p_expos.reserve(static_cast<std::vector<unsigned>::size_type>(p.size() * nv));
+        for (const auto &t : p._container()) {
+            t.m_key.extract_exponents(tmp, args);
+            for (unsigned i = 0u; i < nv; ++i) {
+                if (unlikely(tmp[i] < expo_type(0))) {
+                    piranha_throw(std::invalid_argument, "negative exponents are not allowed");
+                }
+                p_expos.push_back(safe_cast<unsigned>(tmp[i]));
+                degs[i] = std::max(degs[i], p_expos.back());
+            }
+            p_cfs.push_back(&t.m_cf);
+        }
+        std::vector<decltype(p_cfs.size())> perm(p_cfs.size());
+        std::iota(perm.begin(), perm.end(), decltype(p_cfs.size())(0u));
+        std::sort(perm.begin(), perm.end(), [&p_expos, nv](decltype(p_cfs.size()) i, decltype(p_cfs.size()) j) {
+            return std::lexicographical_compare(p_expos.data() + j * nv, p_expos.data() + (j + 1u) * nv,
+                                                p_expos.data() + i * nv, p_expos.data() + (i + 1u) * nv);
+        });
+        for (auto i : perm) {
+            expos.insert(expos.end(), p_expos.data() + i * nv, p_expos.data() + (i + 1u) * nv);
+            cfs.push_back(*p_cfs[i]);
+        }
+    };
+    std::vector<unsigned> a_expos, b_expos;
+    std::vector<cf_type> a_cfs, b_cfs;
+    extract(a, a_expos, a_cfs);
+    extract(b, b_expos, b_cfs);
+    if (std::any_of(degs.begin(), degs.end(), [max_degree](unsigned d) { return d > max_degree; })) {
+        return std::make_pair(true, std::tuple<Poly, Poly, Poly>{});
+    }
+    // Automatic selection: the sparse algorithm is used if the inputs fill a small fraction
+    // of the dense box defined by the degrees.
+    if (mode == 0) {
+        double box = 1.;
+        for (auto d : degs) {
+            box *= static_cast<double>(d) + 1.;
+        }
+        mode = (static_cast<double>(a.size() + b.size()) * 8. < box) ? 2 : 1;
+    }
+    // Contents (as non-negative values), and GCD of the leading coefficients of the primitive parts.
+    auto content = [](const std::vector<cf_type> &cfs) {
+        cf_type retval(0);
+        for (const auto &c : cfs) {
+            math::gcd3(retval, retval, c);
+        }
+        if (retval.sign() < 0) {
+            retval.negate();
+        }
+        return retval;
+    };
+    const auto a_cont = content(a_cfs), b_cont = content(b_cfs);
+    cf_type c(0), gamma(0), tmp(0);
+    math::gcd3(c, a_cont, b_cont);
+    math::divexact(tmp, a_cfs[0u], a_cont);
+    math::divexact(gamma, b_cfs[0u], b_cont);
+    math::gcd3(gamma, gamma, tmp);
+    // Reduction modulo p of a poly. The return value is empty if the leading coefficient vanishes.
+    auto reduce = [nv](const std::vector<unsigned> &expos, const std::vector<cf_type> &cfs, const cf_type &ip) {
+        mg_mpoly retval(nv);
+        cf_type r;
+        for (decltype(cfs.size()) i = 0u; i < cfs.size(); ++i) {
+            r = cfs[i] % ip;
+            if (r.sign() < 0) {
+                r += ip;
+            }
+            if (i == 0u && r.sign() == 0) {
+                break;
+            }
+            if (r.sign() != 0) {
+                retval.push_back(expos.data() + i * nv, static_cast<mg_uint>(r));
+            }
+        }
+        return retval;
+    };
+    // The skeleton for the sparse algorithm.
+    mg_mpoly sk(nv);
+    // Computation of an image. An empty return value signals an unusable prime.
+    auto image = [&](mg_uint p, unsigned n_threads) -> mg_mpoly {
+        const cf_type ip(p);
+        const mg_field f(p);
+        auto ap = reduce(a_expos, a_cfs, ip), bp = reduce(b_expos, b_cfs, ip);
+        if (ap.empty() || bp.empty()) {
+            return mg_mpoly(nv);
+        }
+        cf_type r = gamma % ip;
+        if (r.sign() < 0) {
+            r += ip;
+        }
+        const auto gp = static_cast<mg_uint>(r);
+        mg_mpoly retval(nv);
+        try {
+            if (mode == 2 && !sk.empty() && mg_zippel(f, ap, bp, sk, gp, retval, n_threads)) {
+                return retval;
+            }
+            retval = mg_brown(f, ap, bp, mode == 2, n_threads);
+        } catch (const mg_failure &) {
+            return mg_mpoly(nv);
+        }
+        for (auto &x : retval.m_cfs) {
+            x = f.mul(x, gp);
+        }
+        return retval;
+    };
+    // The reconstructed GCD, with its modulus.
+    std::vector<unsigned> h_expos;
+    std::vector<cf_type> h_cfs;
+    cf_type m(0);
+    const auto n_threads = thread_pool::use_threads(integer(a.size()) * b.size(),
+                                                    integer(settings::get_min_work_per_thread()));
+    mg_uint p = mg_uint(1) << 31;
+    // Safety limit on the number of primes employed.
+    unsigned n_primes = 0u;
+    while (true) {
+        // Select the primes. The dense images are computed in parallel across the primes, the sparse
+        // ones in parallel across the evaluation points.
+        const bool sparse = mode == 2 && !sk.empty();
+        std::vector<mg_uint> primes;
+        for (unsigned i = 0u; i < (sparse ? 1u : n_threads); ++i) {
+            p = mg_prev_prime(p);
+            if (p == 0u || ++n_primes > 4096u) {
+                return std::make_pair(true, std::tuple<Poly, Poly, Poly>{});
+            }
+            primes.push_back(p);
+        }
+        std::vector<mg_mpoly> images(primes.size());
+        if (sparse) {
+            images[0u] = image(primes[0u], n_threads);
+        } else {
+            parallel_vector_transform(static_cast<unsigned>(primes.size()), primes, images,
+                                      [&image](mg_uint q) { return image(q, 1u); });
+        }
+        for (decltype(images.size()) k = 0u; k < images.size(); ++k) {
+            const auto &img = images[k];
+            if (img.empty()) {
+                continue;
+            }
+            const mg_field f(primes[k]);
+            const auto half = primes[k] / 2u;
+            if (h_cfs.empty() || std::lexicographical_compare(img.expos(0u), img.expos(0u) + nv, h_expos.begin(),
+                                                              h_expos.begin() + nv)) {
+                // First image, or all the previous primes were unlucky: restart.
+                h_expos = img.m_expos;
+                h_cfs.clear();
+                for (auto x : img.m_cfs) {
+                    h_cfs.emplace_back(x);
+                    if (x > half) {
+                        h_cfs.back() -= primes[k];
+                    }
+                }
+                m = primes[k];
+                if (mode == 2) {
+                    sk = img;
+                }
+                continue;
+            }
+            if (!std::equal(img.expos(0u), img.expos(0u) + nv, h_expos.begin())) {
+                // Unlucky prime.
+                continue;
+            }
+            // Chinese remaindering, in the symmetric representation.
+            const cf_type ip(primes[k]);
+            cf_type r;
+            r = m % ip;
+            const mg_uint m_inv = f.inv(static_cast<mg_uint>(r));
+            const cf_type new_m = m * ip, half_m = new_m / 2;
+            std::vector<unsigned> new_expos;
+            std::vector<cf_type> new_cfs;
+            bool changed = false;
+            decltype(h_cfs.size()) i = 0u;
+            decltype(img.size()) j = 0u;
+            while (i < h_cfs.size() || j < img.size()) {
+                int cmp;
+                if (i == h_cfs.size()) {
+                    cmp = 1;
+                } else if (j == img.size()) {
+                    cmp = -1;
+                } else if (std::equal(h_expos.data() + i * nv, h_expos.data() + (i + 1u) * nv, img.expos(j))) {
+                    cmp = 0;
+                } else {
+                    cmp = std::lexicographical_compare(h_expos.data() + i * nv, h_expos.data() + (i + 1u) * nv,
+                                                       img.expos(j), img.expos(j) + nv)
+                              ? 1
+                              : -1;
+                }
+                cf_type hv = (cmp <= 0) ? std::move(h_cfs[i]) : cf_type(0);
+                const mg_uint iv = (cmp >= 0) ? img.m_cfs[j] : mg_uint(0u);
+                r = hv % ip;
+                if (r.sign() < 0) {
+                    r += ip;
+                }
+                const mg_uint u = f.mul(f.sub(iv, static_cast<mg_uint>(r)), m_inv);
+                if (u != 0u) {
+                    changed = true;
+                    math::multiply_accumulate(hv, m, cf_type(u));
+                    if (hv > half_m) {
+                        hv -= new_m;
+                    }
+                }
+                const unsigned *e = (cmp <= 0) ? h_expos.data() + i * nv : img.expos(j);
+                if (hv.sign() != 0) {
+                    new_expos.insert(new_expos.end(), e, e + nv);
+                    new_cfs.push_back(std::move(hv));
+                }
+                if (cmp <= 0) {
+                    ++i;
+                }
+                if (cmp >= 0) {
+                    ++j;
+                }
+            }
+            h_expos = std::move(new_expos);
+            h_cfs = std::move(new_cfs);
+            m = new_m;
+            if (changed) {
+                continue;
+            }
+            // The reconstruction is stable: build the primitive part of the candidate GCD, and check it via trial
+            // division.
+            Poly g;
+            g.set_symbol_set(args);
+            auto h_cont = content(h_cfs);
+            if (h_cfs[0u].sign() < 0) {
+                h_cont.negate();
+            }
+            std::vector<expo_type> tmp_expos(nv);
+            for (decltype(h_cfs.size()) l = 0u; l < h_cfs.size(); ++l) {
+                std::copy(h_expos.data() + l * nv, h_expos.data() + (l + 1u) * nv, tmp_expos.begin());
+                cf_type cf;
+                math::divexact(cf, h_cfs[l], h_cont);
+                g.insert(term_type{std::move(cf), key_type(tmp_expos.begin(), tmp_expos.end())});
+            }
+            try {
+                auto cf_a = poly_heap_divexact(a, g), cf_b = poly_heap_divexact(b, g);
+                // Rescale the GCD and the cofactors by the GCD of the contents.
+                poly_cf_mult(c, g);
+                poly_exact_cf_div(cf_a, c);
+                poly_exact_cf_div(cf_b, c);
+                return std::make_pair(false, std::make_tuple(std::move(g), std::move(cf_a), std::move(cf_b)));
+            } catch (const math::inexact_division &) {
+                // More primes are needed. If the sparse algorithm is in use, the skeleton might be wrong:
+                // restart the reconstruction using the dense algorithm.
+                if (mode == 2) {
+                    mode = 1;
+                    h_expos.clear();
+                    h_cfs.clear();
+                }
+            }
+        }
+    }
+}
+
 // Namespace for generic polynomial division enabler, used to stuff
 // in handy aliases. We put it here in order to share it with the enabler
 // for the divexact specialisation.
@@ -631,7 +1145,11 @@ enum class polynomial_gcd_algorithm {
     /// Subresultant PRS.
     prs_sr,
     /// Heuristic GCD.
-    heuristic
+    heuristic,
+    /// Brown's dense modular GCD.
+    brown,
+    /// Zippel's sparse modular GCD.
+    zippel
 };
 
 /// Polynomial class.
@@ -650,13 +1168,13 @@ enum class polynomial_gcd_algorithm {
  * This class satisfies the piranha::is_series and piranha::is_cf type traits.
  *
  * \warning
- * The division and GCD operations are known to have poor performance, especially with large operands. Performance
+ * The GCD operation is known to have poor performance, especially with large operands. Performance
  * will be improved in future versions.
  *
  * ## Type requirements ##
  *
  * \p Cf must be suitable for use in piranha::series as first template argument,
- * \p Key must be an instance of either piranha::monomial or piranha::kronecker_monomial.
+ * \p Key must be an instance of piranha::monomial, piranha::fixed_monomial or piranha::kronecker_monomial.
  *
  * ## Exception safety guarantee ##
  *
@@ -997,6 +1515,83 @@ class polynomial
         }
         return retval;
     }
+    // Univariate euclidean division via the dense kernel. The first member of the return value will be false
+    // if the dense representation of the operands is not suitable (that is, negative exponents or
+    // sparse operands), in which case the second member is empty. Preconditions:
+    // - univariate n and d in the same variable,
+    // - non-null n and d.
+    template <typename T>
+    static std::pair<bool, std::pair<polynomial, polynomial>> udivrem_dense(const T &n, const T &d)
+    {
+        using term_type = typename base::term_type;
+        using cf_type = typename term_type::cf_type;
+        using key_type = typename term_type::key_type;
+        using expo_type = typename key_type::value_type;
+        using v_size_type = typename std::vector<cf_type>::size_type;
+        const auto &args = n.get_symbol_set();
+        std::pair<bool, std::pair<polynomial, polynomial>> retval;
+        retval.first = false;
+        // Extract the degrees of the terms, and establish the degree of the polynomial.
+        std::vector<expo_type> tmp;
+        auto degrees = [&args, &tmp](const T &p, std::vector<integer> &degs, integer &max) -> bool {
+            degs.reserve(static_cast<std::vector<integer>::size_type>(p.size()));
+            for (const auto &t : p._container()) {
+                t.m_key.extract_exponents(tmp, args);
+                piranha_assert(tmp.size() == 1u);
+                degs.emplace_back(tmp[0u]);
+                if (degs.back().sign() < 0) {
+                    return false;
+                }
+                if (degs.back() > max) {
+                    max = degs.back();
+                }
+            }
+            return true;
+        };
+        std::vector<integer> n_degs, d_degs;
+        integer n_deg(0), d_deg(0);
+        if (!degrees(n, n_degs, n_deg) || !degrees(d, d_degs, d_deg)) {
+            return retval;
+        }
+        // Use the dense representation only if the operands are not too sparse.
+        if (n_deg >= (integer(n.size()) + d.size()) * 16 + 64) {
+            return retval;
+        }
+        retval.first = true;
+        auto &q = retval.second.first, &r = retval.second.second;
+        q.set_symbol_set(args);
+        r.set_symbol_set(args);
+        if (n_deg < d_deg) {
+            r = n;
+            return retval;
+        }
+        // Dense copies of the operands.
+        std::vector<cf_type> r_cfs(static_cast<v_size_type>(n_deg + 1)), d_cfs(static_cast<v_size_type>(d_deg + 1)),
+            q_cfs;
+        auto it = n_degs.begin();
+        for (const auto &t : n._container()) {
+            r_cfs[static_cast<v_size_type>(*it++)] = t.m_cf;
+        }
+        it = d_degs.begin();
+        for (const auto &t : d._container()) {
+            d_cfs[static_cast<v_size_type>(*it++)] = t.m_cf;
+        }
+        // The number of threads is determined by the amount of work in each block of the kernel.
+        const auto n_threads = thread_pool::use_threads(integer(d_cfs.size()) * 64,
+                                                        integer(settings::get_min_work_per_thread()));
+        detail::poly_udivrem_dense(r_cfs, d_cfs, q_cfs, n_threads);
+        // Build the output polynomials.
+        auto build = [](polynomial &p, std::vector<cf_type> &cfs) {
+            for (v_size_type i = 0u; i < cfs.size(); ++i) {
+                if (!math::is_zero(cfs[i])) {
+                    p.insert(term_type{std::move(cfs[i]), key_type{static_cast<expo_type>(i)}});
+                }
+            }
+        };
+        build(q, q_cfs);
+        build(r, r_cfs);
+        return retval;
+    }
     // Univariate euclidean division.
     template <bool CheckExpos, typename T>
     static std::pair<polynomial, polynomial> udivrem_impl(const T &n, const T &d)
@@ -1027,6 +1622,13 @@ class polynomial
             detail::poly_expo_checker(n);
             detail::poly_expo_checker(d);
         }
+        // Try the dense kernel first.
+        {
+            auto res = udivrem_dense(n, d);
+            if (res.first) {
+                return std::move(res.second);
+            }
+        }
         // Initialisation: quotient is empty, remainder is the numerator.
         polynomial q, r(n);
         q.set_symbol_set(args);
@@ -1072,20 +1674,8 @@ class polynomial
     {
         static_assert(std::is_same<T, polynomial>::value, "Invalid type.");
         using term_type = typename polynomial::term_type;
-        using expo_type = typename term_type::key_type::value_type;
         // Cache it.
         const auto &args = n.get_symbol_set();
-        // Univariate case.
-        if (args.size() == 1u) {
-            // NOTE: udivrem contains the check for negative exponents, zero n/d, etc.
-            auto res = polynomial::udivrem(n, d);
-            if (res.second.size() != 0u) {
-                piranha_throw(math::inexact_division, );
-            }
-            return std::move(res.first);
-        }
-        // Multivariate or zerovariate case.
-        // NOTE: here we need to check a few things as the mapping to univariate has certain prereqs.
         // First we check if n or d are zero.
         if (d.size() == 0u) {
             piranha_throw(zero_division_error, "polynomial division by zero");
@@ -1095,8 +1685,7 @@ class polynomial
             retval.set_symbol_set(args);
             return retval;
         }
-        // Deal with the case in which the number of arguments is zero. We need to do it here as the mapping
-        // requires at least 1 var.
+        // Deal with the case in which the number of arguments is zero.
         if (args.size() == 0u) {
             piranha_assert(n.size() == 1u && d.size() == 1u);
             piranha_assert(n.is_single_coefficient() && d.is_single_coefficient());
@@ -1107,44 +1696,9 @@ class polynomial
             retval.insert(term_type{std::move(tmp_cf), Key(args)});
             return retval;
         }
-        // Map to univariate.
-        auto umap = detail::poly_to_univariate(n, d);
-        // Do the univariate division.
-        // NOTE: need to call udivrem_impl from the mapped univariate type.
-        // NOTE: the check for negative exponents is done in the mapping.
-        auto ures = std::get<0u>(umap).template udivrem_impl<false>(std::get<0u>(umap), std::get<1u>(umap));
-        // Check if the division was exact.
-        if (ures.second.size() != 0u) {
-            piranha_throw(math::inexact_division, );
-        }
-        // Map back to multivariate.
-        auto retval = detail::poly_from_univariate<Key>(ures.first, std::get<2u>(umap), args);
-        // Final check: for each variable, the degree of retval + degree of d must be equal to the degree of n.
-        auto degree_vector_extractor = [&args](const polynomial &p) -> std::vector<expo_type> {
-            std::vector<expo_type> ret, tmp;
-            // Init with the first term of the polynomial.
-            piranha_assert(p.size() != 0u);
-            auto it = p._container().begin();
-            it->m_key.extract_exponents(ret, args);
-            ++it;
-            for (; it != p._container().end(); ++it) {
-                it->m_key.extract_exponents(tmp, args);
-                for (decltype(tmp.size()) i = 0u; i < tmp.size(); ++i) {
-                    if (tmp[i] > ret[i]) {
-                        ret[i] = tmp[i];
-                    }
-                }
-            }
-            return ret;
-        };
-        const auto n_dv = degree_vector_extractor(n), d_dv = degree_vector_extractor(d),
-                   r_dv = degree_vector_extractor(retval);
-        for (decltype(n_dv.size()) i = 0u; i < n_dv.size(); ++i) {
-            if (integer(n_dv[i]) != integer(d_dv[i]) + integer(r_dv[i])) {
-                piranha_throw(math::inexact_division, );
-            }
-        }
-        return retval;
+        // Univariate and multivariate cases: sparse heap division.
+        // NOTE: the check for negative exponents is done in the division routine.
+        return detail::poly_heap_divexact(n, d);
     }
     // Enabler for exact poly division.
     // NOTE: the further constraining here that T must be polynomial is to work around a GCC < 5 (?) bug,
@@ -1225,6 +1779,34 @@ class polynomial
         }
         return std::make_pair(true, std::tuple<T, T, T>{});
     }
+    // Wrapper around the modular GCD algorithms. It will return false,tuple if the calculation went well,
+    // true,tuple if the modular algorithms are not applicable (zero or zerovariate polynomials, univariate
+    // polynomials with automatic selection) or if the computation failed. If run on polynomials with
+    // non-integer coefficients, or in case of failure, it will throw if a modular algorithm was explicitly requested.
+    template <typename T, typename std::enable_if<detail::is_mp_integer<cf_t<T>>::value, int>::type = 0>
+    static std::pair<bool, std::tuple<T, T, T>> try_gcd_modular(const T &a, const T &b, polynomial_gcd_algorithm algo)
+    {
+        if (a.get_symbol_set().size() == 0u || a.size() == 0u || b.size() == 0u
+            || (algo == polynomial_gcd_algorithm::automatic && a.get_symbol_set().size() == 1u)) {
+            return std::make_pair(true, std::tuple<T, T, T>{});
+        }
+        auto retval = detail::gcd_modular(
+            a, b, algo == polynomial_gcd_algorithm::brown ? 1 : (algo == polynomial_gcd_algorithm::zippel ? 2 : 0));
+        if (retval.first && algo != polynomial_gcd_algorithm::automatic) {
+            piranha_throw(std::runtime_error, "a modular polynomial GCD algorithm was explicitly selected, "
+                                              "but its execution failed");
+        }
+        return retval;
+    }
+    template <typename T, typename std::enable_if<!detail::is_mp_integer<cf_t<T>>::value, int>::type = 0>
+    static std::pair<bool, std::tuple<T, T, T>> try_gcd_modular(const T &, const T &, polynomial_gcd_algorithm algo)
+    {
+        if (algo == polynomial_gcd_algorithm::brown || algo == polynomial_gcd_algorithm::zippel) {
+            piranha_throw(std::runtime_error, "a modular polynomial GCD algorithm was explicitly selected, "
+                                              "but it cannot be applied to non-integral coefficients");
+        }
+        return std::make_pair(true, std::tuple<T, T, T>{});
+    }
     // This is a wrapper to compute and return the cofactors, together with the GCD, when the PRS algorithm
     // is used (the gcdheu algorithm already computes the cofactors).
     template <typename T, typename U>
@@ -1278,15 +1860,375 @@ class polynomial
             return runner(p1, copy_2);
         }
     }
-    // Helper function to clear the pow cache when a new auto truncation limit is set.
+    // Helper function to clear the pow and product caches when a new auto truncation limit is set.
     template <typename T>
     static void truncation_clear_pow_cache(int mode, const T &max_degree, const std::vector<std::string> &names)
     {
-        // The pow cache is cleared only if we are actually changing the truncation settings.
+        // The caches are cleared only if we are actually changing the truncation settings.
         if (s_at_degree_mode != mode || get_at_degree_max() != max_degree || names != s_at_degree_names) {
             polynomial::clear_pow_cache();
+            truncation_clear_product_cache(0);
+        }
+    }
+    // The product cache is available only if the product of two polynomials is a polynomial of the same type.
+    template <typename T = polynomial>
+    static auto truncation_clear_product_cache(int) -> decltype(T::clear_product_cache())
+    {
+        T::clear_product_cache();
+    }
+    static void truncation_clear_product_cache(...)
+    {
+    }
+    // Type of the exponents extracted during composition.
+    template <typename T>
+    using compose_exp_type = typename std::decay<decltype(
+        std::declval<const typename T::term_type::key_type &>()
+            .subs_split(std::declval<const std::string &>(), std::declval<const symbol_set &>())
+            .first)>::type;
+    // Enabler for composition.
+    template <typename T>
+    using compose_enabler = typename std::enable_if<
+        std::is_same<decltype(std::declval<const T &>().subs(std::declval<const std::string &>(),
+                                                             std::declval<const T &>())),
+                     T>::value
+            && std::is_same<T, decltype(std::declval<const T &>() * std::declval<const T &>())>::value
+            && detail::key_has_single_subs_split<typename T::term_type::key_type>::value
+            && has_safe_cast<integer, compose_exp_type<T>>::value
+            && detail::true_tt<at_degree_enabler<T>>::value,
+        int>::type;
+    // Truncate p according to the auto-truncation settings t.
+    template <typename T>
+    static void compose_truncate(polynomial &p, const T &t)
+    {
+        if (std::get<0u>(t) == 1) {
+            p = p.truncate_degree(std::get<1u>(t));
+        } else if (std::get<0u>(t) == 2) {
+            p = p.truncate_degree(std::get<1u>(t), std::get<2u>(t));
         }
     }
+    // Detect if the Newton iteration in pow() is available: the exponent must be integral or rational, the result
+    // must be of the calling type, the degree must be integral, and the algorithm outlined in
+    // newton_pow() must be supported by the involved types.
+    template <typename T, typename Series, typename = void>
+    struct has_newton_pow : std::false_type {
+    };
+    template <typename T, typename Series>
+    struct has_newton_pow<
+        T, Series,
+        typename std::enable_if<
+            (std::is_integral<T>::value || detail::is_mp_integer<T>::value || detail::is_mp_rational<T>::value)
+            && std::is_same<pow_ret_type<T, Series>, Series>::value
+            && detail::true_tt<tm_enabler<Series, integer>>::value
+            && (std::is_integral<degree_type<Series>>::value || detail::is_mp_integer<degree_type<Series>>::value)
+            && std::is_constructible<Cf, decltype(math::pow(std::declval<const Cf &>(),
+                                                            std::declval<const rational &>()))>::value
+            && is_divisible_in_place<Series, integer>::value>::type> : std::true_type {
+    };
+    // Multiplicative inversion of the leading coefficient is possible in integral coefficient types
+    // only if the coefficient is unitary, and roots of integral coefficients are not supported.
+    template <typename T>
+    using newton_integral_cf
+        = std::integral_constant<bool, std::is_integral<T>::value || detail::is_mp_integer<T>::value>;
+    template <typename T, typename std::enable_if<newton_integral_cf<T>::value, int>::type = 0>
+    static bool newton_cf_check(const T &c, const integer &q)
+    {
+        return q == 1 && (math::is_unitary(c) || math::is_unitary(-c));
+    }
+    template <typename T, typename std::enable_if<!newton_integral_cf<T>::value, int>::type = 0>
+    static bool newton_cf_check(const T &, const integer &)
+    {
+        return true;
+    }
+    // Exponentiation to a negative integral or a non-integral rational power via Newton iteration, in the presence of
+    // auto-truncation. The first member of the return value will be false if the algorithm is not applicable (in which
+    // case the second member is empty). The algorithm computes r = this**(-1/q) via the iteration
+    // r <- r + r * (1 - this * r**q) / q, which doubles the number of correct degrees at each step. The result
+    // is then this**(p/q) = r**(-p) if p < 0, and this**m * r**(q*m - p) with m = ceil(p/q) otherwise. The series
+    // must contain a constant term and no terms of negative degree.
+    template <typename T, typename Series = polynomial,
+              typename std::enable_if<has_newton_pow<T, Series>::value, int>::type = 0>
+    std::pair<bool, polynomial> newton_pow(const T &x) const
+    {
+        using dt = degree_type<Series>;
+        std::pair<bool, polynomial> retval{false, polynomial{}};
+        const auto at = get_auto_truncate_degree();
+        const int mode = std::get<0u>(at);
+        const auto &names = std::get<2u>(at);
+        if (mode == 0 || this->size() < 2u) {
+            return retval;
+        }
+        const rational e(x);
+        const integer &p = e.num(), &q = e.den();
+        if (q == 1 && p.sign() >= 0) {
+            // Non-negative integral powers are handled by the base pow().
+            return retval;
+        }
+        // Check the degrees and the constant term.
+        const auto ld = (mode == 1) ? this->ldegree() : this->ldegree(names);
+        if (ld < dt(0)) {
+            return retval;
+        }
+        auto trunc = [mode, &names](const polynomial &a, const integer &d) -> polynomial {
+            return (mode == 1) ? a.truncate_degree(safe_cast<dt>(d)) : a.truncate_degree(safe_cast<dt>(d), names);
+        };
+        const auto c = trunc(*this, integer(0));
+        if (c.size() != 1u || !c._container().begin()->m_key.is_unitary(this->m_symbol_set)
+            || !newton_cf_check(c._container().begin()->m_cf, q)) {
+            return retval;
+        }
+        retval.first = true;
+        retval.second.set_symbol_set(this->m_symbol_set);
+        const integer max_degree(std::get<1u>(at));
+        if (max_degree.sign() < 0) {
+            // All the terms of the result would be truncated.
+            return retval;
+        }
+        auto mult = [mode, &names](const polynomial &a, const polynomial &b, const integer &d) -> polynomial {
+            return (mode == 1) ? truncated_multiplication(a, b, d) : truncated_multiplication(a, b, d, names);
+        };
+        auto ipow = [&mult](const polynomial &a, integer n, const integer &d) -> polynomial {
+            polynomial res{1}, base(a);
+            while (true) {
+                if (n % 2 != 0) {
+                    res = mult(res, base, d);
+                }
+                n /= 2;
+                if (n.sign() == 0) {
+                    break;
+                }
+                base = mult(base, base, d);
+            }
+            return res;
+        };
+        // Initial value: the inverse q-th root of the constant term, correct up to degree 0.
+        polynomial r{Cf(math::pow(c._container().begin()->m_cf, rational(-1, q)))};
+        for (integer prec(1); prec <= max_degree;) {
+            prec = (prec * 2 > max_degree + 1) ? max_degree + 1 : prec * 2;
+            const integer d = prec - 1;
+            // NOTE: the terms of degree lower than the previous precision cancel out in err.
+            auto err = 1 - mult(trunc(*this, d), ipow(r, q, d), d);
+            auto delta = mult(r, err, d);
+            if (q != 1) {
+                delta /= q;
+            }
+            r += delta;
+        }
+        if (p.sign() < 0) {
+            retval.second = ipow(r, -p, max_degree);
+        } else {
+            const integer m = (p + q - 1) / q;
+            retval.second = mult(ipow(trunc(*this, max_degree), m, max_degree), ipow(r, q * m - p, max_degree),
+                                 max_degree);
+        }
+        return retval;
+    }
+    template <typename T, typename Series = polynomial,
+              typename std::enable_if<!has_newton_pow<T, Series>::value, int>::type = 0>
+    std::pair<bool, pow_ret_type<T, Series>> newton_pow(const T &) const
+    {
+        return std::make_pair(false, pow_ret_type<T, Series>{});
+    }
+
+    // Detect if the truncated elementary functions (exp(), log(), sin() and cos()) are available: the series must
+    // support truncated and untruncated multiplication, and division by integers and coefficients, the degree must be
+    // integral, and the coefficient type must be a non-integral type without a degree (so that the degree of a term
+    // is the degree of its key).
+    template <typename Series, typename = void>
+    struct has_elementary : std::false_type {
+    };
+    template <typename Series>
+    struct has_elementary<
+        Series, typename std::enable_if<
+                    detail::true_tt<tm_enabler<Series, integer>>::value && detail::true_tt<um_enabler<Series>>::value
+                    && (std::is_integral<degree_type<Series>>::value
+                        || detail::is_mp_integer<degree_type<Series>>::value)
+                    && !newton_integral_cf<typename Series::term_type::cf_type>::value
+                    && !has_degree<typename Series::term_type::cf_type>::value
+                    && is_multipliable_in_place<Series, integer>::value && is_divisible_in_place<Series, integer>::value
+                    && is_divisible_in_place<Series, typename Series::term_type::cf_type>::value>::type>
+        : std::true_type {
+    };
+    // Enabler for the elementary function F: F must map the coefficient type to itself.
+    template <typename Series, typename F>
+    using elementary_enabler = typename std::enable_if<
+        has_elementary<Series>::value && std::is_same<typename Series::term_type::cf_type, F>::value, int>::type;
+    // The elementary functions are computed in the presence of auto-truncation from the ODEs
+    // E(exp(f)) = exp(f)E(f), E(log(f)) = E(f)/f, E(sin(f)) = cos(f)E(f) and E(cos(f)) = -sin(f)E(f), where E is
+    // the Euler operator relative to the truncation degree (i.e., the operator multiplying each term by its total or
+    // partial degree). E is a derivation which multiplies the homogeneous component of degree k by k, hence the ODEs
+    // become recurrences on the homogeneous components of the result, which are filled in degree by degree. Each
+    // product between components appears once, and the total cost is that of a single truncated multiplication
+    // of the input by the result (two for sine and cosine).
+    // This function splits this into its homogeneous components up to the truncation degree. The return value is
+    // false if the algorithm is not applicable: no auto-truncation, single-coefficient series, terms of negative
+    // degree or a component of degree zero which is not a constant. If all the terms of the result would be
+    // truncated, the output vector will be empty.
+    bool elementary_split(std::vector<polynomial> &comps, std::size_t &n) const
+    {
+        using dt = degree_type<polynomial>;
+        comps.clear();
+        n = 0u;
+        const auto at = get_auto_truncate_degree();
+        const int mode = std::get<0u>(at);
+        const auto &names = std::get<2u>(at);
+        if (mode == 0 || this->is_single_coefficient()) {
+            return false;
+        }
+        if (((mode == 1) ? this->ldegree() : this->ldegree(names)) < dt(0)) {
+            return false;
+        }
+        const integer max_degree(std::get<1u>(at));
+        if (max_degree.sign() < 0) {
+            return true;
+        }
+        n = safe_cast<std::size_t>(max_degree);
+        const integer sdegree((mode == 1) ? this->degree() : this->degree(names));
+        comps.resize(safe_cast<std::size_t>(std::min(sdegree, max_degree)) + 1u);
+        for (auto &c : comps) {
+            c.set_symbol_set(this->m_symbol_set);
+        }
+        const symbol_set::positions p(this->m_symbol_set, symbol_set(names.begin(), names.end()));
+        for (const auto &t : this->m_container) {
+            const integer d((mode == 1) ? detail::ps_get_degree(t, this->m_symbol_set)
+                                        : detail::ps_get_degree(t, names, p, this->m_symbol_set));
+            if (d <= max_degree) {
+                comps[static_cast<std::size_t>(d)].insert(t);
+            }
+        }
+        return comps[0].is_single_coefficient();
+    }
+    // Constant of the component of degree zero.
+    static Cf elementary_cf0(const std::vector<polynomial> &comps)
+    {
+        return comps[0].empty() ? Cf(0) : comps[0]._container().begin()->m_cf;
+    }
+    // Constant polynomial with the symbol set of this.
+    polynomial elementary_constant(const Cf &c) const
+    {
+        polynomial retval;
+        retval.set_symbol_set(this->m_symbol_set);
+        retval.insert(typename base::term_type(c, Key(this->m_symbol_set)));
+        return retval;
+    }
+    // Degrees of the non-empty components of positive degree, in ascending order.
+    static std::vector<std::size_t> elementary_nz(const std::vector<polynomial> &comps)
+    {
+        std::vector<std::size_t> retval;
+        for (std::size_t j = 1u; j < comps.size(); ++j) {
+            if (!comps[j].empty()) {
+                retval.push_back(j);
+            }
+        }
+        return retval;
+    }
+    // Components of E(f) (the component of degree zero is left empty).
+    static std::vector<polynomial> elementary_euler(const std::vector<polynomial> &comps,
+                                                    const std::vector<std::size_t> &nz)
+    {
+        std::vector<polynomial> retval(comps.size());
+        for (auto j : nz) {
+            retval[j] = comps[j];
+            retval[j] *= integer(j);
+        }
+        return retval;
+    }
+    // Sum of the components of a series.
+    polynomial elementary_sum(std::vector<polynomial> &comps) const
+    {
+        polynomial retval;
+        retval.set_symbol_set(this->m_symbol_set);
+        for (auto &c : comps) {
+            retval += std::move(c);
+        }
+        return retval;
+    }
+    // Truncated exp(f): k*h_k = sum_j (j*f_j)*h_(k-j).
+    polynomial elementary_exp(const std::vector<polynomial> &comps, std::size_t n) const
+    {
+        const auto nz = elementary_nz(comps);
+        const auto ef = elementary_euler(comps, nz);
+        std::vector<polynomial> h(n + 1u);
+        h[0] = elementary_constant(math::exp(elementary_cf0(comps)));
+        for (std::size_t k = 1u; k <= n; ++k) {
+            h[k].set_symbol_set(this->m_symbol_set);
+            for (auto j : nz) {
+                if (j > k) {
+                    break;
+                }
+                if (!h[k - j].empty()) {
+                    h[k] += untruncated_multiplication(ef[j], h[k - j]);
+                }
+            }
+            if (!h[k].empty()) {
+                h[k] /= integer(k);
+            }
+        }
+        return elementary_sum(h);
+    }
+    // Truncated log(f): k*f_0*l_k = k*f_k - sum_(j<k) (j*l_j)*f_(k-j).
+    polynomial elementary_log(const std::vector<polynomial> &comps, std::size_t n) const
+    {
+        const Cf c0 = elementary_cf0(comps);
+        if (math::is_zero(c0)) {
+            piranha_throw(zero_division_error, "cannot compute the logarithm of a series without constant term");
+        }
+        const auto nz = elementary_nz(comps);
+        // el will contain the components of E(log(f)).
+        std::vector<polynomial> l(n + 1u), el(n + 1u);
+        l[0] = elementary_constant(math::log(c0));
+        for (std::size_t k = 1u; k <= n; ++k) {
+            el[k].set_symbol_set(this->m_symbol_set);
+            for (auto i : nz) {
+                if (i >= k) {
+                    break;
+                }
+                if (!el[k - i].empty()) {
+                    el[k] -= untruncated_multiplication(el[k - i], comps[i]);
+                }
+            }
+            if (k < comps.size()) {
+                el[k] += comps[k] * integer(k);
+            }
+            if (!el[k].empty()) {
+                el[k] /= c0;
+                l[k] = el[k];
+                l[k] /= integer(k);
+            }
+        }
+        return elementary_sum(l);
+    }
+    // Truncated sin(f) and cos(f): k*s_k = sum_j (j*f_j)*c_(k-j), k*c_k = -sum_j (j*f_j)*s_(k-j).
+    std::pair<polynomial, polynomial> elementary_sin_cos(const std::vector<polynomial> &comps, std::size_t n) const
+    {
+        const auto nz = elementary_nz(comps);
+        const auto ef = elementary_euler(comps, nz);
+        std::vector<polynomial> s(n + 1u), c(n + 1u);
+        const Cf c0 = elementary_cf0(comps);
+        s[0] = elementary_constant(math::sin(c0));
+        c[0] = elementary_constant(math::cos(c0));
+        for (std::size_t k = 1u; k <= n; ++k) {
+            s[k].set_symbol_set(this->m_symbol_set);
+            c[k].set_symbol_set(this->m_symbol_set);
+            for (auto j : nz) {
+                if (j > k) {
+                    break;
+                }
+                if (!c[k - j].empty()) {
+                    s[k] += untruncated_multiplication(ef[j], c[k - j]);
+                }
+                if (!s[k - j].empty()) {
+                    c[k] -= untruncated_multiplication(ef[j], s[k - j]);
+                }
+            }
+            if (!s[k].empty()) {
+                s[k] /= integer(k);
+            }
+            if (!c[k].empty()) {
+                c[k] /= integer(k);
+            }
+        }
+        return std::make_pair(elementary_sum(s), elementary_sum(c));
+    }
 
 public:
     /// Series rebind alias.
@@ -1346,6 +2288,14 @@ public:
      * key. In that case, the return polynomial will consist of a single term with coefficient computed via
      * piranha::math::pow() and key computed via the monomial exponentiation method.
      *
+     * If the degree-based auto-truncation is active, \p x is a negative integer or a non-integral rational
+     * \f$p/q\f$, and \p this has a constant term and no terms of negative (partial) degree, the result is computed
+     * as a truncated power series via Newton iteration: \f$r=\mathrm{this}^{-1/q}\f$ is refined with
+     * \f$r \leftarrow r + r\left(1-\mathrm{this}\cdot r^q\right)/q\f$, doubling the number of correct degrees at each
+     * step, and the result is then assembled from powers of \f$r\f$ and \p this. All the multiplications are
+     * truncated. This covers, e.g., inversion (\f$x=-1\f$) and square roots (\f$x=1/2\f$). With integral
+     * coefficients, only inversion is supported, and the constant term must be \f$\pm1\f$.
+     *
      * Otherwise, the base (i.e., default) exponentiation method will be used.
      *
      * @param[in] x exponent.
@@ -1354,6 +2304,7 @@ public:
      *
      * @throws unspecified any exception thrown by:
      * - the <tt>is_unitary()</tt> and exponentiation methods of the key type,
+     * - get_auto_truncate_degree(), truncated_multiplication() and piranha::power_series::truncate_degree(),
      * - piranha::math::pow(),
      * - construction of coefficient, key and term,
      * - the copy assignment operator of piranha::symbol_set,
@@ -1374,6 +2325,10 @@ public:
             retval.insert(term_type(std::move(cf), std::move(key)));
             return retval;
         }
+        auto newton = newton_pow<T, Series>(x);
+        if (newton.first) {
+            return std::move(newton.second);
+        }
         return static_cast<series<Cf, Key, polynomial<Cf, Key>> const *>(this)->pow(x);
     }
     /// Inversion.
@@ -1391,6 +2346,137 @@ public:
     {
         return this->pow(-1);
     }
+    /// Exponential.
+    /**
+     * \note
+     * This method is enabled only if the coefficient type is not integral, it has no degree, it supports
+     * piranha::math::exp() returning the coefficient type itself, and the algorithm described below is supported
+     * by all the involved types.
+     *
+     * If the degree-based auto-truncation is active, \p this is not single-coefficient and it has no terms of
+     * negative (partial) degree, and the homogeneous component of degree zero of \p this is a constant \f$c\f$,
+     * the result is computed as a truncated power series. The components of the result are determined degree by
+     * degree from the differential equation \f$E\left(e^f\right)=e^fE\left(f\right)\f$, where \f$E\f$ is the
+     * operator multiplying each term by its (partial) degree, starting from \f$e^c\f$. The overall cost is that of a
+     * single truncated multiplication.
+     *
+     * Otherwise, the exponential is computed via piranha::math::exp() on the coefficient of a single-coefficient
+     * polynomial.
+     *
+     * @return the exponential of \p this.
+     *
+     * @throws std::invalid_argument if the truncated algorithm is not applicable and \p this is not
+     * single-coefficient.
+     * @throws unspecified any exception thrown by:
+     * - get_auto_truncate_degree(), untruncated_multiplication() and piranha::power_series::ldegree(),
+     * - piranha::math::exp(),
+     * - the arithmetic operators of piranha::polynomial,
+     * - construction of coefficient, key and term, and piranha::series::insert(),
+     * - memory errors in standard containers.
+     */
+    template <typename Series = polynomial,
+              elementary_enabler<Series, detail::math_exp_type<typename Series::term_type::cf_type>> = 0>
+    polynomial exp() const
+    {
+        std::vector<polynomial> comps;
+        std::size_t n;
+        if (elementary_split(comps, n)) {
+            return comps.empty() ? elementary_sum(comps) : elementary_exp(comps, n);
+        }
+        return detail::apply_cf_functor<detail::series_cf_exp_functor, polynomial>(*this);
+    }
+    /// Natural logarithm.
+    /**
+     * \note
+     * This method is enabled only if the coefficient type is not integral, it has no degree, it supports
+     * piranha::math::log() returning the coefficient type itself, and the algorithm described below is supported
+     * by all the involved types.
+     *
+     * The behaviour of this method is analogous to piranha::polynomial::exp(). In the presence of auto-truncation,
+     * the components of the result are determined from \f$f\cdot E\left(\log f\right)=E\left(f\right)\f$, starting
+     * from \f$\log c\f$.
+     *
+     * @return the natural logarithm of \p this.
+     *
+     * @throws piranha::zero_division_error if the truncated algorithm is applicable and \f$c\f$ is zero.
+     * @throws std::invalid_argument if the truncated algorithm is not applicable and \p this is not
+     * single-coefficient.
+     * @throws unspecified any exception thrown by:
+     * - get_auto_truncate_degree(), untruncated_multiplication() and piranha::power_series::ldegree(),
+     * - piranha::math::log(),
+     * - the arithmetic operators of piranha::polynomial,
+     * - construction of coefficient, key and term, and piranha::series::insert(),
+     * - memory errors in standard containers.
+     */
+    template <typename Series = polynomial,
+              elementary_enabler<Series, detail::math_log_type<typename Series::term_type::cf_type>> = 0>
+    polynomial log() const
+    {
+        std::vector<polynomial> comps;
+        std::size_t n;
+        if (elementary_split(comps, n)) {
+            return comps.empty() ? elementary_sum(comps) : elementary_log(comps, n);
+        }
+        return detail::apply_cf_functor<detail::series_cf_log_functor, polynomial>(*this);
+    }
+    /// Sine.
+    /**
+     * \note
+     * This method is enabled only if the coefficient type is not integral, it has no degree, it supports
+     * piranha::math::sin() and piranha::math::cos() returning the coefficient type itself, and the algorithm
+     * described below is supported by all the involved types.
+     *
+     * The behaviour of this method is analogous to piranha::polynomial::exp(). In the presence of auto-truncation,
+     * the sine and the cosine of \p this are computed together from the coupled differential equations
+     * \f$E\left(\sin f\right)=\cos f\cdot E\left(f\right)\f$ and
+     * \f$E\left(\cos f\right)=-\sin f\cdot E\left(f\right)\f$.
+     *
+     * @return the sine of \p this.
+     *
+     * @throws std::invalid_argument if the truncated algorithm is not applicable and \p this is not
+     * single-coefficient.
+     * @throws unspecified any exception thrown by:
+     * - get_auto_truncate_degree(), untruncated_multiplication() and piranha::power_series::ldegree(),
+     * - piranha::math::sin() and piranha::math::cos(),
+     * - the arithmetic operators of piranha::polynomial,
+     * - construction of coefficient, key and term, and piranha::series::insert(),
+     * - memory errors in standard containers.
+     */
+    template <typename Series = polynomial,
+              elementary_enabler<Series, detail::math_sin_type<typename Series::term_type::cf_type>> = 0,
+              elementary_enabler<Series, detail::math_cos_type<typename Series::term_type::cf_type>> = 0>
+    polynomial sin() const
+    {
+        std::vector<polynomial> comps;
+        std::size_t n;
+        if (elementary_split(comps, n)) {
+            return comps.empty() ? elementary_sum(comps) : elementary_sin_cos(comps, n).first;
+        }
+        return detail::apply_cf_functor<detail::series_cf_sin_functor, polynomial>(*this);
+    }
+    /// Cosine.
+    /**
+     * \note
+     * This method is enabled only if piranha::polynomial::sin() is enabled.
+     *
+     * This method works in the same way as piranha::polynomial::sin().
+     *
+     * @return the cosine of \p this.
+     *
+     * @throws unspecified any exception thrown by piranha::polynomial::sin().
+     */
+    template <typename Series = polynomial,
+              elementary_enabler<Series, detail::math_sin_type<typename Series::term_type::cf_type>> = 0,
+              elementary_enabler<Series, detail::math_cos_type<typename Series::term_type::cf_type>> = 0>
+    polynomial cos() const
+    {
+        std::vector<polynomial> comps;
+        std::size_t n;
+        if (elementary_split(comps, n)) {
+            return comps.empty() ? elementary_sum(comps) : elementary_sin_cos(comps, n).second;
+        }
+        return detail::apply_cf_functor<detail::series_cf_cos_functor, polynomial>(*this);
+    }
     /// Integration.
     /**
      * \note
@@ -1457,8 +2543,8 @@ public:
      * and if \p U can be safely cast to the degree type.
      *
      * Setup the degree-based auto-truncation mechanism to truncate according to the total maximum degree.
-     * If the new auto truncation settings are different from the currently active ones, the natural power cache
-     * defined in piranha::series will be cleared.
+     * If the new auto truncation settings are different from the currently active ones, the natural power and
+     * product caches defined in piranha::series will be cleared.
      *
      * @param[in] max_degree maximum total degree that will be retained during automatic truncation.
      *
@@ -1493,8 +2579,8 @@ public:
      * and if \p U can be safely cast to the degree type.
      *
      * Setup the degree-based auto-truncation mechanism to truncate according to the partial degree.
-     * If the new auto truncation settings are different from the currently active ones, the natural power cache
-     * defined in piranha::series will be cleared.
+     * If the new auto truncation settings are different from the currently active ones, the natural power and
+     * product caches defined in piranha::series will be cleared.
      *
      * @param[in] max_degree maximum partial degree that will be retained during automatic truncation.
      * @param[in] names names of the variables that will be considered during the computation of the
@@ -1524,7 +2610,8 @@ public:
      * \note
      * This method is available only if the requisites outlined in piranha::polynomial are satisfied.
      *
-     * Disable the degree-based auto-truncation mechanism.
+     * Disable the degree-based auto-truncation mechanism. If auto-truncation was active, the natural power and
+     * product caches defined in piranha::series will be cleared.
      *
      * @throws unspecified any exception thrown by:
      * - threading primitives,
@@ -1537,6 +2624,7 @@ public:
         degree_type<T> new_degree(0);
         auto &at_dm = get_at_degree_max();
         std::lock_guard<std::mutex> lock(s_at_degree_mutex);
+        truncation_clear_pow_cache(0, new_degree, {});
         s_at_degree_mode = 0;
         at_dm = std::move(new_degree);
         s_at_degree_names.clear();
@@ -1563,6 +2651,107 @@ public:
         std::lock_guard<std::mutex> lock(s_at_degree_mutex);
         return std::make_tuple(s_at_degree_mode, get_at_degree_max(), s_at_degree_names);
     }
+    /// Composition.
+    /**
+     * \note
+     * This method is enabled only if:
+     * - the polynomial type supports substitution with itself and degree-based auto-truncation,
+     * - the key type provides a <tt>subs_split()</tt> method producing a single key, and whose exponents can be
+     *   safely cast to piranha::integer (e.g., piranha::monomial::subs_split()).
+     *
+     * This method will return the result of the substitution of the variable \p name in \p this with \p y.
+     *
+     * If the degree-based auto-truncation is active and the exponents of \p name in \p this are all non-negative
+     * integers, \p this is decomposed as \f$\sum_{k=0}^d c_k \cdot \mathrm{name}^k\f$, and the composition is
+     * evaluated with the baby-step/giant-step algorithm of Paterson and Stockmeyer: the powers
+     * \f$y^0,\ldots,y^m\f$, with \f$m=\left\lceil\sqrt{d+1}\right\rceil\f$, are computed via piranha::math::pow()
+     * (and hence retrieved from or stored into the cache of natural powers of piranha::series), the blocks
+     * \f$B_j=\sum_{i=0}^{m-1} c_{jm+i} \cdot y^i\f$ are formed, and the result is computed with Horner's scheme
+     * in \f$y^m\f$. All the multiplications are truncated, and the \f$c_k\f$ are truncated before being used, so
+     * that about \f$2\sqrt{d}\f$ multiplications between truncated series are performed instead of the \f$d\f$
+     * multiplications required to compute all the powers of \p y during a substitution. If the exponents of
+     * the polynomial are non-negative, the result is the same as the result of subs() (the terms exceeding the
+     * truncation limit are discarded at each step).
+     *
+     * Otherwise, this method is equivalent to subs().
+     *
+     * @param[in] name name of the variable that will be substituted.
+     * @param[in] y the polynomial that will be substituted for \p name.
+     *
+     * @return \p this composed with \p y.
+     *
+     * @throws unspecified any exception thrown by:
+     * - subs(),
+     * - the <tt>subs_split()</tt> method of the key type,
+     * - get_auto_truncate_degree() and piranha::power_series::truncate_degree(),
+     * - piranha::math::pow(),
+     * - term construction,
+     * - piranha::series::insert() and series arithmetics,
+     * - memory errors in standard containers.
+     */
+    template <typename T = polynomial, compose_enabler<T> = 0>
+    polynomial compose(const std::string &name, const polynomial &y) const
+    {
+        using term_type = typename base::term_type;
+        const auto at = get_auto_truncate_degree();
+        const auto &s_set = this->m_symbol_set;
+        if (std::get<0u>(at) == 0 || s_set.index_of(symbol(name)) == s_set.size()) {
+            return this->subs(name, y);
+        }
+        // Decompose this with respect to the powers of name.
+        std::map<integer, polynomial> cfs;
+        for (const auto &t : this->m_container) {
+            auto sp = t.m_key.subs_split(name, s_set);
+            integer k;
+            try {
+                k = safe_cast<integer>(sp.first);
+            } catch (const std::invalid_argument &) {
+                return this->subs(name, y);
+            }
+            if (k.sign() < 0) {
+                return this->subs(name, y);
+            }
+            auto &c = cfs[k];
+            if (c.empty()) {
+                c.set_symbol_set(s_set);
+            }
+            c.insert(term_type(t.m_cf, std::move(sp.second[0u])));
+        }
+        for (auto &p : cfs) {
+            compose_truncate(p.second, at);
+        }
+        // Block size.
+        const integer d = cfs.rbegin()->first;
+        integer m(1);
+        while (m * m < d + 1) {
+            ++m;
+        }
+        // Baby steps: the powers of y, from the pow cache.
+        std::vector<polynomial> y_pows;
+        for (integer i(0); i <= m; ++i) {
+            y_pows.push_back(math::pow(y, i));
+        }
+        // Giant steps: Horner's scheme in y**m, from the highest block.
+        polynomial retval;
+        auto it = cfs.rbegin();
+        for (integer j = d / m;; --j) {
+            polynomial b;
+            const integer j_base = j * m;
+            for (; it != cfs.rend() && it->first >= j_base; ++it) {
+                const auto i = static_cast<std::size_t>(it->first - j_base);
+                b += (i == 0u) ? it->second : it->second * y_pows[i];
+            }
+            if (j == d / m) {
+                retval = std::move(b);
+            } else {
+                retval = retval * y_pows.back() + b;
+            }
+            if (j.sign() == 0) {
+                break;
+            }
+        }
+        return retval;
+    }
     /// Find coefficient.
     /**
      * \note
@@ -1738,6 +2927,10 @@ public:
      * polynomials
      * \p n and \p d. The input polynomials must be univariate in the same variable.
      *
+     * Unless the operands are very sparse, the division is performed on dense arrays of coefficients. If \p d
+     * has a high enough degree, the multiply-subtract steps of the long division are run in parallel
+     * (the number of threads being determined via piranha::thread_pool::use_threads()).
+     *
      * @param[in] n the numerator.
      * @param[in] d the denominator.
      *
@@ -1830,6 +3023,10 @@ public:
      * This operator will compute the exact result of <tt>n / d</tt>. If \p d does not divide \p n exactly, an error
      * will be produced.
      *
+     * The division is performed with the sparse heap-based algorithm of Johnson, Monagan and Pearce, operating directly
+     * on the (packed) exponents of the monomials: the cost of the division thus depends on the number of terms
+     * of the operands and of the quotient, rather than on the size of the dense representation of the polynomials.
+     *
      * @param[in] n the numerator.
      * @param[in] d the denominator.
      *
@@ -1839,7 +3036,6 @@ public:
      * @throws piranha::math::inexact_division if the division is not exact.
      * @throws std::invalid_argument if a negative exponent is encountered.
      * @throws unspecified any exception thrown by:
-     * - piranha::polynomial::udivrem(),
      * - the public interface of piranha::hash_set, piranha::series, piranha::symbol_set,
      * - the monomial's <tt>extract_exponents()</tt> methods,
      * - construction of coefficients, monomials, terms and polynomials,
@@ -1932,10 +3128,16 @@ public:
      *
      * This method will compute the GCD of polynomials \p a and \p b. The algorithm that will be employed
      * for the computation is selected by the \p algo flag. If \p algo is set to polynomial_gcd_algorithm::automatic
-     * the heuristic GCD algorithm will be tried first, followed by the PRS SR algorithm in case of failures.
-     * If \p algo is set to any other value, the selected algorithm will be used. The heuristic GCD algorithm can be
-     * used only when the ceofficient type is an instance of piranha::mp_integer. The default value for \p algo
-     * is the one returned by get_default_gcd_algorithm().
+     * and the coefficient type is an instance of piranha::mp_integer, multivariate GCDs will be computed first
+     * with a modular algorithm (Zippel's sparse algorithm if the operands are sparse with respect to their degrees,
+     * Brown's dense algorithm otherwise), while for univariate GCDs the heuristic GCD algorithm will be tried first.
+     * The PRS SR algorithm is used in case of failures, and for other coefficient types.
+     * If \p algo is set to any other value, the selected algorithm will be used. The heuristic GCD algorithm and the
+     * modular algorithms can be used only when the ceofficient type is an instance of piranha::mp_integer.
+     * The modular algorithms compute the images of the GCD modulo word-sized primes, and the computation is
+     * parallelised across the primes or, for Zippel's algorithm, across the evaluation points (see
+     * piranha::settings::set_n_threads()). The default value for \p algo is the one returned by
+     * get_default_gcd_algorithm().
      *
      * The \p with_cofactors flag signals whether the cofactors should be returned together with the GCD or not.
      *
@@ -1952,8 +3154,9 @@ public:
      *
      * @throws std::invalid_argument if a negative exponent is encountered in \p a or \p b.
      * @throws std::overflow_error in case of (unlikely) integral overflow errors.
-     * @throws std::runtime_error if \p algo is polynomial_gcd_algorithm::heuristic and the execution
-     * of the algorithm fails or it the coefficient type is not an instance of piranha::mp_integer.
+     * @throws std::runtime_error if \p algo is polynomial_gcd_algorithm::heuristic, polynomial_gcd_algorithm::brown
+     * or polynomial_gcd_algorithm::zippel and the execution of the algorithm fails or it the coefficient type is not an
+     * instance of piranha::mp_integer.
      * @throws unspecified any exception thrown by:
      * - the public interface of piranha::series, piranha::symbol_set, piranha::hash_set,
      * - construction of keys,
@@ -1982,6 +3185,13 @@ public:
                 real_b = &merged_b;
             }
         }
+        if (algo == polynomial_gcd_algorithm::automatic || algo == polynomial_gcd_algorithm::brown
+            || algo == polynomial_gcd_algorithm::zippel) {
+            auto mod_res = try_gcd_modular(*real_a, *real_b, algo);
+            if (!mod_res.first) {
+                return std::move(mod_res.second);
+            }
+        }
         if (algo == polynomial_gcd_algorithm::automatic || algo == polynomial_gcd_algorithm::heuristic) {
             auto heu_res = try_gcdheu(*real_a, *real_b, algo);
             if (heu_res.first && algo == polynomial_gcd_algorithm::heuristic) {
@@ -2245,6 +3455,13 @@ struct is_monomial<monomial<T, S>> {
     static const bool value = true;
 };
 
+// NOTE: fixed monomials are handled like monomials in the multiplier (bounds checking and adaptive Kronecker packing
+// only access the exponents via the subscript operator, up to the size of the symbol set).
+template <typename T, std::size_t N>
+struct is_monomial<fixed_monomial<T, N>> {
+    static const bool value = true;
+};
+
 // Identify the presence of auto-truncation methods in the poly multiplier.
 template <typename S, typename T>
 class has_set_auto_truncate_degree : sfinae_types
@@ -2292,6 +3509,13 @@ using poly_ero_enabler =
                                 || has_exact_ring_operations<
                                        typename std::decay<T>::type::term_type::key_type::value_type>::value)>::type;
 
+// Enabler for composition.
+template <typename T>
+using poly_compose_enabler = typename std::enable_if<
+    std::is_base_of<detail::polynomial_tag, T>::value
+    && true_tt<decltype(std::declval<const T &>().compose(std::declval<const std::string &>(),
+                                                          std::declval<const T &>()))>::value>::type;
+
 // Enabler for GCD.
 template <typename T>
 using poly_gcd_enabler = typename std::enable_if<std::is_base_of<detail::polynomial_tag, T>::value
@@ -2327,6 +3551,29 @@ struct divexact_impl<T, detail::poly_divexact_enabler<T>> {
     }
 };
 
+/// Implementation of piranha::math::compose() for piranha::polynomial.
+/**
+ * This specialisation is enabled if \p T is an instance of piranha::polynomial that supports
+ * piranha::polynomial::compose().
+ */
+template <typename T>
+struct compose_impl<T, T, detail::poly_compose_enabler<T>> {
+    /// Call operator.
+    /**
+     * @param[in] x the outer polynomial.
+     * @param[in] name name of the variable that will be substituted.
+     * @param[in] y the inner polynomial.
+     *
+     * @return <tt>x.compose(name,y)</tt>.
+     *
+     * @throws unspecified any exception thrown by piranha::polynomial::compose().
+     */
+    T operator()(const T &x, const std::string &name, const T &y) const
+    {
+        return x.compose(name, y);
+    }
+};
+
 /// Implementation of piranha::math::gcd() for piranha::polynomial.
 /**
  * This specialisation is enabled if \p T is an instance of piranha::polynomial that supports
@@ -2412,13 +3659,13 @@ class series_multiplier<Series, detail::poly_multiplier_enabler<Series>> : publi
     void check_bounds() const
     {
     }
-    // Monomial with integral exponents.
+    // Monomial with integral exponents. The minmax values are also used to set up the adaptive Kronecker packing.
     template <typename T = Series,
               typename std::enable_if<detail::is_monomial<key_t<T>>::value
                                           && std::is_integral<typename key_t<T>::value_type>::value,
                                       int>::type
               = 0>
-    void check_bounds() const
+    void check_bounds()
     {
         using expo_type = typename key_t<T>::value_type;
         using term_type = typename Series::term_type;
@@ -2429,11 +3676,15 @@ class series_multiplier<Series, detail::poly_multiplier_enabler<Series>> : publi
         // Sync mutex, actually used only in mt mode.
         std::mutex mut;
         // Checker for monomial sizes in debug mode.
-        auto monomial_checker = [this](const term_type &t) { return t.m_key.size() == this->m_ss.size(); };
+        auto monomial_checker = [this](const term_type &t) { return t.m_key.is_compatible(this->m_ss); };
+        // NOTE: the exponents are accessed by index, up to the size of the symbol set (fixed monomials
+        // store more exponents than the number of symbols).
+        using size_type = typename key_t<T>::size_type;
+        const auto m = static_cast<size_type>(this->m_ss.size());
         (void)monomial_checker;
         // The function used to determine minmaxs for the two series. This is used both in
         // single-thread and multi-thread mode.
-        auto thread_func = [&mut, this, &monomial_checker](unsigned t_idx, const v_ptr *vp, mm_vec *mmv) {
+        auto thread_func = [&mut, this, &monomial_checker, m](unsigned t_idx, const v_ptr *vp, mm_vec *mmv) {
             piranha_assert(t_idx < this->m_n_threads);
             // Establish the block size.
             const auto block_size = vp->size() / this->m_n_threads;
@@ -2451,18 +3702,16 @@ class series_multiplier<Series, detail::poly_multiplier_enabler<Series>> : publi
             mm_vec minmax_values;
             // Init the mimnax.
             // NOTE: we can use this as we are sure the series has at least one element (start != end).
-            std::transform((*start)->m_key.begin(), (*start)->m_key.end(), std::back_inserter(minmax_values),
-                           [](const expo_type &v) { return std::make_pair(v, v); });
+            for (size_type i = 0u; i < m; ++i) {
+                minmax_values.emplace_back((*start)->m_key[i], (*start)->m_key[i]);
+            }
             // Move to the next element and go with the loop.
             ++start;
             for (; start != end; ++start) {
                 piranha_assert(monomial_checker(**start));
-                // NOTE: std::transform is allowed to do transformations in-place - i.e., here the output range is
-                // the same as the first or second input range:
-                // http://stackoverflow.com/questions/19200528/is-it-safe-for-the-input-iterator-and-output-iterator-in-stdtransform-to-be-fr
-                // The important part is that the functor *itself* must not mutate the elements.
-                std::transform(minmax_values.begin(), minmax_values.end(), (*start)->m_key.begin(),
-                               minmax_values.begin(), update_minmax{});
+                for (size_type i = 0u; i < m; ++i) {
+                    minmax_values[i] = update_minmax{}(minmax_values[i], (*start)->m_key[i]);
+                }
             }
             if (this->m_n_threads == 1u) {
                 // In single thread the output mmv should be written only once, after being def-inited.
@@ -2508,13 +3757,147 @@ class series_multiplier<Series, detail::poly_multiplier_enabler<Series>> : publi
                 piranha_throw(std::overflow_error, "monomial components are out of bounds");
             }
         }
+        ap_setup(minmax_values1, minmax_values2);
+    }
+    // Adaptive Kronecker packing for monomials with integral exponents.
+    // NOTE: the exponent ranges of the operands determined in check_bounds() are used to build a mixed-radix
+    // codification tailored to the multiplication at hand. The i-th exponent of the result lies in
+    // [min1_i + min2_i, max1_i + max2_i] so that, with the radices w_i = max1_i + max2_i - min1_i - min2_i + 1
+    // and c_i = w_0 * ... * w_(i-1), the terms of the first operand are encoded as sum_i (e_i - min1_i) * c_i (and
+    // similarly for the second operand). The code of the product of two terms is then the sum of the codes of the
+    // factors, and the multiplication can be performed as a multiplication of univariate Kronecker polynomials,
+    // provided that prod_i w_i - 1 is within the univariate bounds of k_monomial. Contrary to kronecker_array, the
+    // variables do not share a fixed symmetric range: a variable whose exponents are all small takes up only a few
+    // bits of the code, so that many more variables and higher degrees can be packed.
+    using ap_int = k_monomial::int_type;
+    template <typename T>
+    using ap_available = std::integral_constant<bool, detail::is_monomial<key_t<T>>::value
+                                                          && std::is_integral<typename key_t<T>::value_type>::value>;
+    template <typename MmVec>
+    void ap_setup(const MmVec &mm1, const MmVec &mm2)
+    {
+        piranha_assert(mm1.size() == mm2.size() && mm1.size() == this->m_ss.size());
+        const integer max_code(std::get<0u>(kronecker_array<ap_int>::get_limits()[1u])[0u]);
+        std::vector<ap_int> offsets1, offsets2, coding;
+        std::vector<detail::ka_divider<ap_int>> dividers;
+        integer c(1);
+        for (decltype(mm1.size()) i = 0u; i < mm1.size(); ++i) {
+            const integer w = integer(mm1[i].second) + integer(mm2[i].second) - integer(mm1[i].first)
+                              - integer(mm2[i].first) + 1;
+            coding.push_back(static_cast<ap_int>(c));
+            c *= w;
+            if (c - 1 > max_code) {
+                // The packing does not fit in the code.
+                return;
+            }
+            try {
+                offsets1.push_back(static_cast<ap_int>(integer(mm1[i].first)));
+                offsets2.push_back(static_cast<ap_int>(integer(mm2[i].first)));
+            } catch (const std::overflow_error &) {
+                return;
+            }
+            if (i + 1u != mm1.size()) {
+                dividers.emplace_back(static_cast<ap_int>(w));
+            }
+        }
+        m_ap_offsets1 = std::move(offsets1);
+        m_ap_offsets2 = std::move(offsets2);
+        m_ap_coding = std::move(coding);
+        m_ap_dividers = std::move(dividers);
+    }
+    // Encode the terms in v as the terms of a univariate Kronecker polynomial with respect to the symbol set ss.
+    template <typename KpType>
+    KpType ap_encode(const typename base::v_ptr &v, const std::vector<ap_int> &offsets, const symbol_set &ss) const
+    {
+        using size_type = typename key_t<Series>::size_type;
+        KpType retval;
+        retval.set_symbol_set(ss);
+        auto &container = retval._container();
+        container.rehash(boost::numeric_cast<typename KpType::size_type>(
+            std::ceil(static_cast<double>(v.size()) / container.max_load_factor())));
+        const auto m = static_cast<size_type>(this->m_ss.size());
+        for (const auto &ptr : v) {
+            ap_int code(0);
+            for (size_type i = 0u; i < m; ++i) {
+                code = static_cast<ap_int>(code + (static_cast<ap_int>(ptr->m_key[i]) - offsets[i]) * m_ap_coding[i]);
+            }
+            typename KpType::term_type tmp(ptr->m_cf, k_monomial(code));
+            const auto b_idx = container._bucket(tmp);
+            container._unique_insert(std::move(tmp), b_idx);
+        }
+        container._update_size(static_cast<typename KpType::size_type>(v.size()));
+        return retval;
+    }
+    // Multiplication via adaptive Kronecker packing.
+    template <typename T = Series, typename std::enable_if<ap_available<T>::value, int>::type = 0>
+    Series adaptive_kronecker_mult() const
+    {
+        using kp_type = polynomial<cf_t<T>, k_monomial>;
+        using term_type = typename Series::term_type;
+        using key_type = key_t<Series>;
+        using expo_type = typename key_type::value_type;
+        piranha_assert(!m_ap_coding.empty());
+        // Small multiplications are better handled by the plain multiplication (same criterion as
+        // in untruncated_kronecker_mult()).
+        const auto size1 = this->m_v1.size(), size2 = this->m_v2.size();
+        const auto e_thr = tuning::get_estimate_threshold();
+        if (integer(size1) * size2 < integer(e_thr) * e_thr && this->m_n_threads == 1u) {
+            return this->plain_multiplication();
+        }
+        // Multiply the encoded operands.
+        // NOTE: the name of the symbol is irrelevant.
+        const symbol_set kss{symbol("x")};
+        const kp_type p1 = ap_encode<kp_type>(this->m_v1, m_ap_offsets1, kss),
+                      p2 = ap_encode<kp_type>(this->m_v2, m_ap_offsets2, kss);
+        kp_type kres = series_multiplier<kp_type>(p1, p2)._untruncated_multiplication();
+        // Decode the result.
+        Series retval;
+        retval.set_symbol_set(this->m_ss);
+        auto &container = retval._container();
+        const auto &kcontainer = kres._container();
+        if (kcontainer.empty()) {
+            return retval;
+        }
+        container.rehash(boost::numeric_cast<typename Series::size_type>(
+            std::ceil(static_cast<double>(kcontainer.size()) / container.max_load_factor())));
+        using size_type = typename key_type::size_type;
+        const auto last = static_cast<size_type>(this->m_ss.size() - 1u);
+        term_type tmp;
+        tmp.m_key = key_type(this->m_ss);
+        for (const auto &t : kcontainer) {
+            ap_int code = t.m_key.get_int();
+            for (size_type i = 0u; i < last; ++i) {
+                const ap_int q = m_ap_dividers[i].divide(code);
+                tmp.m_key[i] = static_cast<expo_type>(code - q * m_ap_dividers[i].m_d + m_ap_offsets1[i]
+                                                      + m_ap_offsets2[i]);
+                code = q;
+            }
+            tmp.m_key[last] = static_cast<expo_type>(code + m_ap_offsets1[last] + m_ap_offsets2[last]);
+            // NOTE: the coefficient in a term is mutable.
+            tmp.m_cf = std::move(t.m_cf);
+            const auto b_idx = container._bucket(tmp);
+            container._unique_insert(tmp, b_idx);
+        }
+        container._update_size(static_cast<typename Series::size_type>(kcontainer.size()));
+        // NOTE: the coefficients of kres have been moved away, clear it before destruction.
+        kres._container().clear();
+        // NOTE: the operands are already sanitised, and the result has been sanitised by the Kronecker
+        // multiplier. We still need to finalise with respect to the operands of this.
+        this->finalise_series(retval);
+        return retval;
+    }
+    template <typename T = Series, typename std::enable_if<!ap_available<T>::value, int>::type = 0>
+    Series adaptive_kronecker_mult() const
+    {
+        piranha_assert(false);
+        return this->plain_multiplication();
     }
     template <typename T = Series,
               typename std::enable_if<detail::is_kronecker_monomial<key_t<T>>::value, int>::type = 0>
     void check_bounds() const
     {
         using value_type = typename key_t<Series>::value_type;
-        using ka = kronecker_array<value_type>;
+        using ka = kronecker_array<typename key_t<Series>::int_type>;
         using v_ptr = typename base::v_ptr;
         using mm_vec = std::vector<std::pair<value_type, value_type>>;
         piranha_assert(this->m_v1.size() != 0u && this->m_v2.size() != 0u);
@@ -2581,7 +3964,16 @@ class series_multiplier<Series, detail::poly_multiplier_enabler<Series>> : publi
         piranha_assert(minmax_values.size() == minmax_values1.size());
         piranha_assert(minmax_values.size() == minmax_values2.size());
         for (decltype(minmax_values.size()) i = 0u; i < minmax_values.size(); ++i) {
-            if (unlikely(minmax_values[i].first < -minmax_vec[i] || minmax_values[i].second > minmax_vec[i])) {
+            const auto M = detail::ka_to_integer(minmax_vec[i]);
+            if (unlikely(minmax_values[i].first < -M || minmax_values[i].second > M)) {
+                piranha_throw(std::overflow_error, "Kronecker monomial components are out of bounds");
+            }
+            // NOTE: the exponents must also be representable by the exponent type, which,
+            // for 128-bit codes, can be narrower than the bounds of the codification.
+            try {
+                (void)static_cast<value_type>(minmax_values[i].first);
+                (void)static_cast<value_type>(minmax_values[i].second);
+            } catch (...) {
                 piranha_throw(std::overflow_error, "Kronecker monomial components are out of bounds");
             }
         }
@@ -2661,6 +4053,9 @@ class series_multiplier<Series, detail::poly_multiplier_enabler<Series>> : publi
               = 0>
     Series um_impl() const
     {
+        if (!m_ap_coding.empty()) {
+            return adaptive_kronecker_mult();
+        }
         return this->plain_multiplication();
     }
 
@@ -2705,6 +4100,12 @@ public:
      * the key type of \p Series, the implementation will use either base_series_multiplier::plain_multiplication()
      * with base_series_multiplier::plain_multiplier or a different algorithm.
      *
+     * If the key type is a piranha::monomial with integral exponents and no truncation is active, the
+     * exponent ranges of the operands (determined in the constructor) are used to encode the terms of the operands
+     * via a Kronecker substitution tailored to the multiplication. If the encoded terms fit in the codes
+     * of piranha::k_monomial, the multiplication is performed as a Kronecker multiplication of the encoded
+     * operands, and the result is then decoded.
+     *
      * If a polynomial truncation threshold is defined and the degree type of the polynomial is a C++ integral type,
      * the integral arithmetic operations involved in the truncation logic will be checked for overflow.
      *
@@ -2988,12 +4389,16 @@ private:
         }
     };
     // execute() is the top level dispatch for the actual multiplication.
-    // Case 1: not a Kronecker monomial, do the plain mult.
+    // Case 1: not a Kronecker monomial, use the adaptive Kronecker packing if available and no truncation is active,
+    // otherwise do the plain mult.
     template <typename T = Series,
               typename std::enable_if<!detail::is_kronecker_monomial<typename T::term_type::key_type>::value, int>::type
               = 0>
     Series execute() const
     {
+        if (!m_ap_coding.empty() && !check_truncation()) {
+            return adaptive_kronecker_mult();
+        }
         return plain_multiplication_wrapper();
     }
     // Checking for active truncation.
@@ -3358,6 +4763,12 @@ private:
             throw;
         }
     }
+    // Data for the adaptive Kronecker packing: the minimum exponents of the operands, the coding vector
+    // and the dividers for the decodification. These are empty if the packing is not available.
+    std::vector<ap_int> m_ap_offsets1;
+    std::vector<ap_int> m_ap_offsets2;
+    std::vector<ap_int> m_ap_coding;
+    std::vector<detail::ka_divider<ap_int>> m_ap_dividers;
 };
 }
 
@@ -1590,6 +1590,16 @@ public:
         ::mpfr_cos(retval.m_value, m_value, default_rnd);
         return retval;
     }
+    /// Natural logarithm.
+    /**
+     * @return natural logarithm of \p this, computed with the precision of \p this.
+     */
+    real log() const
+    {
+        real retval(0, get_prec());
+        ::mpfr_log(retval.m_value, m_value, default_rnd);
+        return retval;
+    }
     /// Pi constant.
     /**
      * @return pi constant calculated to the current precision of \p this.
@@ -1837,6 +1847,40 @@ struct cos_impl<T, typename std::enable_if<std::is_same<T, real>::value>::type>
     }
 };
 
+/// Specialisation of the piranha::math::exp() functor for piranha::real.
+template <typename T>
+struct exp_impl<T, typename std::enable_if<std::is_same<T, real>::value>::type> {
+    /// Call operator.
+    /**
+     * The operation will return the output of piranha::real::exp().
+     *
+     * @param[in] r argument.
+     *
+     * @return exponential of \p r.
+     */
+    real operator()(const T &r) const
+    {
+        return r.exp();
+    }
+};
+
+/// Specialisation of the piranha::math::log() functor for piranha::real.
+template <typename T>
+struct log_impl<T, typename std::enable_if<std::is_same<T, real>::value>::type> {
+    /// Call operator.
+    /**
+     * The operation will return the output of piranha::real::log().
+     *
+     * @param[in] r argument.
+     *
+     * @return natural logarithm of \p r.
+     */
+    real operator()(const T &r) const
+    {
+        return r.log();
+    }
+};
+
 /// Specialisation of the piranha::math::abs() functor for piranha::real.
 template <typename T>
 struct abs_impl<T, typename std::enable_if<std::is_same<T, real>::value>::type> {
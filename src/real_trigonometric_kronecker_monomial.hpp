@@ -39,6 +39,7 @@ see https://www.gnu.org/licenses/. */
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -48,7 +49,9 @@ see https://www.gnu.org/licenses/. */
 #include "config.hpp"
 #include "detail/cf_mult_impl.hpp"
 #include "detail/km_commons.hpp"
+#include "detail/power_table.hpp"
 #include "detail/prepare_for_print.hpp"
+#include "detail/real_fwd.hpp"
 #include "detail/safe_integral_adder.hpp"
 #include "exceptions.hpp"
 #include "is_cf.hpp"
@@ -167,6 +170,12 @@ private:
     // Final typedef for the eval type.
     template <typename U>
     using eval_type = typename eval_type_<U>::type;
+    // Enabler for the evaluation via trigonometric tables. The tables are restricted to piranha::real: with exact
+    // types, the cosines and sines of the single multiples might not be computable even if the cosine and sine of
+    // their linear combination are (e.g., cos(x-y) with rational x == y), and for C++ floating-point types the
+    // cosine and the sine are cheap enough that the tables do not pay off.
+    template <typename U>
+    using trig_table_enabler = typename std::enable_if<std::is_same<U, real>::value, int>::type;
     // Substitution utils.
     template <typename U>
     using subs_cos_type = decltype(math::cos(std::declval<const value_type &>() * std::declval<const U &>()));
@@ -1053,6 +1062,71 @@ public:
         }
         return math::sin(tmp);
     }
+    /// Update multiplier bounds.
+    /**
+     * The pairs in \p bounds will be updated so that they contain, respectively, lower and upper bounds for the
+     * multipliers of \p this. If \p bounds is empty, it will be initialised from the multipliers of \p this.
+     * This method is used in series evaluation, together with the evaluation via trigonometric tables.
+     *
+     * @param[in,out] bounds the vector of bounds to be updated.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @throws std::invalid_argument if the sizes of \p this, \p args and \p bounds (if not empty) differ.
+     * @throws unspecified any exception thrown by unpack() or by memory errors in standard containers.
+     */
+    void update_multiplier_bounds(std::vector<std::pair<value_type, value_type>> &bounds, const symbol_set &args) const
+    {
+        if (unlikely(!bounds.empty() && bounds.size() != args.size())) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set or multiplier bounds");
+        }
+        const auto v = unpack(args);
+        detail::power_table<value_type, value_type>::update_bounds(bounds, v.begin(), v.end());
+    }
+    /// Evaluation via trigonometric tables.
+    /**
+     * \note
+     * This method is enabled only if \p U is piranha::real, and the other requirements of the evaluation via
+     * piranha::symbol_set::positions_map are satisfied.
+     *
+     * This method will return the same value as the evaluation via piranha::symbol_set::positions_map, but
+     * the cosine and the sine of the linear combination of the evaluation values are computed via the angle addition
+     * formulae from the cosines and sines of the multiples of the single values, which are read from \p table.
+     * The table must cover the multipliers of \p this. The results might differ slightly from the ones of the
+     * evaluation via piranha::symbol_set::positions_map.
+     *
+     * @param[in] table the table of the cosines and sines of the multiples of the evaluation values.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the result of evaluating \p this with the values provided by \p table.
+     *
+     * @throws std::invalid_argument if the sizes of \p this, \p args and \p table differ.
+     * @throws unspecified any exception thrown by unpack(), or by the construction and the arithmetic operations
+     * of the return type.
+     */
+    template <typename U, trig_table_enabler<U> = 0>
+    eval_type<U> evaluate(const detail::trig_table<U, value_type> &table, const symbol_set &args) const
+    {
+        using return_type = eval_type<U>;
+        if (unlikely(table.size() != args.size())) {
+            piranha_throw(std::invalid_argument, "invalid size of arguments set or trigonometric table");
+        }
+        const auto v = unpack(args);
+        // Cosine and sine of the partial sums of the multiples.
+        return_type c(1), s(0);
+        for (typename v_type::size_type i = 0u; i < v.size(); ++i) {
+            if (v[i] == value_type(0)) {
+                continue;
+            }
+            const auto &p = table(static_cast<std::size_t>(i), v[i]);
+            return_type tmp(c * p.first - s * p.second);
+            s = s * p.first + c * p.second;
+            c = std::move(tmp);
+        }
+        if (get_flavour()) {
+            return c;
+        }
+        return s;
+    }
     /// Substitution.
     /**
      * \note
@@ -1236,6 +1310,46 @@ public:
         }
         return retval;
     }
+    /// Split for substitution.
+    /**
+     * This method returns a pair whose second element contains the two monomials that would be produced (in the same
+     * order) by subs() and t_subs() for the symbol called \p s. The first element of the pair is a tuple
+     * containing the multiplier of \p s (or zero, if \p s is not in \p args), the flavour of \p this and a boolean
+     * flag signalling if the canonicalisation of the monomials changed the sign of the multipliers. For a given
+     * \p args, the values produced by subs() and t_subs() depend only on the first element of the pair, which allows
+     * to group the monomials of a series and to compute the values only once for each group.
+     *
+     * @param[in] s name of the symbol that will be substituted.
+     * @param[in] args reference set of piranha::symbol.
+     *
+     * @return the grouping tuple and the monomials resulting from the substitution of \p s.
+     *
+     * @throws unspecified any exception thrown by:
+     * - unpack(),
+     * - piranha::static_vector::push_back(),
+     * - piranha::kronecker_array::encode().
+     */
+    std::pair<std::tuple<value_type, bool, bool>, std::array<real_trigonometric_kronecker_monomial, 2u>>
+    subs_split(const std::string &s, const symbol_set &args) const
+    {
+        const auto v = unpack(args);
+        v_type new_v;
+        value_type n(0);
+        for (min_int<decltype(args.size()), typename v_type::size_type> i = 0u; i < args.size(); ++i) {
+            if (args[i].get_name() == s) {
+                n = v[i];
+                new_v.push_back(value_type(0));
+            } else {
+                new_v.push_back(v[i]);
+            }
+        }
+        const bool sign_changed = canonicalise_impl(new_v);
+        const auto new_int = ka::encode(new_v);
+        return std::make_pair(std::make_tuple(n, get_flavour(), sign_changed),
+                              std::array<real_trigonometric_kronecker_monomial, 2u>{
+                                  {real_trigonometric_kronecker_monomial(new_int, true),
+                                   real_trigonometric_kronecker_monomial(new_int, false)}});
+    }
     /// Identify symbols that can be trimmed.
     /**
      * This method is used in piranha::series::trim(). The input parameter \p candidates
@@ -30,6 +30,7 @@ see https://www.gnu.org/licenses/. */
 #define PIRANHA_SERIES_HPP
 
 #include <algorithm>
+#include <boost/functional/hash.hpp>
 #include <boost/iostreams/copy.hpp>
 #include <boost/iostreams/filter/bzip2.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
@@ -44,11 +45,13 @@ see https://www.gnu.org/licenses/. */
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -57,6 +60,7 @@ see https://www.gnu.org/licenses/. */
 #include "config.hpp"
 #include "convert_to.hpp"
 #include "debug_access.hpp"
+#include "detail/power_table.hpp"
 #include "detail/series_fwd.hpp"
 #include "detail/sfinae_types.hpp"
 #include "exceptions.hpp"
@@ -77,6 +81,7 @@ see https://www.gnu.org/licenses/. */
 #include "symbol.hpp"
 #include "symbol_set.hpp"
 #include "term.hpp"
+#include "thread_pool.hpp"
 #include "type_traits.hpp"
 
 namespace piranha
@@ -582,11 +587,11 @@ class series_operators
             auto merge = retval.m_symbol_set.merge(y.m_symbol_set);
             if (merge != retval.m_symbol_set) {
                 // This is a move assignment, always possible.
-                retval = retval.merge_arguments(merge);
+                retval = std::move(retval).merge_arguments(merge);
             }
             // Fix the args of the second series.
             if (merge != y.m_symbol_set) {
-                retval.template merge_terms<Sign>(y.merge_arguments(merge));
+                retval.template merge_terms<Sign>(std::forward<U>(y).merge_arguments(merge));
             } else {
                 retval.template merge_terms<Sign>(std::forward<U>(y));
             }
@@ -764,15 +769,15 @@ class series_operators
             const bool need_copy_x = (merge != x.m_symbol_set), need_copy_y = (merge != y.m_symbol_set);
             piranha_assert(need_copy_x || need_copy_y);
             if (need_copy_x) {
-                ret_type x_copy(x.merge_arguments(merge));
+                ret_type x_copy(std::forward<T>(x).merge_arguments(merge));
                 if (need_copy_y) {
-                    ret_type y_copy(y.merge_arguments(merge));
+                    ret_type y_copy(std::forward<U>(y).merge_arguments(merge));
                     return binary_mul_impl(std::move(x_copy), std::move(y_copy));
                 }
                 return binary_mul_impl(std::move(x_copy), std::forward<U>(y));
             } else {
                 piranha_assert(need_copy_y);
-                ret_type y_copy(y.merge_arguments(merge));
+                ret_type y_copy(std::forward<U>(y).merge_arguments(merge));
                 return binary_mul_impl(std::forward<T>(x), std::move(y_copy));
             }
         }
@@ -1299,6 +1304,86 @@ enum class file_compression {
     bzip2
 };
 
+/// Series fingerprint.
+/**
+ * A fingerprint summarises a series via its hash value (as computed by piranha::series::hash()), its number of
+ * terms and its symbol set. Identical series (in the sense of piranha::series::is_identical()) have the same
+ * fingerprint. A fingerprint can be computed once and reused in the lookups of
+ * piranha::series::cached_multiplication(), so that the terms of the series are not hashed again at each lookup.
+ *
+ * A fingerprint is a snapshot: series do not store their fingerprint, and a fingerprint is not updated when the
+ * series it was computed from is modified. It is up to the user to compute a new fingerprint after a modification.
+ */
+class series_fingerprint
+{
+public:
+    /// Constructor from series.
+    /**
+     * \note
+     * This constructor is enabled only if \p Series satisfies piranha::is_series.
+     *
+     * @param[in] s the series whose fingerprint will be computed.
+     *
+     * @throws unspecified any exception thrown by piranha::series::hash() or by the copy constructor of
+     * piranha::symbol_set.
+     */
+    template <typename Series, typename std::enable_if<is_series<Series>::value, int>::type = 0>
+    explicit series_fingerprint(const Series &s)
+        : m_hash(s.hash()), m_size(s.size()), m_symbol_set(s.get_symbol_set())
+    {
+    }
+    /// Hash value.
+    /**
+     * @return the hash value of the series.
+     */
+    std::size_t hash() const
+    {
+        return m_hash;
+    }
+    /// Size.
+    /**
+     * @return the number of terms of the series.
+     */
+    std::size_t size() const
+    {
+        return m_size;
+    }
+    /// Symbol set getter.
+    /**
+     * @return a const reference to the symbol set of the series.
+     */
+    const symbol_set &get_symbol_set() const
+    {
+        return m_symbol_set;
+    }
+    /// Equality operator.
+    /**
+     * @param[in] other the comparison argument.
+     *
+     * @return \p true if the hash values, the sizes and the symbol sets of \p this and \p other are equal,
+     * \p false otherwise.
+     */
+    bool operator==(const series_fingerprint &other) const
+    {
+        return m_hash == other.m_hash && m_size == other.m_size && m_symbol_set == other.m_symbol_set;
+    }
+    /// Inequality operator.
+    /**
+     * @param[in] other the comparison argument.
+     *
+     * @return the opposite of operator==().
+     */
+    bool operator!=(const series_fingerprint &other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    std::size_t m_hash;
+    std::size_t m_size;
+    symbol_set m_symbol_set;
+};
+
 /// Series class.
 /**
  * This class contains the arithmetic and comparison operator overloads for piranha::series instances
@@ -1759,20 +1844,332 @@ private:
         return os;
     }
     // Merge arguments using new_ss as new symbol set.
-    Derived merge_arguments(const symbol_set &new_ss) const
+    Derived merge_arguments(const symbol_set &new_ss) const &
+    {
+        return merge_arguments_impl(new_ss, false);
+    }
+    // Overload for rvalues: the coefficients are moved into the return value, and this is left empty.
+    Derived merge_arguments(const symbol_set &new_ss) &&
+    {
+        try {
+            auto retval = merge_arguments_impl(new_ss, true);
+            m_container.clear();
+            return retval;
+        } catch (...) {
+            // Some coefficients might have been moved away already.
+            m_container.clear();
+            throw;
+        }
+    }
+    using c_size_type = typename container_type::size_type;
+    // Minimum number of terms per thread in the parallel term-by-term algorithms.
+    static c_size_type min_work_per_thread()
+    {
+        return 10000u;
+    }
+    // Run f(i) on the first n_threads threads of the pool, with i the thread index.
+    static void parallel_run(unsigned n_threads, const std::function<void(unsigned)> &f)
+    {
+        future_list<void> ff_list;
+        try {
+            for (unsigned i = 0u; i < n_threads; ++i) {
+                ff_list.push_back(thread_pool::enqueue(i, f, i));
+            }
+            // First let's wait for everything to finish.
+            ff_list.wait_all();
+            // Then, let's handle the exceptions.
+            ff_list.get_all();
+        } catch (...) {
+            ff_list.wait_all();
+            throw;
+        }
+    }
+    // Bounds of the i-th of n contiguous blocks in a range of the given size.
+    static std::pair<c_size_type, c_size_type> block_bounds(c_size_type size, unsigned n, unsigned i)
+    {
+        const c_size_type block_size = size / n, b = static_cast<c_size_type>(block_size * i),
+                          e = (i == n - 1u) ? size : static_cast<c_size_type>(b + block_size);
+        return std::make_pair(b, e);
+    }
+    // Pointers to the terms of this, so that they can be split in blocks.
+    std::vector<term_type const *> term_pointers() const
+    {
+        std::vector<term_type const *> retval;
+        retval.reserve(static_cast<decltype(retval.size())>(m_container.size()));
+        for (const auto &t : m_container) {
+            retval.push_back(&t);
+        }
+        return retval;
+    }
+    // Fill the empty series retval with terms built from the terms of this. For each term t of this, f(t, out)
+    // must return true if it wrote a new term into out (always, if all is true). The new terms must be unique,
+    // non-ignorable and compatible with the symbol set of retval, as they are inserted without further checks.
+    // The table of retval is sized in advance. If n_threads is not 1, the terms of this are processed
+    // concurrently in contiguous blocks: each block groups its terms by destination zone of buckets in retval,
+    // and then each zone is filled by a single thread.
+    template <typename F>
+    void unique_fill(Derived &retval, const F &f, bool all, unsigned n_threads) const
+    {
+        piranha_assert(retval.empty() && n_threads > 0u);
+        auto &container = retval.m_container;
+        auto presize = [&container](size_type n) {
+            container.rehash(
+                boost::numeric_cast<size_type>(std::ceil(static_cast<double>(n) / container.max_load_factor())));
+        };
+        try {
+            term_type tmp;
+            if (n_threads == 1u && all) {
+                presize(m_container.size());
+                for (const auto &t : m_container) {
+                    f(t, tmp);
+                    const auto b_idx = container._bucket(tmp);
+                    container._unique_insert(std::move(tmp), b_idx);
+                }
+                container._update_size(m_container.size());
+                return;
+            }
+            if (n_threads == 1u) {
+                std::vector<term_type> out;
+                for (const auto &t : m_container) {
+                    if (f(t, tmp)) {
+                        out.push_back(std::move(tmp));
+                    }
+                }
+                if (out.empty()) {
+                    return;
+                }
+                presize(out.size());
+                for (auto &t : out) {
+                    const auto b_idx = container._bucket(t);
+                    container._unique_insert(std::move(t), b_idx);
+                }
+                container._update_size(out.size());
+                return;
+            }
+            const auto v = term_pointers();
+            const auto size = m_container.size();
+            // out[i] contains the terms produced by the i-th block.
+            std::vector<std::vector<term_type>> out(n_threads);
+            parallel_run(n_threads, [&v, &out, &f, size, n_threads](unsigned i) {
+                const auto bounds = block_bounds(size, n_threads, i);
+                term_type t;
+                for (auto j = bounds.first; j < bounds.second; ++j) {
+                    if (f(*v[static_cast<decltype(v.size())>(j)], t)) {
+                        out[i].push_back(std::move(t));
+                    }
+                }
+            });
+            size_type new_size(0u);
+            for (const auto &o : out) {
+                new_size = static_cast<size_type>(new_size + o.size());
+            }
+            if (!new_size) {
+                return;
+            }
+            presize(new_size);
+            const auto zone_size = static_cast<size_type>(container.bucket_count() / n_threads);
+            piranha_assert(zone_size > 0u);
+            // zones[i][j] contains the terms produced by the i-th block and destined to the j-th zone.
+            std::vector<std::vector<std::vector<term_type>>> zones(n_threads,
+                                                                   std::vector<std::vector<term_type>>(n_threads));
+            parallel_run(n_threads, [&out, &zones, &container, n_threads, zone_size](unsigned i) {
+                for (auto &t : out[i]) {
+                    const auto z = std::min(static_cast<unsigned>(container._bucket(t) / zone_size), n_threads - 1u);
+                    zones[i][z].push_back(std::move(t));
+                }
+                std::vector<term_type>().swap(out[i]);
+            });
+            parallel_run(n_threads, [&zones, &container](unsigned i) {
+                for (auto &zone : zones) {
+                    for (auto &t : zone[i]) {
+                        const auto b_idx = container._bucket(t);
+                        container._unique_insert(std::move(t), b_idx);
+                    }
+                    std::vector<term_type>().swap(zone[i]);
+                }
+            });
+            container._update_size(new_size);
+        } catch (...) {
+            container.clear();
+            throw;
+        }
+    }
+    // Accumulate the evaluations of the terms of this, in blocks of terms processed concurrently if n_threads
+    // is not 1. key_eval(t) must return the evaluation of the key of the term t.
+    template <typename R, typename T, typename F>
+    R evaluate_blocks(const std::unordered_map<std::string, T> &dict, const F &key_eval, unsigned n_threads) const
+    {
+        if (n_threads == 1u) {
+            // Accumulate the return value. The accumulator might defer the normalisation
+            // of the result until the end of the loop (e.g., for rationals).
+            detail::sum_accumulator<R> acc;
+            for (const auto &t : m_container) {
+                acc.multiply_accumulate(math::evaluate(t.m_cf, dict), key_eval(t));
+            }
+            return acc.get();
+        }
+        const auto v = term_pointers();
+        std::vector<R> partials;
+        partials.reserve(n_threads);
+        for (unsigned i = 0u; i < n_threads; ++i) {
+            partials.emplace_back(0);
+        }
+        parallel_run(n_threads, [this, &v, &dict, &key_eval, &partials, n_threads](unsigned i) {
+            const auto bounds = block_bounds(size(), n_threads, i);
+            detail::sum_accumulator<R> acc;
+            for (auto j = bounds.first; j < bounds.second; ++j) {
+                const auto &t = *v[static_cast<decltype(v.size())>(j)];
+                acc.multiply_accumulate(math::evaluate(t.m_cf, dict), key_eval(t));
+            }
+            partials[i] = acc.get();
+        });
+        detail::sum_accumulator<R> acc;
+        for (auto &p : partials) {
+            acc.add(std::move(p));
+        }
+        return acc.get();
+    }
+    // Check that all the symbols of the series appear in the evaluation positions map.
+    template <typename T>
+    void evaluate_check_pmap(const symbol_set::positions_map<T> &pmap) const
+    {
+        decltype(this->m_symbol_set.size()) i = 0u;
+        piranha_assert(pmap.size() <= this->m_symbol_set.size());
+        // First we iterate over all elements of pmap (which could be fewer than the symbols).
+        for (const auto &p : pmap) {
+            if (unlikely(i != p.first)) {
+                piranha_throw(std::invalid_argument, "the symbol '" + this->m_symbol_set[i].get_name()
+                                                         + "' is missing from the series evaluation dictionary'");
+            }
+            ++i;
+        }
+        // It could still happen that pmap is missing symbols at the tail of the symbol set.
+        if (unlikely(i < this->m_symbol_set.size())) {
+            piranha_throw(std::invalid_argument, "the symbol '" + this->m_symbol_set[i].get_name()
+                                                     + "' is missing from the series evaluation dictionary'");
+        }
+    }
+    // The dictionary used for the evaluation of the coefficients when evaluating with a map of symbols. Series
+    // coefficients need the names of the symbols, the other coefficient types ignore the dictionary.
+    template <typename T, typename Cf2 = Cf, typename std::enable_if<is_series<Cf2>::value, int>::type = 0>
+    static std::unordered_map<std::string, T> evaluate_cf_dict(const std::unordered_map<symbol, T> &dict)
+    {
+        std::unordered_map<std::string, T> retval;
+        for (const auto &p : dict) {
+            retval.emplace(p.first.get_name(), p.second);
+        }
+        return retval;
+    }
+    template <typename T, typename Cf2 = Cf, typename std::enable_if<!is_series<Cf2>::value, int>::type = 0>
+    static std::unordered_map<std::string, T> evaluate_cf_dict(const std::unordered_map<symbol, T> &)
+    {
+        return std::unordered_map<std::string, T>{};
+    }
+    // Compute the bounds of the exponents (or of the multipliers) of the keys via f(key, bounds), in blocks of terms
+    // processed concurrently if n_threads is not 1.
+    template <typename Bounds, typename F>
+    Bounds evaluate_bounds(const F &f, unsigned n_threads) const
+    {
+        using table_type = detail::power_table<typename Bounds::value_type::first_type,
+                                               typename Bounds::value_type::first_type>;
+        Bounds bounds;
+        if (n_threads == 1u) {
+            for (const auto &t : m_container) {
+                f(t.m_key, bounds);
+            }
+            return bounds;
+        }
+        const auto v = term_pointers();
+        std::vector<Bounds> b_vec(n_threads);
+        parallel_run(n_threads, [this, &v, &b_vec, &f, n_threads](unsigned i) {
+            const auto bounds = block_bounds(size(), n_threads, i);
+            for (auto j = bounds.first; j < bounds.second; ++j) {
+                f(v[static_cast<decltype(v.size())>(j)]->m_key, b_vec[i]);
+            }
+        });
+        for (const auto &b : b_vec) {
+            table_type::merge_bounds(bounds, b);
+        }
+        return bounds;
+    }
+    // Evaluation via power tables, if supported by the key.
+    template <typename R, typename T, typename Key2 = Key,
+              typename std::enable_if<detail::key_has_power_table_evaluate<Key2, T>::value, int>::type = 0>
+    R evaluate_impl(const std::unordered_map<std::string, T> &dict, const symbol_set::positions_map<T> &pmap,
+                    unsigned n_threads) const
+    {
+        using table_type = detail::power_table<T, typename Key2::value_type>;
+        using bounds_type = typename table_type::bounds_type;
+        const auto bounds = evaluate_bounds<bounds_type>(
+            [this](const Key2 &k, bounds_type &b) { k.update_exponent_bounds(b, m_symbol_set); }, n_threads);
+        // The tables are used only if computing them requires fewer powers than the evaluation
+        // of the keys one by one.
+        if (!bounds.empty() && table_type::table_size(bounds) <= integer(size()) * bounds.size()) {
+            const table_type table(pmap, bounds);
+            return evaluate_blocks<R>(dict, [this, &table](const term_type &t) {
+                return t.m_key.evaluate(table, m_symbol_set);
+            }, n_threads);
+        }
+        return evaluate_blocks<R>(dict, [this, &pmap](const term_type &t) {
+            return t.m_key.evaluate(pmap, m_symbol_set);
+        }, n_threads);
+    }
+    // Evaluation via trigonometric tables, if supported by the key.
+    template <typename R, typename T, typename Key2 = Key,
+              typename std::enable_if<!detail::key_has_power_table_evaluate<Key2, T>::value
+                                          && detail::key_has_trig_table_evaluate<Key2, T>::value,
+                                      int>::type = 0>
+    R evaluate_impl(const std::unordered_map<std::string, T> &dict, const symbol_set::positions_map<T> &pmap,
+                    unsigned n_threads) const
+    {
+        using table_type = detail::trig_table<T, typename Key2::value_type>;
+        using bounds_type = typename table_type::bounds_type;
+        const auto bounds = evaluate_bounds<bounds_type>(
+            [this](const Key2 &k, bounds_type &b) { k.update_multiplier_bounds(b, m_symbol_set); }, n_threads);
+        // The tables are used only if computing them requires fewer cosines and sines than the evaluation
+        // of the keys one by one.
+        if (!bounds.empty()
+            && detail::power_table<typename Key2::value_type, typename Key2::value_type>::table_size(bounds) * 2
+                   <= integer(size())) {
+            const table_type table(pmap, bounds);
+            return evaluate_blocks<R>(dict, [this, &table](const term_type &t) {
+                return t.m_key.evaluate(table, m_symbol_set);
+            }, n_threads);
+        }
+        return evaluate_blocks<R>(dict, [this, &pmap](const term_type &t) {
+            return t.m_key.evaluate(pmap, m_symbol_set);
+        }, n_threads);
+    }
+    template <typename R, typename T, typename Key2 = Key,
+              typename std::enable_if<!detail::key_has_power_table_evaluate<Key2, T>::value
+                                          && !detail::key_has_trig_table_evaluate<Key2, T>::value,
+                                      int>::type = 0>
+    R evaluate_impl(const std::unordered_map<std::string, T> &dict, const symbol_set::positions_map<T> &pmap,
+                    unsigned n_threads) const
+    {
+        return evaluate_blocks<R>(dict, [this, &pmap](const term_type &t) {
+            return t.m_key.evaluate(pmap, m_symbol_set);
+        }, n_threads);
+    }
+    Derived merge_arguments_impl(const symbol_set &new_ss, bool move_cfs) const
     {
         piranha_assert(new_ss.size() > m_symbol_set.size());
         piranha_assert(std::includes(new_ss.begin(), new_ss.end(), m_symbol_set.begin(), m_symbol_set.end()));
         using cf_type = typename term_type::cf_type;
-        using key_type = typename term_type::key_type;
         Derived retval;
         retval.m_symbol_set = new_ss;
-        const auto it_f = m_container.end();
-        for (auto it = m_container.begin(); it != it_f; ++it) {
-            cf_type new_cf(it->m_cf);
-            key_type new_key(it->m_key.merge_args(m_symbol_set, new_ss));
-            retval.insert(term_type(std::move(new_cf), std::move(new_key)));
+        if (empty()) {
+            return retval;
         }
+        // NOTE: merge_args() is injective and it does not change the ignorability of a term.
+        unique_fill(retval,
+                    [this, &new_ss, move_cfs](const term_type &t, term_type &out) {
+                        // NOTE: the coefficient is mutable, hence it can be moved from.
+                        cf_type new_cf(move_cfs ? std::move(t.m_cf) : t.m_cf);
+                        out = term_type(std::move(new_cf), t.m_key.merge_args(m_symbol_set, new_ss));
+                        return true;
+                    },
+                    true, thread_pool::use_threads(size(), min_work_per_thread()));
         return retval;
     }
     // Set of checks to be run on destruction in debug mode.
@@ -2007,6 +2404,87 @@ private:
         static pow_map_type<Series> s_pow_cache;
         return s_pow_cache;
     }
+    // Product cache machinery. The entries are kept in a list sorted from the most to the least recently used,
+    // and they are indexed via a multimap keyed by the combined hash of the fingerprints of the operands. The
+    // operands are stored in the entries in order to verify the hits.
+    template <typename Series>
+    struct product_cache_entry {
+        std::size_t m_hash;
+        series_fingerprint m_f1;
+        series_fingerprint m_f2;
+        Series m_s1;
+        Series m_s2;
+        Series m_product;
+        std::size_t m_n_terms;
+    };
+    template <typename Series>
+    struct product_cache_type {
+        using list_type = std::list<product_cache_entry<Series>>;
+        list_type m_list;
+        std::unordered_multimap<std::size_t, typename list_type::iterator> m_index;
+        // Maximum number of terms stored in the cache (operands and products). Zero disables the cache.
+        std::size_t m_max_terms = 0u;
+        std::size_t m_n_terms = 0u;
+        std::size_t m_hits = 0u;
+        std::size_t m_misses = 0u;
+    };
+    // See the note about get_pow_cache() below.
+    template <typename Series = Derived>
+    static product_cache_type<Series> &get_product_cache()
+    {
+        static product_cache_type<Series> s_product_cache;
+        return s_product_cache;
+    }
+    // Enabler for the product cache: the product must be of type Derived.
+    template <typename T>
+    using product_cache_enabler = typename std::enable_if<
+        std::is_same<is_identical_enabler<T>, int>::value
+            && std::is_same<decltype(std::declval<const T &>() * std::declval<const T &>()), T>::value,
+        int>::type;
+    static std::size_t product_cache_hash(const series_fingerprint &f1, const series_fingerprint &f2)
+    {
+        std::size_t retval = f1.hash();
+        boost::hash_combine(retval, f1.size());
+        boost::hash_combine(retval, f2.hash());
+        boost::hash_combine(retval, f2.size());
+        return retval;
+    }
+    // Look for the product of s1 and s2 in the cache, moving the entry to the front of the list if found. The cache
+    // must be locked.
+    template <typename Series>
+    static typename product_cache_type<Series>::list_type::iterator
+    product_cache_find(product_cache_type<Series> &c, std::size_t h, const Series &s1, const series_fingerprint &f1,
+                       const Series &s2, const series_fingerprint &f2)
+    {
+        const auto r = c.m_index.equal_range(h);
+        for (auto it = r.first; it != r.second; ++it) {
+            auto &e = *it->second;
+            if (e.m_f1 == f1 && e.m_f2 == f2 && e.m_s1.is_identical(s1) && e.m_s2.is_identical(s2)) {
+                // NOTE: splice() does not invalidate the iterators.
+                c.m_list.splice(c.m_list.begin(), c.m_list, it->second);
+                return it->second;
+            }
+        }
+        return c.m_list.end();
+    }
+    // Remove the least recently used entries until the number of terms is within the limit. The cache must be locked.
+    template <typename Series>
+    static void product_cache_evict(product_cache_type<Series> &c)
+    {
+        while (c.m_n_terms > c.m_max_terms) {
+            piranha_assert(!c.m_list.empty());
+            const auto l_it = std::prev(c.m_list.end());
+            const auto r = c.m_index.equal_range(l_it->m_hash);
+            for (auto it = r.first; it != r.second; ++it) {
+                if (it->second == l_it) {
+                    c.m_index.erase(it);
+                    break;
+                }
+            }
+            c.m_n_terms -= l_it->m_n_terms;
+            c.m_list.erase(l_it);
+        }
+    }
     // Empty for sfinae.
     template <typename T, typename U, typename = void>
     struct pow_ret_type_ {
@@ -2449,6 +2927,161 @@ public:
         std::lock_guard<std::mutex> lock(s_pow_mutex);
         get_pow_cache().clear();
     }
+    /// Cached multiplication.
+    /**
+     * \note
+     * This method is enabled only if \p Derived is equality-comparable and the product of two \p Derived
+     * instances is of type \p Derived.
+     *
+     * This method returns the product of \p s1 and \p s2, looking it up first in an internal thread-safe cache
+     * of series products. The cache is keyed by the fingerprints \p f1 and \p f2 of the operands, which must
+     * have been computed from the current values of \p s1 and \p s2 (the operands are stored in the cache and checked
+     * for identity before a cached product is returned, so that a hit never yields a wrong result). The fingerprints
+     * are supplied by the caller, so that they can be computed once for operands which are used in many products,
+     * without hashing the terms of the operands at each lookup.
+     *
+     * The cache is disabled by default, and it can be enabled by setting a maximum number of terms via
+     * set_product_cache_max_terms(). When the number of terms stored in the cache (operands and products) exceeds
+     * the limit, the least recently used entries are removed. If the cache is disabled, this method is equivalent to
+     * <tt>s1 * s2</tt>.
+     *
+     * @param[in] s1 first operand.
+     * @param[in] f1 fingerprint of \p s1.
+     * @param[in] s2 second operand.
+     * @param[in] f2 fingerprint of \p s2.
+     *
+     * @return the product of \p s1 and \p s2.
+     *
+     * @throws unspecified any exception thrown by:
+     * - series multiplication and copy construction,
+     * - is_identical(),
+     * - memory errors in standard containers,
+     * - threading primitives.
+     */
+    template <typename T = Derived, product_cache_enabler<T> = 0>
+    static Derived cached_multiplication(const Derived &s1, const series_fingerprint &f1, const Derived &s2,
+                                         const series_fingerprint &f2)
+    {
+        auto &c = get_product_cache();
+        const auto h = product_cache_hash(f1, f2);
+        bool enabled;
+        {
+            std::lock_guard<std::mutex> lock(s_product_mutex);
+            enabled = c.m_max_terms != 0u;
+            if (enabled) {
+                const auto it = product_cache_find(c, h, s1, f1, s2, f2);
+                if (it != c.m_list.end()) {
+                    ++c.m_hits;
+                    return it->m_product;
+                }
+                ++c.m_misses;
+            }
+        }
+        // NOTE: the multiplication is performed without holding the lock.
+        Derived retval(s1 * s2);
+        if (!enabled) {
+            return retval;
+        }
+        const std::size_t n_terms = s1.size() + s2.size() + retval.size();
+        std::lock_guard<std::mutex> lock(s_product_mutex);
+        // Another thread might have inserted the same product in the meantime, or the limit might have changed.
+        if (n_terms > c.m_max_terms || product_cache_find(c, h, s1, f1, s2, f2) != c.m_list.end()) {
+            return retval;
+        }
+        c.m_list.push_front(product_cache_entry<Derived>{h, f1, f2, s1, s2, retval, n_terms});
+        try {
+            c.m_index.emplace(h, c.m_list.begin());
+        } catch (...) {
+            c.m_list.pop_front();
+            throw;
+        }
+        c.m_n_terms += n_terms;
+        product_cache_evict(c);
+        return retval;
+    }
+    /// Set the size limit of the product cache.
+    /**
+     * \note
+     * This method is enabled only if cached_multiplication() is enabled.
+     *
+     * Set the maximum number of terms (operands and products) stored in the cache used by cached_multiplication().
+     * A value of zero disables the cache. Entries exceeding the new limit are removed, starting from the least
+     * recently used ones.
+     *
+     * @param[in] n the new limit.
+     *
+     * @throws unspecified any exception thrown by threading primitives.
+     */
+    template <typename T = Derived, product_cache_enabler<T> = 0>
+    static void set_product_cache_max_terms(std::size_t n)
+    {
+        auto &c = get_product_cache();
+        std::lock_guard<std::mutex> lock(s_product_mutex);
+        c.m_max_terms = n;
+        product_cache_evict(c);
+    }
+    /// Get the size limit of the product cache.
+    /**
+     * \note
+     * This method is enabled only if cached_multiplication() is enabled.
+     *
+     * @return the maximum number of terms stored in the cache used by cached_multiplication().
+     *
+     * @throws unspecified any exception thrown by threading primitives.
+     */
+    template <typename T = Derived, product_cache_enabler<T> = 0>
+    static std::size_t get_product_cache_max_terms()
+    {
+        auto &c = get_product_cache();
+        std::lock_guard<std::mutex> lock(s_product_mutex);
+        return c.m_max_terms;
+    }
+    /// Product cache statistics.
+    /**
+     * \note
+     * This method is enabled only if cached_multiplication() is enabled.
+     *
+     * This method will return a tuple of four elements describing the status of the cache used by
+     * cached_multiplication(). The elements of the tuple are:
+     * - the number of hits,
+     * - the number of misses,
+     * - the number of cached products,
+     * - the number of terms stored in the cache.
+     *
+     * Lookups performed while the cache is disabled are not counted.
+     *
+     * @return a tuple representing the status of the product cache.
+     *
+     * @throws unspecified any exception thrown by threading primitives.
+     */
+    template <typename T = Derived, product_cache_enabler<T> = 0>
+    static std::tuple<std::size_t, std::size_t, std::size_t, std::size_t> get_product_cache_stats()
+    {
+        auto &c = get_product_cache();
+        std::lock_guard<std::mutex> lock(s_product_mutex);
+        return std::make_tuple(c.m_hits, c.m_misses, static_cast<std::size_t>(c.m_list.size()), c.m_n_terms);
+    }
+    /// Clear the product cache.
+    /**
+     * \note
+     * This method is enabled only if cached_multiplication() is enabled.
+     *
+     * This method removes all the entries of the cache used by cached_multiplication() and resets its statistics.
+     * The size limit is not changed.
+     *
+     * @throws unspecified any exception thrown by threading primitives.
+     */
+    template <typename T = Derived, product_cache_enabler<T> = 0>
+    static void clear_product_cache()
+    {
+        auto &c = get_product_cache();
+        std::lock_guard<std::mutex> lock(s_product_mutex);
+        c.m_index.clear();
+        c.m_list.clear();
+        c.m_n_terms = 0u;
+        c.m_hits = 0u;
+        c.m_misses = 0u;
+    }
     /// Partial derivative.
     /**
      * \note
@@ -2603,37 +3236,95 @@ public:
             = [this](const term_type &t) { return detail::pair_from_term<term_type, Derived>(this->m_symbol_set, t); };
         return boost::make_transform_iterator(m_container.end(), func_type(std::move(func)));
     }
+private:
+    // Enablers for filter() and transform().
+    using term_pair_type = std::pair<typename term_type::cf_type, Derived>;
+    template <typename F>
+    using filter_enabler = typename std::enable_if<
+        std::is_convertible<decltype(std::declval<const F &>()(std::declval<const term_pair_type &>())), bool>::value,
+        int>::type;
+    template <typename F>
+    using transform_enabler = typename std::enable_if<
+        std::is_convertible<decltype(std::declval<const F &>()(std::declval<const term_pair_type &>())),
+                            term_pair_type>::value,
+        int>::type;
+    // Number of threads to be used in filter() and transform().
+    unsigned functor_n_threads(unsigned n_threads) const
+    {
+        if (unlikely(!n_threads)) {
+            piranha_throw(std::invalid_argument, "the number of threads must be strictly positive");
+        }
+        if (n_threads == 1u || empty()) {
+            return 1u;
+        }
+        return std::min(n_threads, thread_pool::use_threads(size(), size_type(1u)));
+    }
+
+public:
     /// Term filtering.
     /**
+     * \note
+     * This method is enabled only if \p func returns a type convertible to \p bool when called with
+     * the term format described below.
+     *
      * This method will apply the functor \p func to each term in the series, and produce a return series
      * containing all terms in \p this for which \p func returns \p true.
      * Terms are passed to \p func in the format resulting from dereferencing the iterators obtained
      * via piranha::series::begin().
      *
+     * If \p n_threads is greater than 1, the terms are split in (at most) \p n_threads blocks that are processed
+     * concurrently by the threads of piranha::thread_pool. In this case, \p func will be called concurrently
+     * from multiple threads.
+     *
      * @param[in] func filtering functor.
+     * @param[in] n_threads number of threads to be used.
      *
      * @return filtered series.
      *
-     * @throw unspecified any exception thrown by:
+     * @throws std::invalid_argument if \p n_threads is zero.
+     * @throws unspecified any exception thrown by:
      * - the call operator of \p func,
-     * - insert(),
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back(),
      * - the assignment operator of piranha::symbol_set,
-     * - term, coefficient, key construction.
+     * - term, coefficient, key construction,
+     * - memory errors in standard containers.
      */
-    Derived filter(std::function<bool(const std::pair<typename term_type::cf_type, Derived> &)> func) const
+    template <typename F, filter_enabler<F> = 0>
+    Derived filter(const F &func, unsigned n_threads = 1u) const
     {
+        n_threads = functor_n_threads(n_threads);
         Derived retval;
         retval.m_symbol_set = m_symbol_set;
-        const auto it_f = this->m_container.end();
-        for (auto it = this->m_container.begin(); it != it_f; ++it) {
-            if (func(detail::pair_from_term<term_type, Derived>(m_symbol_set, *it))) {
-                retval.insert(*it);
-            }
-        }
+        unique_fill(retval,
+                    [this, &func](const term_type &t, term_type &out) {
+                        if (func(detail::pair_from_term<term_type, Derived>(m_symbol_set, t))) {
+                            out = t;
+                            return true;
+                        }
+                        return false;
+                    },
+                    false, n_threads);
         return retval;
     }
+    /// Term filtering via \p std::function.
+    /**
+     * @param[in] func filtering functor.
+     * @param[in] n_threads number of threads to be used.
+     *
+     * @return the output of the generic overload of filter().
+     *
+     * @throws unspecified any exception thrown by the generic overload of filter().
+     */
+    Derived filter(std::function<bool(const term_pair_type &)> func, unsigned n_threads = 1u) const
+    {
+        return filter<decltype(func)>(func, n_threads);
+    }
     /// Term transformation.
     /**
+     * \note
+     * This method is enabled only if \p func returns a type convertible to
+     * <tt>std::pair<typename term_type::cf_type, Derived></tt> when called with the term format described below.
+     *
      * This method will apply the functor \p func to each term in the series, and will use the return
      * value of the functor to construct a new series. Terms are passed to \p func in the same format
      * resulting from dereferencing the iterators obtained via piranha::series::begin(), and \p func is expected to
@@ -2644,35 +3335,72 @@ public:
      * of \p func is used to construct a new temporary series from the multiplication of \p t.first and
      * \p t.second. Each temporary series is then added to the return value series.
      *
+     * If \p n_threads is greater than 1, the terms are split in (at most) \p n_threads blocks that are processed
+     * concurrently by the threads of piranha::thread_pool, each block accumulating its own partial sum.
+     * In this case, \p func will be called concurrently from multiple threads.
+     *
      * This method requires the coefficient type to be multipliable by \p Derived.
      *
      * @param[in] func transforming functor.
+     * @param[in] n_threads number of threads to be used.
      *
      * @return transformed series.
      *
-     * @throw unspecified any exception thrown by:
+     * @throws std::invalid_argument if \p n_threads is zero.
+     * @throws unspecified any exception thrown by:
      * - the call operator of \p func,
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back(),
      * - insert(),
      * - the assignment operator of piranha::symbol_set,
      * - term, coefficient, key construction,
      * - series multiplication and addition.
      */
     // TODO require multipliability of cf * Derived and addability of the result to Derived in place.
-    Derived transform(std::function<std::pair<typename term_type::cf_type, Derived>(
-                          const std::pair<typename term_type::cf_type, Derived> &)>
-                          func) const
+    template <typename F, transform_enabler<F> = 0>
+    Derived transform(const F &func, unsigned n_threads = 1u) const
     {
+        n_threads = functor_n_threads(n_threads);
         Derived retval;
-        std::pair<typename term_type::cf_type, Derived> tmp;
-        const auto it_f = this->m_container.end();
-        for (auto it = this->m_container.begin(); it != it_f; ++it) {
-            tmp = func(detail::pair_from_term<term_type, Derived>(m_symbol_set, *it));
-            // NOTE: here we could use multadd, but it seems like there's not
-            // much benefit (plus, the types involved are different).
-            retval += tmp.first * tmp.second;
+        if (n_threads == 1u) {
+            term_pair_type tmp;
+            const auto it_f = this->m_container.end();
+            for (auto it = this->m_container.begin(); it != it_f; ++it) {
+                tmp = func(detail::pair_from_term<term_type, Derived>(m_symbol_set, *it));
+                // NOTE: here we could use multadd, but it seems like there's not
+                // much benefit (plus, the types involved are different).
+                retval += tmp.first * tmp.second;
+            }
+            return retval;
+        }
+        const auto v = term_pointers();
+        std::vector<Derived> partials(n_threads);
+        parallel_run(n_threads, [this, &v, &partials, &func, n_threads](unsigned i) {
+            const auto bounds = block_bounds(size(), n_threads, i);
+            term_pair_type p;
+            for (auto j = bounds.first; j < bounds.second; ++j) {
+                const auto &t = *v[static_cast<decltype(v.size())>(j)];
+                p = func(detail::pair_from_term<term_type, Derived>(m_symbol_set, t));
+                partials[i] += p.first * p.second;
+            }
+        });
+        for (auto &p : partials) {
+            retval += std::move(p);
         }
         return retval;
     }
+    /// Term transformation via \p std::function.
+    /**
+     * @param[in] func transforming functor.
+     * @param[in] n_threads number of threads to be used.
+     *
+     * @return the output of the generic overload of transform().
+     *
+     * @throws unspecified any exception thrown by the generic overload of transform().
+     */
+    Derived transform(std::function<term_pair_type(const term_pair_type &)> func, unsigned n_threads = 1u) const
+    {
+        return transform<decltype(func)>(func, n_threads);
+    }
     /// Evaluation.
     /**
      * \note
@@ -2686,14 +3414,29 @@ public:
      * of all terms in the series via the product of the evaluations of the coefficient-key pairs in each term.
      * The input dictionary \p dict specifies with which value each symbolic quantity will be evaluated.
      *
-     * @param[in] dict dictionary of that will be used for evaluation.
+     * If the return type is a piranha::mp_rational, the accumulation is performed without canonicalising
+     * the intermediate results, and the final value is canonicalised only once at the end. If the return type
+     * is a floating-point type, the accumulation uses compensated summation.
+     *
+     * If the key type supports it (e.g., for monomials with integral exponents), the powers of the evaluation values
+     * are tabulated before the evaluation of the keys, whenever this requires fewer computations than the evaluation
+     * of the keys one by one. Similarly, for trigonometric keys evaluated with piranha::real values (e.g.,
+     * piranha::real_trigonometric_kronecker_monomial), the cosines and sines of the multiples of the evaluation values
+     * can be tabulated, and the keys are then evaluated via the angle addition formulae. Large series are evaluated
+     * concurrently in blocks of terms, using the threads returned by piranha::thread_pool::use_threads(), and the
+     * partial sums are then added together. In this case, the floating-point results might differ slightly depending
+     * on the number of threads.
+     *
+     * @param[in] dict dictionary that will be used for evaluation.
      *
      * @return evaluation of the series according to the evaluation dictionary \p dict.
      *
      * @throws unspecified any exception thrown by:
      * - coefficient and key evaluation,
      * - insertion operations on \p std::unordered_map,
-     * - piranha::math::multiply_accumulate().
+     * - piranha::math::multiply_accumulate(),
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back(),
+     * - memory errors in standard containers.
      */
     template <typename T, typename Series = series>
     eval_type<Series, T> evaluate(const std::unordered_map<std::string, T> &dict) const
@@ -2702,34 +3445,43 @@ public:
         // build a vector of evaluated terms, sort it and accumulate (to minimise accuracy loss
         // with fp types and maybe improve performance - e.g., for integers).
         using return_type = eval_type<Series, T>;
-        // Transform the string dict into symbol dict for use in keys.
-        std::unordered_map<symbol, T> s_dict;
-        for (const auto &p : dict) {
-            s_dict[symbol(p.first)] = p.second;
-        }
-        // Convert to positions map.
-        symbol_set::positions_map<T> pmap(this->m_symbol_set, s_dict);
-        decltype(this->m_symbol_set.size()) i = 0u;
-        piranha_assert(pmap.size() <= this->m_symbol_set.size());
-        // First we iterate over all elements of pmap (which could be fewer than the symbols).
-        for (const auto &p : pmap) {
-            if (unlikely(i != p.first)) {
-                piranha_throw(std::invalid_argument, "the symbol '" + this->m_symbol_set[i].get_name()
-                                                         + "' is missing from the series evaluation dictionary'");
-            }
-            ++i;
-        }
-        // It could still happen that pmap is missing symbols at the tail of the symbol set.
-        if (unlikely(i < this->m_symbol_set.size())) {
-            piranha_throw(std::invalid_argument, "the symbol '" + this->m_symbol_set[i].get_name()
-                                                     + "' is missing from the series evaluation dictionary'");
+        // Convert to positions map. The symbols of the series are looked up directly by name
+        // in the dictionary, so that no symbol is created here.
+        symbol_set::positions_map<T> pmap(this->m_symbol_set, dict);
+        evaluate_check_pmap(pmap);
+        if (empty()) {
+            return return_type(0);
         }
-        // Init return value and accumulate it.
-        return_type retval = return_type(0);
-        for (const auto &t : this->m_container) {
-            math::multiply_accumulate(retval, math::evaluate(t.m_cf, dict), t.m_key.evaluate(pmap, m_symbol_set));
+        return evaluate_impl<return_type>(dict, pmap, thread_pool::use_threads(size(), min_work_per_thread()));
+    }
+    /// Evaluation with a map of symbols.
+    /**
+     * \note
+     * This method is enabled only if the evaluation with a map of strings is enabled.
+     *
+     * This method is equivalent to the evaluation with a map of strings, but the symbols of the series
+     * are looked up in \p dict via their ids, instead of hashing and comparing their names. Callers evaluating
+     * the same series many times can thus construct the piranha::symbol objects once and reuse them.
+     * If the coefficient type is a piranha::series, the coefficients are still evaluated with a map of strings
+     * built from \p dict.
+     *
+     * @param[in] dict dictionary that will be used for evaluation.
+     *
+     * @return evaluation of the series according to the evaluation dictionary \p dict.
+     *
+     * @throws unspecified any exception thrown by the evaluation with a map of strings.
+     */
+    template <typename T, typename Series = series>
+    eval_type<Series, T> evaluate(const std::unordered_map<symbol, T> &dict) const
+    {
+        using return_type = eval_type<Series, T>;
+        symbol_set::positions_map<T> pmap(this->m_symbol_set, dict);
+        evaluate_check_pmap(pmap);
+        if (empty()) {
+            return return_type(0);
         }
-        return retval;
+        return evaluate_impl<return_type>(evaluate_cf_dict(dict), pmap,
+                                          thread_pool::use_threads(size(), min_work_per_thread()));
     }
     /// Trim.
     /**
@@ -2741,28 +3493,57 @@ public:
      * If the coefficient type is an instance of piranha::series, trim() will be called recursively on the coefficients
      * while building the return value.
      *
+     * Large series are processed concurrently in blocks of terms, using the threads returned by
+     * piranha::thread_pool::use_threads().
+     *
      * @return trimmed version of \p this.
      *
      * @throws unspecified any exception thrown by:
      * - operations on piranha::symbol_set,
      * - the trimming methods of coefficient and/or key,
-     * - insert(),
-     * - term, coefficient and key type construction.
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back(),
+     * - term, coefficient and key type construction,
+     * - memory errors in standard containers.
      */
     Derived trim() const
     {
+        const auto n_threads = empty() ? 1u : thread_pool::use_threads(size(), min_work_per_thread());
         // Build the set of symbols that can be removed.
-        const auto it_f = this->m_container.end();
         symbol_set trim_ss(m_symbol_set);
-        for (auto it = this->m_container.begin(); it != it_f; ++it) {
-            it->m_key.trim_identify(trim_ss, m_symbol_set);
+        if (n_threads == 1u) {
+            const auto it_f = this->m_container.end();
+            for (auto it = this->m_container.begin(); it != it_f && trim_ss.size(); ++it) {
+                it->m_key.trim_identify(trim_ss, m_symbol_set);
+            }
+        } else {
+            // Each block of terms works on its own copy of the candidates: the symbols
+            // that can be removed are those surviving in all the copies.
+            const auto v = term_pointers();
+            std::vector<symbol_set> candidates(n_threads, m_symbol_set);
+            parallel_run(n_threads, [this, &v, &candidates, n_threads](unsigned i) {
+                const auto bounds = block_bounds(size(), n_threads, i);
+                auto &c = candidates[i];
+                for (auto j = bounds.first; j < bounds.second && c.size(); ++j) {
+                    v[static_cast<decltype(v.size())>(j)]->m_key.trim_identify(c, m_symbol_set);
+                }
+            });
+            for (const auto &c : candidates) {
+                trim_ss = trim_ss.diff(m_symbol_set.diff(c));
+            }
         }
         // Determine the new set.
         Derived retval;
         retval.m_symbol_set = m_symbol_set.diff(trim_ss);
-        for (auto it = this->m_container.begin(); it != it_f; ++it) {
-            retval.insert(term_type(trim_cf_impl(it->m_cf), it->m_key.trim(trim_ss, m_symbol_set)));
+        if (empty()) {
+            return retval;
         }
+        // NOTE: trimming is injective and it does not change the ignorability of a term.
+        unique_fill(retval,
+                    [this, &trim_ss](const term_type &t, term_type &out) {
+                        out = term_type(trim_cf_impl(t.m_cf), t.m_key.trim(trim_ss, m_symbol_set));
+                        return true;
+                    },
+                    true, n_threads);
         return retval;
     }
     /// Print in TeX mode.
@@ -3114,6 +3895,8 @@ private:
     static std::mutex s_cp_mutex;
     // Pow cache machinery;
     static std::mutex s_pow_mutex;
+    // Product cache machinery.
+    static std::mutex s_product_mutex;
 };
 
 template <typename Cf, typename Key, typename Derived>
@@ -3122,6 +3905,9 @@ std::mutex series<Cf, Key, Derived>::s_cp_mutex;
 template <typename Cf, typename Key, typename Derived>
 std::mutex series<Cf, Key, Derived>::s_pow_mutex;
 
+template <typename Cf, typename Key, typename Derived>
+std::mutex series<Cf, Key, Derived>::s_product_mutex;
+
 /// Specialisation of piranha::print_coefficient_impl for series.
 /**
  * This specialisation is enabled if \p Series is an instance of piranha::series.
@@ -3563,6 +4349,199 @@ struct cos_impl<Series, detail::series_cos_enabler<Series>> {
 namespace detail
 {
 
+// Detect if series has a const exp() method.
+template <typename T>
+class series_has_exp : sfinae_types
+{
+    template <typename U>
+    static auto test(const U &t) -> decltype(t.exp());
+    static no test(...);
+
+public:
+    static const bool value = is_returnable<decltype(test(std::declval<T>()))>::value;
+};
+
+// Three cases for exp() implementation, as for sin().
+// 1. call the member function, if available.
+template <typename T, typename std::enable_if<is_series<T>::value && series_has_exp<T>::value, int>::type = 0>
+inline auto series_exp_impl(const T &s) -> decltype(s.exp())
+{
+    return s.exp();
+}
+
+struct series_cf_exp_functor {
+    template <typename T>
+    auto operator()(const T &x) const -> decltype(math::exp(x))
+    {
+        return math::exp(x);
+    }
+    static constexpr const char *name = "exponential";
+};
+
+// 2. coefficient type supports math::exp() with a result equal to the original coefficient type.
+// NOTE: this overload and the one below do not conflict with the one above because it takes a series
+// as input argument: when used on a concrete series type, it will have to go through a to-base
+// conversion in order to be selected.
+template <typename Cf, typename Key, typename Derived,
+          typename std::
+              enable_if<is_series<Derived>::value
+                            && std::is_same<typename Derived::term_type::cf_type,
+                                            decltype(math::exp(
+                                                std::declval<const typename Derived::term_type::cf_type &>()))>::value,
+                        int>::type
+          = 0>
+inline Derived series_exp_impl(const series<Cf, Key, Derived> &s)
+{
+    return apply_cf_functor<series_cf_exp_functor, Derived>(s);
+}
+
+// 3. coefficient type supports math::exp() with a result different from the original coefficient type and the series
+// can be rebound to this new type.
+template <typename Cf, typename Key, typename Derived,
+          typename std::
+              enable_if<is_series<Derived>::value
+                            && !std::is_same<typename Derived::term_type::cf_type,
+                                             decltype(math::exp(
+                                                 std::declval<const typename Derived::term_type::cf_type &>()))>::value,
+                        int>::type
+          = 0>
+inline series_rebind<Derived, decltype(math::exp(std::declval<const typename Derived::term_type::cf_type &>()))>
+series_exp_impl(const series<Cf, Key, Derived> &s)
+{
+    using ret_type
+        = series_rebind<Derived, decltype(math::exp(std::declval<const typename Derived::term_type::cf_type &>()))>;
+    return apply_cf_functor<series_cf_exp_functor, ret_type>(s);
+}
+
+// Final enabler condition for the exp implementation.
+template <typename T>
+using series_exp_enabler =
+    typename std::enable_if<true_tt<decltype(series_exp_impl(std::declval<const T &>()))>::value>::type;
+
+// All of the above, but for log().
+template <typename T>
+class series_has_log : sfinae_types
+{
+    template <typename U>
+    static auto test(const U &t) -> decltype(t.log());
+    static no test(...);
+
+public:
+    static const bool value = is_returnable<decltype(test(std::declval<T>()))>::value;
+};
+
+template <typename T, typename std::enable_if<is_series<T>::value && series_has_log<T>::value, int>::type = 0>
+inline auto series_log_impl(const T &s) -> decltype(s.log())
+{
+    return s.log();
+}
+
+struct series_cf_log_functor {
+    template <typename T>
+    auto operator()(const T &x) const -> decltype(math::log(x))
+    {
+        return math::log(x);
+    }
+    static constexpr const char *name = "logarithm";
+};
+
+template <typename Cf, typename Key, typename Derived,
+          typename std::
+              enable_if<is_series<Derived>::value
+                            && std::is_same<typename Derived::term_type::cf_type,
+                                            decltype(math::log(
+                                                std::declval<const typename Derived::term_type::cf_type &>()))>::value,
+                        int>::type
+          = 0>
+inline Derived series_log_impl(const series<Cf, Key, Derived> &s)
+{
+    return apply_cf_functor<series_cf_log_functor, Derived>(s);
+}
+
+template <typename Cf, typename Key, typename Derived,
+          typename std::
+              enable_if<is_series<Derived>::value
+                            && !std::is_same<typename Derived::term_type::cf_type,
+                                             decltype(math::log(
+                                                 std::declval<const typename Derived::term_type::cf_type &>()))>::value,
+                        int>::type
+          = 0>
+inline series_rebind<Derived, decltype(math::log(std::declval<const typename Derived::term_type::cf_type &>()))>
+series_log_impl(const series<Cf, Key, Derived> &s)
+{
+    using ret_type
+        = series_rebind<Derived, decltype(math::log(std::declval<const typename Derived::term_type::cf_type &>()))>;
+    return apply_cf_functor<series_cf_log_functor, ret_type>(s);
+}
+
+template <typename T>
+using series_log_enabler =
+    typename std::enable_if<true_tt<decltype(series_log_impl(std::declval<const T &>()))>::value>::type;
+}
+
+namespace math
+{
+
+/// Specialisation of the piranha::math::exp() functor for piranha::series.
+/**
+ * This specialisation is activated when \p Series is an instance of piranha::series and:
+ * - either the series type provides a const <tt>%exp()</tt> method returning a type which satisfies
+ *   piranha::is_returnable, or, missing this method,
+ * - the series' coefficient type \p Cf supports math::exp() yielding a type \p T and either
+ *   \p T is the same as \p Cf, or the series type can be rebound to the type \p T.
+ */
+template <typename Series>
+struct exp_impl<Series, detail::series_exp_enabler<Series>> {
+    /// Call operator.
+    /**
+     * @param[in] s argument.
+     *
+     * @return exponential of \p s.
+     *
+     * @throws unspecified any exception thrown by:
+     * - the <tt>Series::exp()</tt> method,
+     * - piranha::math::exp(),
+     * - term, coefficient, and key construction and/or insertion via piranha::series::insert(),
+     * - returning the result.
+     */
+    auto operator()(const Series &s) const -> decltype(detail::series_exp_impl(s))
+    {
+        return detail::series_exp_impl(s);
+    }
+};
+
+/// Specialisation of the piranha::math::log() functor for piranha::series.
+/**
+ * This specialisation is activated when \p Series is an instance of piranha::series and:
+ * - either the series type provides a const <tt>%log()</tt> method returning a type which satisfies
+ *   piranha::is_returnable, or, missing this method,
+ * - the series' coefficient type \p Cf supports math::log() yielding a type \p T and either
+ *   \p T is the same as \p Cf, or the series type can be rebound to the type \p T.
+ */
+template <typename Series>
+struct log_impl<Series, detail::series_log_enabler<Series>> {
+    /// Call operator.
+    /**
+     * @param[in] s argument.
+     *
+     * @return logarithm of \p s.
+     *
+     * @throws unspecified any exception thrown by:
+     * - the <tt>Series::log()</tt> method,
+     * - piranha::math::log(),
+     * - term, coefficient, and key construction and/or insertion via piranha::series::insert(),
+     * - returning the result.
+     */
+    auto operator()(const Series &s) const -> decltype(detail::series_log_impl(s))
+    {
+        return detail::series_log_impl(s);
+    }
+};
+}
+
+namespace detail
+{
+
 // Enabler for the partial() specialisation for series.
 template <typename Series>
 using series_partial_enabler =
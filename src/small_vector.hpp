@@ -993,8 +993,11 @@ public:
         }
         // NOTE: if retval coincides with this and/or other, this will be a no-op as
         // the resize methods don't do anything if the new size is the same as the old one.
-        // Thus, we are not risking of invalidating sbe1/sbe2 with this resize.
-        retval.resize(std::get<0u>(sbe1));
+        // Thus, we are not risking of invalidating sbe1/sbe2 with this resize. The size check here
+        // is a shortcut for the common case in which retval is being reused (e.g., in series multiplication).
+        if (retval.size() != std::get<0u>(sbe1)) {
+            retval.resize(std::get<0u>(sbe1));
+        }
         auto sbe_out = retval.size_begin_end();
         for (size_type i = 0u; i < std::get<0u>(sbe1); ++i) {
             math::add3(*(std::get<1u>(sbe_out) + i), *(std::get<1u>(sbe1) + i), *(std::get<1u>(sbe2) + i));
@@ -1029,7 +1032,9 @@ public:
         if (unlikely(std::get<0u>(sbe1) != std::get<0u>(sbe2))) {
             piranha_throw(std::invalid_argument, "vector size mismatch");
         }
-        retval.resize(std::get<0u>(sbe1));
+        if (retval.size() != std::get<0u>(sbe1)) {
+            retval.resize(std::get<0u>(sbe1));
+        }
         auto sbe_out = retval.size_begin_end();
         for (size_type i = 0u; i < std::get<0u>(sbe1); ++i) {
             math::sub3(*(std::get<1u>(sbe_out) + i), *(std::get<1u>(sbe1) + i), *(std::get<1u>(sbe2) + i));
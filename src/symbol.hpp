@@ -32,9 +32,10 @@ see https://www.gnu.org/licenses/. */
 #include <cstddef>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <mutex>
-#include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "config.hpp"
@@ -46,17 +47,21 @@ namespace piranha
 namespace detail
 {
 
+// The global registry of symbols maps each name to a dense integral id, assigned in order of creation.
+// The registry is a node-based container, so that pointers to its elements remain valid for the duration
+// of the program.
 template <typename = int>
 struct base_symbol {
+    using entry_type = std::map<std::string, std::size_t>::value_type;
     static std::mutex m_mutex;
-    static std::set<std::string> m_symbol_list;
+    static std::map<std::string, std::size_t> m_symbol_list;
 };
 
 template <typename T>
 std::mutex base_symbol<T>::m_mutex;
 
 template <typename T>
-std::set<std::string> base_symbol<T>::m_symbol_list;
+std::map<std::string, std::size_t> base_symbol<T>::m_symbol_list;
 }
 
 /// Literal symbol class.
@@ -64,7 +69,12 @@ std::set<std::string> base_symbol<T>::m_symbol_list;
  * This class represents a symbolic variable uniquely identified by its name. Symbol instances
  * are tracked in a global list for the duration of the program, so that different instances of symbols with the same
  * name are always
- * referring to the same underlying object.
+ * referring to the same underlying object. Each symbol is also associated to a unique integral id, which is
+ * assigned when a name is used for the first time and which is used for hashing.
+ *
+ * If the compiler supports \p thread_local, every thread keeps a cache of the symbols it has already looked up,
+ * so that the construction of a symbol from a name that has already been seen by the calling thread does not need
+ * to lock the global list.
  *
  * The methods of this class, unless specified otherwise, are thread-safe: it is possible to create, access and operate
  * on objects of this class
@@ -91,7 +101,7 @@ public:
      *
      * @param[in] name name of the symbol.
      *
-     * @throws unspecified any exception thrown by <tt>std::set::insert()</tt>.
+     * @throws unspecified any exception thrown by memory errors in standard containers.
      */
     explicit symbol(const std::string &name) : m_ptr(get_pointer(name))
     {
@@ -112,7 +122,18 @@ public:
      */
     const std::string &get_name() const
     {
-        return *m_ptr;
+        return m_ptr->first;
+    }
+    /// Id getter.
+    /**
+     * The id of a symbol is a unique integral value, assigned sequentially (starting from zero)
+     * the first time a symbol with a given name is constructed.
+     *
+     * @return the id of the symbol.
+     */
+    std::size_t get_id() const
+    {
+        return m_ptr->second;
     }
     /// Equality operator.
     /**
@@ -144,15 +165,15 @@ public:
      */
     bool operator<(const symbol &other) const
     {
-        return get_name() < other.get_name();
+        return m_ptr != other.m_ptr && get_name() < other.get_name();
     }
     /// Hash value.
     /**
-     * @return a hash value for the symbol.
+     * @return a hash value for the symbol, computed from its id.
      */
     std::size_t hash() const
     {
-        return std::hash<std::string const *>()(m_ptr);
+        return std::hash<std::size_t>()(get_id());
     }
     /// Overload output stream operator for piranha::symbol.
     /**
@@ -170,20 +191,38 @@ public:
     }
 
 private:
-    static std::string const *get_pointer(const std::string &name)
+    static entry_type const *get_pointer(const std::string &name)
+    {
+#if defined(PIRANHA_HAVE_THREAD_LOCAL)
+        // Look first into the thread-local cache: entries in the global list are never removed,
+        // so a cached pointer stays valid and it can be used without locking.
+        static thread_local std::unordered_map<std::string, entry_type const *> cache;
+        const auto c_it = cache.find(name);
+        if (c_it != cache.end()) {
+            return c_it->second;
+        }
+        const auto retval = get_pointer_locked(name);
+        cache.emplace(name, retval);
+        return retval;
+#else
+        return get_pointer_locked(name);
+#endif
+    }
+    static entry_type const *get_pointer_locked(const std::string &name)
     {
         std::lock_guard<std::mutex> lock(m_mutex);
         auto it = m_symbol_list.find(name);
         if (it == m_symbol_list.end()) {
-            // If symbol is not present in the list, add it.
-            auto retval = m_symbol_list.insert(name);
-            piranha_assert(retval.second);
-            it = retval.first;
+            // If symbol is not present in the list, add it with the next id.
+            const auto id = m_symbol_list.size();
+            auto ins = m_symbol_list.emplace(name, id);
+            piranha_assert(ins.second);
+            it = ins.first;
         }
         // Final check, just for peace of mind.
         piranha_assert(it != m_symbol_list.end());
-        // Extract and return the pointer.
-        // NOTE: this is legal, as std::set is a standard container:
+        // Extract the pointer.
+        // NOTE: this is legal, as std::map is a standard container:
         // http://www.gotw.ca/gotw/050.htm
         return &*it;
     }
@@ -192,7 +231,7 @@ private:
     template <class Archive>
     void save(Archive &ar, unsigned int) const
     {
-        ar &(*m_ptr);
+        ar &(m_ptr->first);
     }
     template <class Archive>
     void load(Archive &ar, unsigned int)
@@ -203,7 +242,7 @@ private:
     }
     BOOST_SERIALIZATION_SPLIT_MEMBER()
 private:
-    std::string const *m_ptr;
+    entry_type const *m_ptr;
 };
 }
 
@@ -35,6 +35,7 @@ see https://www.gnu.org/licenses/. */
 #include <limits>
 #include <set>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -244,6 +245,7 @@ public:
         /// Const iterator.
         using const_iterator = typename std::vector<value_type>::const_iterator;
         explicit positions_map(const symbol_set &, const std::unordered_map<symbol, T> &);
+        explicit positions_map(const symbol_set &, const std::unordered_map<std::string, T> &);
         /// Deleted copy constructor.
         positions_map(const positions_map &) = delete;
         /// Defaulted move constructor.
@@ -622,29 +624,54 @@ inline symbol_set::positions::positions(const symbol_set &a, const symbol_set &b
 /// Constructor from map and set.
 /**
  * The internal vector of pairs will contain the positions in \p a of the mapped values
- * of \p map appearing in the set \p a, and the mapped values themselves.
+ * of \p map appearing in the set \p a, and the mapped values themselves. The symbols in \p a are looked up
+ * in \p map via their ids, so that no string is hashed or compared.
  *
  * @param[in] a reference set.
  * @param[in] map input map.
  *
- * @throws unspecified any exception thrown by memory errors in standard containers, by
- * the copy constructor of \p T, or by <tt>std::stable_sort()</tt>.
+ * @throws unspecified any exception thrown by memory errors in standard containers, or by
+ * the copy constructor of \p T.
  */
 template <typename T>
 inline symbol_set::positions_map<T>::positions_map(const symbol_set &a, const std::unordered_map<symbol, T> &map)
 {
-    for (const auto &p : map) {
-        const auto idx = a.index_of(p.first);
-        if (idx != a.size()) {
-            m_pairs.push_back(std::make_pair(idx, p.second));
+    if (map.empty()) {
+        return;
+    }
+    for (size_type i = 0u; i < a.size(); ++i) {
+        const auto it = map.find(a[i]);
+        if (it != map.end()) {
+            m_pairs.push_back(std::make_pair(i, it->second));
+        }
+    }
+}
+
+/// Constructor from string map and set.
+/**
+ * The internal vector of pairs will contain the positions in \p a of the symbols whose names appear
+ * in \p map, and the mapped values themselves. The result is the same as constructing a piranha::symbol
+ * from each key in \p map and then calling the constructor from a map of symbols, but the symbols in \p a
+ * are looked up by name in \p map instead. This avoids any access to the global list of symbols.
+ *
+ * @param[in] a reference set.
+ * @param[in] map input map.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers, or by
+ * the copy constructor of \p T.
+ */
+template <typename T>
+inline symbol_set::positions_map<T>::positions_map(const symbol_set &a, const std::unordered_map<std::string, T> &map)
+{
+    if (map.empty()) {
+        return;
+    }
+    for (size_type i = 0u; i < a.size(); ++i) {
+        const auto it = map.find(a[i].get_name());
+        if (it != map.end()) {
+            m_pairs.push_back(std::make_pair(i, it->second));
         }
     }
-    std::stable_sort(m_pairs.begin(), m_pairs.end(),
-                     [](const value_type &p1, const value_type &p2) { return p1.first < p2.first; });
-    // Check that there are no duplicate positions.
-    piranha_assert(std::unique(m_pairs.begin(), m_pairs.end(),
-                               [](const value_type &p1, const value_type &p2) { return p1.first == p2.first; })
-                   == m_pairs.end());
 }
 }
 
@@ -29,10 +29,13 @@ see https://www.gnu.org/licenses/. */
 #ifndef PIRANHA_T_SUBSTITUTABLE_SERIES_HPP
 #define PIRANHA_T_SUBSTITUTABLE_SERIES_HPP
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 
+#include "detail/grouped_subs.hpp"
 #include "forwarding.hpp"
 #include "math.hpp"
 #include "serialization.hpp"
@@ -165,6 +168,173 @@ class t_substitutable_series : public Series, detail::t_substitutable_series_tag
         = decltype(t_subs_utils<T, U>::subs(std::declval<typename Series::term_type const &>(),
                                             std::declval<const std::string &>(), std::declval<const T &>(),
                                             std::declval<const U &>(), std::declval<symbol_set const &>()));
+    // Detect if the substitution can be performed by grouping the terms (i.e., only the keys are affected by
+    // the substitution and the key type supports splitting).
+    template <typename T, typename U, typename Term = typename Series::term_type, typename = void>
+    struct grouped_t_subs : std::false_type {
+    };
+    template <typename T, typename U, typename Term>
+    struct grouped_t_subs<T, U, Term,
+                          typename std::enable_if<t_subs_term_score<Term, T, U>::value == 2u
+                                                  && detail::key_has_subs_split<typename Term::key_type>::value>::type>
+        : std::true_type {
+    };
+    // Detect if the substitution affects only the coefficients, preserving their type.
+    template <typename T, typename U, typename Term = typename Series::term_type, typename = void>
+    struct cf_only_t_subs : std::false_type {
+    };
+    template <typename T, typename U, typename Term>
+    struct cf_only_t_subs<
+        T, U, Term,
+        typename std::enable_if<t_subs_term_score<Term, T, U>::value == 1u
+                                && std::is_same<decltype(math::t_subs(std::declval<typename Term::cf_type const &>(),
+                                                                      std::declval<std::string const &>(),
+                                                                      std::declval<T const &>(),
+                                                                      std::declval<U const &>())),
+                                                typename Term::cf_type>::value
+                                && std::is_same<t_subs_type<T, U>, Derived>::value>::type> : std::true_type {
+    };
+    template <typename T, typename U>
+    using grouped_t_subs_enabler = typename std::enable_if<grouped_t_subs<T, U>::value, int>::type;
+    template <typename T, typename U>
+    using cf_only_t_subs_enabler = typename std::enable_if<cf_only_t_subs<T, U>::value, int>::type;
+    template <typename T, typename U>
+    using generic_t_subs_enabler =
+        typename std::enable_if<!grouped_t_subs<T, U>::value && !cf_only_t_subs<T, U>::value, int>::type;
+    // Generic implementation of t_subs().
+    template <typename T, typename U, generic_t_subs_enabler<T, U> = 0>
+    t_subs_type<T, U> t_subs_impl(const std::string &name, const T &c, const U &s) const
+    {
+        t_subs_type<T, U> retval(0);
+        for (const auto &t : this->m_container) {
+            retval += t_subs_utils<T, U>::subs(t, name, c, s, this->m_symbol_set);
+        }
+        return retval;
+    }
+    // Implementation by grouping of the terms.
+    template <typename T, typename U, grouped_t_subs_enabler<T, U> = 0>
+    t_subs_type<T, U> t_subs_impl(const std::string &name, const T &c, const U &s) const
+    {
+        using key_type = typename Series::term_type::key_type;
+        const auto &s_set = this->m_symbol_set;
+        return detail::grouped_subs<t_subs_type<T, U>>(
+            *static_cast<Derived const *>(this),
+            [&name, &s_set](const key_type &k) { return k.subs_split(name, s_set); },
+            [&name, &c, &s, &s_set](const key_type &k) { return k.t_subs(name, c, s, s_set); });
+    }
+    // Implementation when only the coefficients are affected.
+    template <typename T, typename U, cf_only_t_subs_enabler<T, U> = 0>
+    Derived t_subs_impl(const std::string &name, const T &c, const U &s) const
+    {
+        using cf_type = typename Series::term_type::cf_type;
+        return detail::cf_only_subs(*static_cast<Derived const *>(this),
+                                    [&name, &c, &s](const cf_type &cf) { return math::t_subs(cf, name, c, s); });
+    }
+    // Simultaneous trigonometric substitution of several symbols.
+    template <typename T, typename U>
+    using dict_type = std::unordered_map<std::string, std::pair<T, U>>;
+    template <typename T, typename U>
+    using dict_items = detail::subs_dict_items<std::pair<T, U>>;
+    // Requirements on the coefficients: if they are affected by the substitution, they must support simultaneous
+    // substitution, yielding the same type as the substitution of a single symbol.
+    template <typename T, typename U, typename Term, typename = void>
+    struct dict_cf_check : std::integral_constant<bool, (t_subs_term_score<Term, T, U>::value & 1u) == 0u> {
+    };
+    template <typename T, typename U, typename Term>
+    struct dict_cf_check<
+        T, U, Term,
+        typename std::enable_if<std::is_same<decltype(std::declval<typename Term::cf_type const &>().t_subs(
+                                                 std::declval<const dict_type<T, U> &>())),
+                                             decltype(math::t_subs(std::declval<typename Term::cf_type const &>(),
+                                                                   std::declval<std::string const &>(),
+                                                                   std::declval<T const &>(),
+                                                                   std::declval<U const &>()))>::value>::type>
+        : std::true_type {
+    };
+    // Chained substitution of the items in a key.
+    template <typename T, typename U, typename Key>
+    using key_t_subs_type = decltype(std::declval<const Key &>().t_subs(
+        std::declval<const std::string &>(), std::declval<const T &>(), std::declval<const U &>(),
+        std::declval<const symbol_set &>()));
+    template <typename T, typename U, typename Key>
+    static key_t_subs_type<T, U, Key> key_dict_t_subs(const Key &k, const dict_items<T, U> &items,
+                                                      const symbol_set &s_set)
+    {
+        return detail::chain_key_subs(k, items.size(), [&items, &s_set](std::size_t i, const Key &key) {
+            return key.t_subs(*items[i].first, items[i].second->first, items[i].second->second, s_set);
+        });
+    }
+    // Requirements on the keys: if they are affected by the substitution, the values resulting from the substitution
+    // must be multipliable in place.
+    template <typename T, typename U, typename Term, typename = void>
+    struct dict_key_check : std::integral_constant<bool, (t_subs_term_score<Term, T, U>::value & 2u) == 0u> {
+    };
+    template <typename T, typename U, typename Term>
+    struct dict_key_check<T, U, Term, typename std::enable_if<is_multipliable_in_place<
+                                          typename key_t_subs_type<T, U, typename Term::key_type>::value_type::
+                                              first_type>::value>::type> : std::true_type {
+    };
+    template <typename T, typename U>
+    using t_subs_dict_type =
+        typename std::enable_if<dict_cf_check<T, U, typename Series::term_type>::value
+                                    && dict_key_check<T, U, typename Series::term_type>::value
+                                    && is_addable_in_place<t_subs_type<T, U>, Derived>::value,
+                                t_subs_type<T, U>>::type;
+    // Simultaneous substitution in a term, case 1: t_subs on cf only.
+    template <typename T, typename U, typename Term,
+              typename std::enable_if<t_subs_term_score<Term, T, U>::value == 1u, int>::type = 0>
+    static t_subs_type<T, U> t_subs_term_dict_impl(const Term &t, const dict_type<T, U> &dict,
+                                                   const dict_items<T, U> &, const symbol_set &s_set)
+    {
+        Derived tmp;
+        tmp.m_symbol_set = s_set;
+        tmp.insert(Term(typename Term::cf_type(1), t.m_key));
+        return t.m_cf.t_subs(dict) * tmp;
+    }
+    // Case 2: t_subs on key only.
+    template <typename T, typename U, typename Term,
+              typename std::enable_if<t_subs_term_score<Term, T, U>::value == 2u, int>::type = 0>
+    static t_subs_type<T, U> t_subs_term_dict_impl(const Term &t, const dict_type<T, U> &,
+                                                   const dict_items<T, U> &items, const symbol_set &s_set)
+    {
+        t_subs_type<T, U> retval(0);
+        const auto key_subs = key_dict_t_subs(t.m_key, items, s_set);
+        for (const auto &x : key_subs) {
+            Derived tmp;
+            tmp.m_symbol_set = s_set;
+            tmp.insert(Term(t.m_cf, x.second));
+            retval += x.first * tmp;
+        }
+        return retval;
+    }
+    template <typename T, typename U, cf_only_t_subs_enabler<T, U> = 0>
+    Derived t_subs_dict_impl(const dict_type<T, U> &dict) const
+    {
+        using cf_type = typename Series::term_type::cf_type;
+        return detail::cf_only_subs(*static_cast<Derived const *>(this),
+                                    [&dict](const cf_type &cf) { return cf.t_subs(dict); });
+    }
+    // Generic implementation of the simultaneous substitution: the terms are processed in parallel blocks.
+    // NOTE: the splitting of the keys is not used here, as the splits of trigonometric keys produce more than
+    // one key per symbol.
+    template <typename T, typename U, typename std::enable_if<!cf_only_t_subs<T, U>::value, int>::type = 0>
+    t_subs_type<T, U> t_subs_dict_impl(const dict_type<T, U> &dict) const
+    {
+        const auto &s_set = this->m_symbol_set;
+        // NOTE: the symbols not appearing in the series can be ignored if only the keys are affected.
+        const auto items = (t_subs_term_score<typename Series::term_type, T, U>::value == 2u)
+                               ? detail::sorted_subs_dict_items(dict, &s_set)
+                               : detail::sorted_subs_dict_items(dict);
+        if (items.empty()) {
+            t_subs_type<T, U> retval(0);
+            retval += *static_cast<Derived const *>(this);
+            return retval;
+        }
+        return detail::blocked_subs<t_subs_type<T, U>>(
+            *static_cast<Derived const *>(this), [&dict, &items, &s_set](const typename Series::term_type &t) {
+                return t_subs_term_dict_impl(t, dict, items, s_set);
+            });
+    }
     PIRANHA_SERIALIZE_THROUGH_BASE(base)
 public:
     /// Defaulted default constructor.
@@ -193,6 +363,13 @@ public:
      *
      * Trigonometric substitution is the substitution of the cosine and sine of \p name for \p c and \p s.
      *
+     * If the substitution affects only the keys and the key type provides a <tt>subs_split()</tt> method
+     * (e.g., piranha::real_trigonometric_kronecker_monomial::subs_split()), the terms are grouped by the multiplier
+     * of \p name (and by the other quantities on which the substitution depends): the multiple-angle formulae are
+     * evaluated once per group and multiplied by the sums of the cofactors of the group, and the groups are processed
+     * in parallel. If the substitution affects only the coefficients and it does not change their type, the
+     * coefficients are substituted in parallel and the result is built directly from the original keys.
+     *
      * @param[in] name name of the symbol that will be subject to substitution.
      * @param[in] c cosine of \p name.
      * @param[in] s sine of \p name.
@@ -205,16 +382,55 @@ public:
      * - term construction,
      * - arithmetics on the intermediary values needed to compute the return value,
      * - piranha::series::insert(),
-     * - the substitution methods of coefficient and key.
+     * - the substitution methods of coefficient and key,
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back().
      */
     template <typename T, typename U>
     t_subs_type<T, U> t_subs(const std::string &name, const T &c, const U &s) const
     {
-        t_subs_type<T, U> retval(0);
-        for (const auto &t : this->m_container) {
-            retval += t_subs_utils<T, U>::subs(t, name, c, s, this->m_symbol_set);
+        return t_subs_impl(name, c, s);
+    }
+    /// Simultaneous trigonometric substitution.
+    /**
+     * \note
+     * This method is enabled only if the t_subs() overload for a single symbol is enabled, and if:
+     * - the coefficient type, if it supports trigonometric substitution, provides a simultaneous substitution method
+     *   yielding the same type as piranha::math::t_subs(),
+     * - the values resulting from the substitution in the keys, if the keys support trigonometric substitution,
+     *   are multipliable in place,
+     * - the return type is addable in place with \p Derived.
+     *
+     * This method will return an object resulting from the simultaneous trigonometric substitution of the symbols in
+     * \p dict. Each element of \p dict associates the name of a symbol to the pair of its cosine and sine.
+     * The substitution is performed in a single pass over the terms of \p this, and the substituted values are never
+     * subject to further substitutions. The return type is the same as in the substitution of a single symbol, and an
+     * empty \p dict results in a copy of \p this.
+     *
+     * If the substitution affects only the coefficients and it does not change their type, the coefficients are
+     * substituted in parallel. Otherwise, the terms are processed in parallel blocks.
+     *
+     * @param[in] dict dictionary associating the names of the symbols to be substituted to their cosines and sines.
+     *
+     * @return the result of the simultaneous trigonometric substitution.
+     *
+     * @throws unspecified any exception resulting from:
+     * - construction of the return type,
+     * - term construction,
+     * - arithmetics on the intermediary values needed to compute the return value,
+     * - memory errors in standard containers,
+     * - piranha::series::insert(),
+     * - the substitution methods of coefficient and key,
+     * - piranha::thread_pool::enqueue() and piranha::future_list::push_back().
+     */
+    template <typename T, typename U>
+    t_subs_dict_type<T, U> t_subs(const std::unordered_map<std::string, std::pair<T, U>> &dict) const
+    {
+        if (dict.empty()) {
+            t_subs_dict_type<T, U> retval(0);
+            retval += *static_cast<Derived const *>(this);
+            return retval;
         }
-        return retval;
+        return t_subs_dict_impl(dict);
     }
 };
 
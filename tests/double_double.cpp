@@ -0,0 +1,330 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include "../src/double_double.hpp"
+
+#define BOOST_TEST_MODULE double_double_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../src/init.hpp"
+#include "../src/is_cf.hpp"
+#include "../src/kronecker_monomial.hpp"
+#include "../src/math.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/mp_rational.hpp"
+#include "../src/poisson_series.hpp"
+#include "../src/polynomial.hpp"
+#include "../src/pow.hpp"
+#include "../src/real.hpp"
+#include "../src/safe_cast.hpp"
+#include "../src/serialization.hpp"
+#include "../src/type_traits.hpp"
+
+static std::mt19937 rng;
+static const int ntries = 1000;
+
+using namespace piranha;
+
+// Check that a and b agree to about 100 bits.
+static bool close_to(const double_double &a, const real &b)
+{
+    const real diff = math::abs(static_cast<real>(a) - b);
+    return diff <= math::abs(b) * math::pow(real{2}, -100) || diff <= math::pow(real{2}, -1000);
+}
+
+static long long ll_max_dd()
+{
+    return std::numeric_limits<long long>::max();
+}
+
+// Random double_double, generated via the sum of two random doubles.
+static double_double random_dd()
+{
+    std::uniform_real_distribution<double> dist(-1., 1.);
+    std::uniform_int_distribution<int> exp_dist(-20, 20);
+    const double hi = std::ldexp(dist(rng), exp_dist(rng));
+    return double_double(hi, hi * dist(rng) * std::ldexp(1., -60));
+}
+
+BOOST_AUTO_TEST_CASE(double_double_constructors_test)
+{
+    init();
+    BOOST_CHECK(is_cf<double_double>::value);
+    BOOST_CHECK((std::is_constructible<double_double, int>::value));
+    BOOST_CHECK((std::is_constructible<double_double, real>::value));
+    BOOST_CHECK((!std::is_constructible<double_double, std::vector<int>>::value));
+    BOOST_CHECK((!std::is_convertible<int, double_double>::value));
+    double_double d;
+    BOOST_CHECK_EQUAL(d.hi(), 0.);
+    BOOST_CHECK_EQUAL(d.lo(), 0.);
+    BOOST_CHECK(d.is_zero());
+    BOOST_CHECK_EQUAL(d.sign(), 0);
+    BOOST_CHECK_EQUAL(double_double{42}.hi(), 42.);
+    BOOST_CHECK_EQUAL(double_double{-42}.sign(), -1);
+    BOOST_CHECK_EQUAL(double_double{1.5f}.hi(), 1.5);
+    // Large integral values are represented exactly.
+    const auto ll_max = std::numeric_limits<long long>::max(), ll_min = std::numeric_limits<long long>::min();
+    BOOST_CHECK_EQUAL(static_cast<long long>(double_double{ll_max}), ll_max);
+    BOOST_CHECK_EQUAL(static_cast<long long>(double_double{ll_min}), ll_min);
+    BOOST_CHECK_EQUAL(static_cast<long long>(double_double{ll_max - 1}), ll_max - 1);
+    BOOST_CHECK_EQUAL(static_cast<unsigned long long>(double_double{std::numeric_limits<unsigned long long>::max()}),
+                      std::numeric_limits<unsigned long long>::max());
+    // Components.
+    double_double c(1., std::ldexp(1., -80));
+    BOOST_CHECK_EQUAL(c.hi(), 1.);
+    BOOST_CHECK_EQUAL(c.lo(), std::ldexp(1., -80));
+    c = double_double(std::ldexp(1., -80), 1.);
+    BOOST_CHECK_EQUAL(c.hi(), 1.);
+    BOOST_CHECK_EQUAL(c.lo(), std::ldexp(1., -80));
+    // mp types.
+    const integer big = integer(1) << 120;
+    BOOST_CHECK_EQUAL(static_cast<integer>(double_double{big + 1}), big);
+    BOOST_CHECK_EQUAL(static_cast<integer>(double_double{(integer(1) << 80) + 1}), (integer(1) << 80) + 1);
+    BOOST_CHECK(close_to(double_double{rational(1, 3)}, real{1} / 3));
+    BOOST_CHECK_EQUAL(double_double{rational(1, 2)}, 0.5);
+    // Strings.
+    BOOST_CHECK(close_to(double_double{"0.1"}, real{"0.1"}));
+    BOOST_CHECK(close_to(double_double{std::string("-1.25e-3")}, real{"-1.25e-3"}));
+    BOOST_CHECK_THROW(double_double{"foo"}, std::invalid_argument);
+    // real.
+    const real third = real{1} / 3;
+    BOOST_CHECK(close_to(double_double{third}, third));
+    // Assignment.
+    d = 3;
+    BOOST_CHECK_EQUAL(d, 3);
+    d = rational(1, 4);
+    BOOST_CHECK_EQUAL(d, 0.25);
+    d = "2";
+    BOOST_CHECK_EQUAL(d, 2);
+    d = std::string("-2");
+    BOOST_CHECK_EQUAL(d, -2);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_conversion_test)
+{
+    BOOST_CHECK(static_cast<bool>(double_double{1}));
+    BOOST_CHECK(!static_cast<bool>(double_double{}));
+    BOOST_CHECK_EQUAL(static_cast<int>(double_double{2.5}), 2);
+    BOOST_CHECK_EQUAL(static_cast<int>(double_double{-2.5}), -2);
+    // Truncation must take into account the low component.
+    BOOST_CHECK_EQUAL(static_cast<int>(double_double(3., -std::ldexp(1., -70))), 2);
+    BOOST_CHECK_EQUAL(static_cast<int>(double_double(-3., std::ldexp(1., -70))), -2);
+    BOOST_CHECK_EQUAL(static_cast<int>(double_double(3., std::ldexp(1., -70))), 3);
+    BOOST_CHECK_THROW(static_cast<int>(double_double{std::numeric_limits<double>::infinity()}), std::overflow_error);
+    BOOST_CHECK_THROW(static_cast<int>(double_double{1E100}), std::overflow_error);
+    BOOST_CHECK_EQUAL(static_cast<double>(double_double(1., std::ldexp(1., -80))), 1.);
+    // Exact conversion to rational.
+    BOOST_CHECK_EQUAL(static_cast<rational>(double_double(1., std::ldexp(1., -80))),
+                      rational(1) + rational(1, integer(1) << 80));
+    BOOST_CHECK_THROW(static_cast<rational>(double_double{std::numeric_limits<double>::quiet_NaN()}),
+                      std::invalid_argument);
+    BOOST_CHECK_EQUAL(static_cast<real>(double_double(1., std::ldexp(1., -80))), real{1} + math::pow(real{2}, -80));
+    // Non-finite values.
+    BOOST_CHECK(std::isinf(double_double{std::numeric_limits<double>::infinity()}.hi()));
+    BOOST_CHECK(std::isnan(double_double{std::numeric_limits<double>::quiet_NaN()}.hi()));
+}
+
+BOOST_AUTO_TEST_CASE(double_double_arithmetic_test)
+{
+    for (int i = 0; i < ntries; ++i) {
+        const auto a = random_dd(), b = random_dd();
+        const real ra(a), rb(b);
+        BOOST_CHECK(close_to(a + b, ra + rb));
+        BOOST_CHECK(close_to(a - b, ra - rb));
+        BOOST_CHECK(close_to(a * b, ra * rb));
+        if (!b.is_zero()) {
+            BOOST_CHECK(close_to(a / b, ra / rb));
+        }
+        auto c(a);
+        c.multiply_accumulate(a, b);
+        BOOST_CHECK(close_to(c, ra + ra * rb));
+        c = a;
+        math::multiply_accumulate(c, a, b);
+        BOOST_CHECK(close_to(c, ra + ra * rb));
+        c = a;
+        c += b;
+        BOOST_CHECK_EQUAL(c, a + b);
+        c -= b;
+        BOOST_CHECK_EQUAL(c, a + b - b);
+        c = a;
+        c *= b;
+        BOOST_CHECK_EQUAL(c, a * b);
+        c /= 3;
+        BOOST_CHECK(close_to(c, ra * rb / 3));
+    }
+    // Mixed operations.
+    BOOST_CHECK((std::is_same<decltype(double_double{} + 1), double_double>::value));
+    BOOST_CHECK((std::is_same<decltype(1. - double_double{}), double_double>::value));
+    BOOST_CHECK((std::is_same<decltype(integer{} * double_double{}), double_double>::value));
+    BOOST_CHECK((std::is_same<decltype(double_double{} / rational{1}), double_double>::value));
+    BOOST_CHECK((!is_addable<double_double, real>::value));
+    BOOST_CHECK((!is_addable<double_double, std::string>::value));
+    BOOST_CHECK_EQUAL(double_double{1} + 1, 2);
+    BOOST_CHECK_EQUAL(1 - double_double{3}, -2);
+    BOOST_CHECK_EQUAL(2 * double_double{3}, 6);
+    BOOST_CHECK_EQUAL(double_double{3} / 2., 1.5);
+    BOOST_CHECK(close_to(double_double{1} / 3, real{1} / 3));
+    BOOST_CHECK(close_to(rational(1, 3) * double_double{3}, real{1}));
+    // 0.1 + 0.2 == 0.3 at this precision, computing from the decimal representations.
+    BOOST_CHECK(math::abs(double_double{"0.1"} + double_double{"0.2"} - double_double{"0.3"}) < 1E-31);
+    // Catastrophic cancellation handled correctly.
+    const double_double one_eps(1., std::ldexp(1., -100));
+    BOOST_CHECK_EQUAL(one_eps - 1, std::ldexp(1., -100));
+    BOOST_CHECK_EQUAL(-one_eps, double_double(-1., -std::ldexp(1., -100)));
+    BOOST_CHECK_EQUAL(+one_eps, one_eps);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_comparison_test)
+{
+    const double_double a(1., std::ldexp(1., -80)), b(1.);
+    BOOST_CHECK(a != b);
+    BOOST_CHECK(b == 1);
+    BOOST_CHECK(1 == b);
+    BOOST_CHECK(b < a);
+    BOOST_CHECK(b <= a);
+    BOOST_CHECK(a > b);
+    BOOST_CHECK(a >= b);
+    BOOST_CHECK(a > 1);
+    BOOST_CHECK(1 < a);
+    BOOST_CHECK(a <= a);
+    BOOST_CHECK(a >= a);
+    BOOST_CHECK(-a < -b);
+    BOOST_CHECK(double_double(1., -std::ldexp(1., -80)) < b);
+    BOOST_CHECK(b == integer(1));
+    BOOST_CHECK(b == rational(2, 2));
+    BOOST_CHECK(is_equality_comparable<double_double>::value);
+    BOOST_CHECK((is_equality_comparable<double_double, int>::value));
+    BOOST_CHECK((is_less_than_comparable<double_double, rational>::value));
+    BOOST_CHECK((!is_equality_comparable<double_double, real>::value));
+}
+
+BOOST_AUTO_TEST_CASE(double_double_math_test)
+{
+    double_double x(-3);
+    math::negate(x);
+    BOOST_CHECK_EQUAL(x, 3);
+    BOOST_CHECK(math::is_zero(double_double{}));
+    BOOST_CHECK(!math::is_zero(x));
+    BOOST_CHECK_EQUAL(math::abs(double_double{-2}), 2);
+    BOOST_CHECK_EQUAL(math::partial(x, "x"), 0);
+    BOOST_CHECK_EQUAL(math::evaluate(x, std::unordered_map<std::string, double_double>{}), x);
+    // Pow.
+    BOOST_CHECK((std::is_same<decltype(math::pow(x, 2)), double_double>::value));
+    BOOST_CHECK_EQUAL(math::pow(x, 0), 1);
+    BOOST_CHECK_EQUAL(math::pow(x, 5u), 243);
+    BOOST_CHECK_EQUAL(math::pow(x, integer(3)), 27);
+    BOOST_CHECK(close_to(math::pow(x, -3), real{1} / 27));
+    BOOST_CHECK(close_to(math::pow(double_double{1} / 3, 40), math::pow(real{1} / 3, 40)));
+    BOOST_CHECK_EQUAL(math::pow(double_double{2}, std::numeric_limits<int>::min()), 0);
+    BOOST_CHECK(close_to(math::pow(double_double{2}, .5), math::pow(real{2}, real{.5})));
+    BOOST_CHECK(close_to(math::pow(double_double{2}, double_double{1} / 3), math::pow(real{2}, real{1} / 3)));
+    BOOST_CHECK_THROW(math::pow(x, integer(1) << 80), std::overflow_error);
+    BOOST_CHECK(std::isinf(math::pow(double_double{2}, 2000).hi()));
+    BOOST_CHECK(std::isinf((double_double{1E300} * 1E300 + 1).hi()));
+    BOOST_CHECK_EQUAL(double_double{1} / std::numeric_limits<double>::infinity(), 0);
+    // Safe cast.
+    BOOST_CHECK_EQUAL(safe_cast<int>(double_double{-3}), -3);
+    BOOST_CHECK_EQUAL(safe_cast<integer>(double_double{ll_max_dd()}), integer(std::numeric_limits<long long>::max()));
+    BOOST_CHECK_THROW(safe_cast<int>(double_double{1.5}), std::invalid_argument);
+    BOOST_CHECK_THROW(safe_cast<int>(double_double(3., std::ldexp(1., -70))), std::invalid_argument);
+    BOOST_CHECK_THROW(safe_cast<integer>(double_double{std::numeric_limits<double>::infinity()}),
+                      std::invalid_argument);
+    BOOST_CHECK_EQUAL(safe_cast<rational>(double_double{.25}), rational(1, 4));
+    // Trigonometry.
+    const double_double t("0.7");
+    BOOST_CHECK(close_to(math::sin(t), math::sin(real{"0.7"})));
+    BOOST_CHECK(close_to(math::cos(t), math::cos(real{"0.7"})));
+    BOOST_CHECK(close_to(math::sin(t) * math::sin(t) + math::cos(t) * math::cos(t), real{1}));
+}
+
+BOOST_AUTO_TEST_CASE(double_double_stream_test)
+{
+    std::ostringstream oss;
+    oss << double_double{"1.5"};
+    BOOST_CHECK_EQUAL(oss.str(), boost::lexical_cast<std::string>(real{"1.5"}));
+    double_double tmp;
+    std::istringstream iss("0.1");
+    iss >> tmp;
+    BOOST_CHECK_EQUAL(tmp, double_double{"0.1"});
+    BOOST_CHECK_EQUAL(boost::lexical_cast<double_double>(boost::lexical_cast<std::string>(tmp)), tmp);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_serialization_test)
+{
+    for (int i = 0; i < ntries; ++i) {
+        const auto tmp = random_dd();
+        std::stringstream ss;
+        {
+            boost::archive::text_oarchive oa(ss);
+            oa << tmp;
+        }
+        double_double tmp_out;
+        {
+            boost::archive::text_iarchive ia(ss);
+            ia >> tmp_out;
+        }
+        BOOST_CHECK_EQUAL(tmp.hi(), tmp_out.hi());
+        BOOST_CHECK_EQUAL(tmp.lo(), tmp_out.lo());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(double_double_series_test)
+{
+    using p_type = polynomial<double_double, k_monomial>;
+    p_type x{"x"}, y{"y"};
+    auto f = math::pow(x + y + double_double{"0.1"}, 10);
+    const auto g = f * (f + 1);
+    // Compare with the same computation carried out with real.
+    using pr_type = polynomial<real, k_monomial>;
+    pr_type xr{"x"}, yr{"y"};
+    auto fr = math::pow(xr + yr + real{"0.1"}, 10);
+    const auto gr = fr * (fr + 1);
+    BOOST_CHECK_EQUAL(g.size(), gr.size());
+    const auto ev = g.evaluate(std::unordered_map<std::string, double_double>{{"x", double_double{"0.3"}},
+                                                                              {"y", double_double{"0.2"}}});
+    const auto evr = gr.evaluate(std::unordered_map<std::string, real>{{"x", real{"0.3"}}, {"y", real{"0.2"}}});
+    BOOST_CHECK((std::is_same<decltype(ev), const double_double>::value));
+    BOOST_CHECK(close_to(ev, evr));
+    // Poisson series.
+    using ps_type = poisson_series<polynomial<double_double, k_monomial>>;
+    ps_type a{"a"}, b{"b"};
+    const auto h = math::cos(a + b) * (a + math::sin(b) / 3);
+    const auto evh = h.evaluate(
+        std::unordered_map<std::string, double_double>{{"a", double_double{"0.5"}}, {"b", double_double{2}}});
+    const real ra{"0.5"}, rb{2};
+    BOOST_CHECK(close_to(evh, math::cos(ra + rb) * (ra + math::sin(rb) / 3)));
+}
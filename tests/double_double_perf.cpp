@@ -0,0 +1,79 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+#include "fateman1.hpp"
+
+#define BOOST_TEST_MODULE double_double_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/timer/timer.hpp>
+#include <iostream>
+
+#include "../src/double_double.hpp"
+#include "../src/init.hpp"
+#include "../src/kronecker_monomial.hpp"
+#include "../src/real.hpp"
+#include "../src/settings.hpp"
+
+using namespace piranha;
+
+// Fateman's test number 1 with floating-point coefficients, comparing piranha::double_double
+// with piranha::real at the default precision.
+
+BOOST_AUTO_TEST_CASE(double_double_test)
+{
+    init();
+    if (boost::unit_test::framework::master_test_suite().argc > 1) {
+        settings::set_n_threads(
+            boost::lexical_cast<unsigned>(boost::unit_test::framework::master_test_suite().argv[1u]));
+    }
+    std::cout << "Timing multiplication, double_double:\n";
+    const auto ret1 = fateman1<double_double, kronecker_monomial<>>();
+    BOOST_CHECK_EQUAL(ret1.size(), 135751u);
+    std::cout << "Timing multiplication, real:\n";
+    const auto ret2 = fateman1<real, kronecker_monomial<>>();
+    BOOST_CHECK_EQUAL(ret2.size(), 135751u);
+    double_double ev1;
+    real ev2;
+    {
+        std::cout << "Timing evaluation, double_double: ";
+        boost::timer::auto_cpu_timer t;
+        ev1 = math::evaluate<double_double>(ret1, {{"x", double_double{"0.1"}},
+                                                   {"y", double_double{"0.2"}},
+                                                   {"z", double_double{"0.3"}},
+                                                   {"t", double_double{"0.4"}}});
+    }
+    {
+        std::cout << "Timing evaluation, real: ";
+        boost::timer::auto_cpu_timer t;
+        ev2 = math::evaluate<real>(ret2,
+                                   {{"x", real{"0.1"}}, {"y", real{"0.2"}}, {"z", real{"0.3"}}, {"t", real{"0.4"}}});
+    }
+    std::cout << ev1 << '\n' << ev2 << '\n';
+    BOOST_CHECK(math::abs(static_cast<real>(ev1) - ev2) <= math::abs(ev2) * math::pow(real{2}, -95));
+}
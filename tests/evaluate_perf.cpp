@@ -30,7 +30,10 @@ see https://www.gnu.org/licenses/. */
 #include <boost/test/unit_test.hpp>
 
 #include <boost/timer/timer.hpp>
+#include <iostream>
+#include <memory>
 
+#include "../src/horner_plan.hpp"
 #include "../src/init.hpp"
 #include "../src/kronecker_monomial.hpp"
 #include "../src/mp_integer.hpp"
@@ -88,3 +91,39 @@ BOOST_AUTO_TEST_CASE(evaluate_test)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(evaluate_horner_test)
+{
+    std::cout << "Timing multiplication, integer:\n";
+    auto ret1 = pearce1<integer, kronecker_monomial<>>();
+    std::unique_ptr<horner_plan<decltype(ret1)>> h;
+    {
+        std::cout << "Timing Horner compilation: ";
+        boost::timer::auto_cpu_timer t;
+        h.reset(new horner_plan<decltype(ret1)>(ret1));
+    }
+    {
+        std::cout << "Timing evaluation, double: ";
+        boost::timer::auto_cpu_timer t;
+        std::cout << math::evaluate<double>(ret1, {{"x", .1}, {"y", -.2}, {"z", .3}, {"t", -.4}, {"u", .5}}) << '\n';
+    }
+    {
+        std::cout << "Timing Horner evaluation, double: ";
+        boost::timer::auto_cpu_timer t;
+        std::cout << h->evaluate<double>({{"x", .1}, {"y", -.2}, {"z", .3}, {"t", -.4}, {"u", .5}}) << '\n';
+    }
+    {
+        std::cout << "Timing evaluation, rational: ";
+        boost::timer::auto_cpu_timer t;
+        std::cout << math::evaluate<rational>(ret1, {{"x", 1 / 2_q}, {"y", -2 / 3_q}, {"z", 3 / 5_q},
+                                                     {"t", -4 / 7_q}, {"u", 5 / 11_q}})
+                  << '\n';
+    }
+    {
+        std::cout << "Timing Horner evaluation, rational: ";
+        boost::timer::auto_cpu_timer t;
+        std::cout << h->evaluate<rational>(
+                         {{"x", 1 / 2_q}, {"y", -2 / 3_q}, {"z", 3 / 5_q}, {"t", -4 / 7_q}, {"u", 5 / 11_q}})
+                  << '\n';
+    }
+}
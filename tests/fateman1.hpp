@@ -54,6 +54,27 @@ inline polynomial<Cf, Key> fateman1(unsigned long long factor = 1u)
         return f * (f + 1);
     }
 }
+
+// Division counterpart of fateman1(): compute (f * (f+1)) / f, timing only the division.
+template <typename Cf, typename Key>
+inline polynomial<Cf, Key> fateman1_division(unsigned long long factor = 1u)
+{
+    typedef polynomial<Cf, Key> p_type;
+    p_type x("x"), y("y"), z("z"), t("t");
+    auto f = x + y + z + t + 1;
+    auto tmp(f);
+    for (auto i = 1; i < 20; ++i) {
+        f *= tmp;
+    }
+    if (factor > 1u) {
+        f *= factor;
+    }
+    const auto prod = f * (f + 1);
+    {
+        boost::timer::auto_cpu_timer t;
+        return prod / f;
+    }
+}
 }
 
 #endif
@@ -0,0 +1,282 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+#include "../src/fixed_monomial.hpp"
+
+#define BOOST_TEST_MODULE fixed_monomial_test
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../src/detail/power_table.hpp"
+#include "../src/init.hpp"
+#include "../src/is_key.hpp"
+#include "../src/key_is_multipliable.hpp"
+#include "../src/math.hpp"
+#include "../src/monomial.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/mp_rational.hpp"
+#include "../src/polynomial.hpp"
+#include "../src/serialization.hpp"
+#include "../src/settings.hpp"
+#include "../src/symbol.hpp"
+#include "../src/symbol_set.hpp"
+#include "../src/term.hpp"
+
+using namespace piranha;
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_constructor_test)
+{
+    init();
+    using k_type = fixed_monomial<int, 4>;
+    BOOST_CHECK(is_key<k_type>::value);
+    BOOST_CHECK((is_key<fixed_monomial<rational, 3>>::value));
+    BOOST_CHECK((key_is_multipliable<integer, k_type>::value));
+    BOOST_CHECK((key_is_multipliable<double, fixed_monomial<rational, 3>>::value));
+    k_type k0;
+    for (std::size_t i = 0u; i < 4u; ++i) {
+        BOOST_CHECK_EQUAL(k0[i], 0);
+    }
+    k_type k1{1, 2};
+    BOOST_CHECK_EQUAL(k1[0u], 1);
+    BOOST_CHECK_EQUAL(k1[1u], 2);
+    BOOST_CHECK_EQUAL(k1[2u], 0);
+    BOOST_CHECK_EQUAL(k1[3u], 0);
+    BOOST_CHECK_THROW((k_type{1, 2, 3, 4, 5}), std::invalid_argument);
+    BOOST_CHECK_THROW((k_type{1.5}), std::invalid_argument);
+    std::vector<long> v{3, 4, 5};
+    k_type k2(v.begin(), v.end());
+    BOOST_CHECK((k2 == k_type{3, 4, 5}));
+    BOOST_CHECK_NO_THROW(k_type(v.begin(), v.end(), symbol_set{symbol{"x"}, symbol{"y"}, symbol{"z"}}));
+    BOOST_CHECK_THROW(k_type(v.begin(), v.end(), symbol_set{symbol{"x"}, symbol{"y"}}), std::invalid_argument);
+    BOOST_CHECK(k_type(symbol_set{symbol{"x"}}) == k0);
+    BOOST_CHECK_THROW(k_type(symbol_set{symbol{"a"}, symbol{"b"}, symbol{"c"}, symbol{"d"}, symbol{"e"}}),
+                      std::invalid_argument);
+    BOOST_CHECK(k_type(k2, symbol_set{symbol{"x"}, symbol{"y"}, symbol{"z"}}) == k2);
+    BOOST_CHECK_THROW(k_type(k2, symbol_set{symbol{"x"}, symbol{"y"}}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_key_test)
+{
+    using k_type = fixed_monomial<int, 4>;
+    const symbol_set ss1{symbol{"x"}, symbol{"z"}}, ss2{symbol{"x"}, symbol{"y"}, symbol{"z"}};
+    k_type k1{1, 2};
+    // Compatibility.
+    BOOST_CHECK(k1.is_compatible(ss1));
+    BOOST_CHECK(k1.is_compatible(ss2));
+    BOOST_CHECK(!k1.is_compatible(symbol_set{symbol{"x"}}));
+    BOOST_CHECK(!k1.is_compatible(symbol_set{symbol{"a"}, symbol{"b"}, symbol{"c"}, symbol{"d"}, symbol{"e"}}));
+    BOOST_CHECK(!k1.is_ignorable(ss1));
+    BOOST_CHECK(!k1.is_unitary(ss1));
+    BOOST_CHECK(k_type{}.is_unitary(ss1));
+    // Merge args.
+    BOOST_CHECK((k1.merge_args(ss1, ss2) == k_type{1, 0, 2}));
+    BOOST_CHECK((k1.merge_args(ss1, symbol_set{symbol{"a"}, symbol{"x"}, symbol{"z"}, symbol{"zz"}})
+                 == k_type{0, 1, 2, 0}));
+    BOOST_CHECK_THROW(k1.merge_args(ss1, ss1), std::invalid_argument);
+    BOOST_CHECK_THROW(k1.merge_args(ss1, symbol_set{symbol{"x"}, symbol{"y"}}), std::invalid_argument);
+    BOOST_CHECK_THROW(
+        k1.merge_args(ss1, symbol_set{symbol{"a"}, symbol{"b"}, symbol{"c"}, symbol{"x"}, symbol{"z"}}),
+        std::invalid_argument);
+    // Trim.
+    const k_type k2{1, 0, 3};
+    symbol_set cands(ss2);
+    k2.trim_identify(cands, ss2);
+    BOOST_CHECK(cands == symbol_set{symbol{"y"}});
+    BOOST_CHECK((k2.trim(cands, ss2) == k_type{1, 3}));
+    // Degree.
+    BOOST_CHECK_EQUAL(k2.degree(ss2), 4);
+    BOOST_CHECK_EQUAL(k2.ldegree(ss2), 4);
+    BOOST_CHECK_EQUAL(k2.degree(symbol_set::positions(ss2, symbol_set{symbol{"z"}}), ss2), 3);
+    BOOST_CHECK_THROW(k2.degree(symbol_set::positions(ss2, symbol_set{symbol{"z"}}), ss1), std::invalid_argument);
+    BOOST_CHECK_THROW((fixed_monomial<int, 2>{std::numeric_limits<int>::max(), 1}.degree(ss1)), std::overflow_error);
+    BOOST_CHECK_EQUAL((fixed_monomial<short, 2>{std::numeric_limits<short>::max(), short(1)}.degree(ss1)),
+                      int(std::numeric_limits<short>::max()) + 1);
+    BOOST_CHECK_THROW((fixed_monomial<long long, 2>{std::numeric_limits<long long>::max(), 1ll}.degree(ss1)),
+                      std::overflow_error);
+    BOOST_CHECK_EQUAL((fixed_monomial<rational, 3>{rational(1, 2), rational(2, 3)}.degree(ss1)), rational(7, 6));
+    // Multiplication and division.
+    k_type out;
+    k_type::multiply(out, k2, k_type{1, 2, 3}, ss2);
+    BOOST_CHECK((out == k_type{2, 2, 6}));
+    k_type::divide(out, out, k_type{1, 2, 3}, ss2);
+    BOOST_CHECK(out == k2);
+    std::array<term<integer, k_type>, 1u> res;
+    k_type::multiply(res, term<integer, k_type>{integer(2), k2}, term<integer, k_type>{integer(3), k1}, ss2);
+    BOOST_CHECK_EQUAL(res[0u].m_cf, 6);
+    BOOST_CHECK((res[0u].m_key == k_type{2, 2, 3}));
+    // Hash and comparison.
+    BOOST_CHECK_EQUAL(k2.hash(), std::hash<k_type>()(k2));
+    BOOST_CHECK_EQUAL(k_type{}.hash(), 0u);
+    BOOST_CHECK(k2.hash() != (k_type{3, 0, 1}.hash()));
+    BOOST_CHECK(k2 != k1);
+    BOOST_CHECK(k2 < k1);
+    BOOST_CHECK(!(k1 < k2));
+    // Linear argument.
+    BOOST_CHECK_EQUAL((k_type{0, 1}.linear_argument(ss1)), "z");
+    BOOST_CHECK_THROW(k2.linear_argument(ss2), std::invalid_argument);
+    // Pow.
+    BOOST_CHECK((k2.pow(2, ss2) == k_type{2, 0, 6}));
+    BOOST_CHECK_THROW((fixed_monomial<signed char, 2>{100}.pow(2, ss1)), std::invalid_argument);
+    // Split, extraction and negative exponents.
+    BOOST_CHECK((k2.split(ss2).first == k_type{0, 3}));
+    BOOST_CHECK((k2.split(ss2).second == k_type{1}));
+    BOOST_CHECK_THROW(k2.split(symbol_set{symbol{"x"}}), std::invalid_argument);
+    std::vector<int> expos;
+    k2.extract_exponents(expos, ss2);
+    BOOST_CHECK((expos == std::vector<int>{1, 0, 3}));
+    BOOST_CHECK(!k2.has_negative_exponent(ss2));
+    BOOST_CHECK((k_type{1, -1}.has_negative_exponent(ss1)));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_calculus_test)
+{
+    using k_type = fixed_monomial<int, 3>;
+    const symbol_set ss{symbol{"x"}, symbol{"z"}};
+    const k_type k{2, 3};
+    // Partial.
+    auto ret = k.partial(symbol_set::positions(ss, symbol_set{symbol{"z"}}), ss);
+    BOOST_CHECK_EQUAL(ret.first, 3);
+    BOOST_CHECK((ret.second == k_type{2, 2}));
+    ret = k.partial(symbol_set::positions(ss, symbol_set{symbol{"y"}}), ss);
+    BOOST_CHECK_EQUAL(ret.first, 0);
+    BOOST_CHECK(ret.second == k_type{});
+    // Integrate.
+    ret = k.integrate(symbol{"x"}, ss);
+    BOOST_CHECK_EQUAL(ret.first, 3);
+    BOOST_CHECK((ret.second == k_type{3, 3}));
+    ret = k.integrate(symbol{"y"}, ss);
+    BOOST_CHECK_EQUAL(ret.first, 1);
+    BOOST_CHECK((ret.second == k_type{2, 1, 3}));
+    ret = k.integrate(symbol{"a"}, ss);
+    BOOST_CHECK((ret.second == k_type{1, 2, 3}));
+    BOOST_CHECK_THROW((k_type{-1, 2}.integrate(symbol{"x"}, ss)), std::invalid_argument);
+    BOOST_CHECK_THROW((k_type{1, 2, 3}.integrate(symbol{"t"}, symbol_set{symbol{"x"}, symbol{"y"}, symbol{"z"}})),
+                      std::invalid_argument);
+    // Evaluate.
+    BOOST_CHECK_EQUAL(k.evaluate(symbol_set::positions_map<integer>(ss, {{symbol{"x"}, integer(2)},
+                                                                         {symbol{"z"}, integer(3)}}),
+                                 ss),
+                      108);
+    BOOST_CHECK_THROW(
+        k.evaluate(symbol_set::positions_map<integer>(ss, {{symbol{"x"}, integer(2)}}), ss), std::invalid_argument);
+    {
+        using table_type = detail::power_table<integer, int>;
+        BOOST_CHECK((detail::key_has_power_table_evaluate<k_type, integer>::value));
+        const symbol_set::positions_map<integer> pmap(ss, {{symbol{"x"}, integer(2)}, {symbol{"z"}, integer(3)}});
+        table_type::bounds_type bounds;
+        k.update_exponent_bounds(bounds, ss);
+        k_type{0, 1}.update_exponent_bounds(bounds, ss);
+        BOOST_CHECK((bounds == table_type::bounds_type{{0, 2}, {1, 3}}));
+        BOOST_CHECK_THROW(k.update_exponent_bounds(bounds, symbol_set{symbol{"x"}}), std::invalid_argument);
+        const table_type table(pmap, bounds);
+        BOOST_CHECK_EQUAL(k.evaluate(table, ss), 108);
+        BOOST_CHECK_THROW(k.evaluate(table, symbol_set{symbol{"x"}}), std::invalid_argument);
+    }
+    // Subs.
+    auto s_ret = k.subs("z", integer(2), ss);
+    BOOST_CHECK_EQUAL(s_ret.size(), 1u);
+    BOOST_CHECK_EQUAL(s_ret[0u].first, 8);
+    BOOST_CHECK((s_ret[0u].second == k_type{2}));
+    auto is_ret = k.ipow_subs("z", integer(2), integer(5), ss);
+    BOOST_CHECK_EQUAL(is_ret[0u].first, 5);
+    BOOST_CHECK((is_ret[0u].second == k_type{2, 1}));
+    // Printing.
+    std::ostringstream oss;
+    k.print(oss, ss);
+    BOOST_CHECK_EQUAL(oss.str(), "x**2*z**3");
+    oss.str("");
+    k_type{-1, 1}.print_tex(oss, ss);
+    BOOST_CHECK_EQUAL(oss.str(), "\\frac{{z}}{{x}}");
+}
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_serialization_test)
+{
+    using k_type = fixed_monomial<int, 5>;
+    k_type tmp;
+    std::stringstream ss;
+    const k_type k0{1, 2, 3, 4, 5};
+    {
+        boost::archive::text_oarchive oa(ss);
+        oa << k0;
+    }
+    {
+        boost::archive::text_iarchive ia(ss);
+        ia >> tmp;
+    }
+    BOOST_CHECK(tmp == k0);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_polynomial_test)
+{
+    using p_type = polynomial<integer, fixed_monomial<int, 4>>;
+    using pm_type = polynomial<integer, monomial<int>>;
+    p_type x{"x"}, y{"y"}, z{"z"}, t{"t"};
+    pm_type xm{"x"}, ym{"y"}, zm{"z"}, tm{"t"};
+    // Compare the results with the ones obtained with ordinary monomials.
+    auto f = math::pow(x + y + z + t + 1, 6), g = f + 1;
+    auto fm = math::pow(xm + ym + zm + tm + 1, 6), gm = fm + 1;
+    auto h = f * g;
+    BOOST_CHECK_EQUAL(h.size(), (fm * gm).size());
+    const std::unordered_map<std::string, integer> dict{
+        {"x", integer(2)}, {"y", integer(-3)}, {"z", integer(5)}, {"t", integer(7)}};
+    BOOST_CHECK_EQUAL(math::evaluate(f * (x - 1), dict), math::evaluate(fm * (xm - 1), dict));
+    BOOST_CHECK_EQUAL(math::evaluate(h, dict), math::evaluate(fm * gm, dict));
+    BOOST_CHECK_EQUAL(h.degree(), 12);
+    BOOST_CHECK(h - f * f == f);
+    // Large products go through the adaptive Kronecker packing, also in multithreading.
+    settings::set_n_threads(4u);
+    auto f2 = math::pow(x + y + z + t + 1, 12);
+    BOOST_CHECK_EQUAL((f2 * (f2 + 1)).size(), 20475u);
+    settings::reset_n_threads();
+    // Truncated multiplication.
+    p_type::set_auto_truncate_degree(5);
+    BOOST_CHECK_EQUAL((f * g).size(), 126u);
+    p_type::unset_auto_truncate_degree();
+    // Exponent overflow.
+    using ps_type = polynomial<integer, fixed_monomial<signed char, 2>>;
+    ps_type a{"a"}, b{"b"};
+    BOOST_CHECK_THROW(math::pow(a, 100) * math::pow(a, 100), std::overflow_error);
+    // Too many symbols.
+    BOOST_CHECK_THROW(a * b * ps_type{"c"}, std::invalid_argument);
+    // Calculus and substitution.
+    BOOST_CHECK_EQUAL(math::partial(x * x * y, "x"), 2 * x * y);
+    BOOST_CHECK_EQUAL(math::integrate(x * y, "z"), x * y * z);
+    BOOST_CHECK_EQUAL(math::subs(x * x * y + z, "x", p_type{2}), 4 * y + z);
+    BOOST_CHECK_EQUAL(math::evaluate(x * x * y + z, dict), -7);
+    // Division.
+    BOOST_CHECK_EQUAL((x * x - y * y) / (x + y), x - y);
+}
@@ -0,0 +1,169 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+#include "../src/detail/gmp_memory_pool.hpp"
+
+#define BOOST_TEST_MODULE gmp_memory_pool_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <cstddef>
+#include <gmp.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../src/init.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/mp_rational.hpp"
+
+using namespace piranha;
+
+using pool = detail::gmp_memory_pool<>;
+
+BOOST_AUTO_TEST_CASE(gmp_memory_pool_install_test)
+{
+    init();
+    void *(*a)(std::size_t);
+    void *(*r)(void *, std::size_t, std::size_t);
+    void (*f)(void *, std::size_t);
+    ::mp_get_memory_functions(&a, &r, &f);
+    BOOST_CHECK(a == &pool::allocate);
+    BOOST_CHECK(r == &pool::reallocate);
+    BOOST_CHECK(f == &pool::deallocate);
+    BOOST_CHECK(pool::s_old_alloc != nullptr);
+    BOOST_CHECK(pool::s_old_realloc != nullptr);
+    BOOST_CHECK(pool::s_old_free != nullptr);
+    // Calling init() again does not re-install the pool on top of itself.
+    init();
+    BOOST_CHECK(pool::s_old_alloc != &pool::allocate);
+}
+
+BOOST_AUTO_TEST_CASE(gmp_memory_pool_classes_test)
+{
+    BOOST_CHECK_EQUAL(pool::class_idx(0u), pool::n_classes);
+    BOOST_CHECK_EQUAL(pool::class_idx(1u), pool::n_classes);
+    BOOST_CHECK_EQUAL(pool::class_idx(pool::granularity), 0u);
+    BOOST_CHECK_EQUAL(pool::class_idx(pool::granularity * 2u), 1u);
+    BOOST_CHECK_EQUAL(pool::class_idx(pool::granularity * 2u + 1u), pool::n_classes);
+    BOOST_CHECK_EQUAL(pool::class_idx(pool::granularity * pool::n_classes), pool::n_classes - 1u);
+    BOOST_CHECK_EQUAL(pool::class_idx(pool::granularity * (pool::n_classes + 1u)), pool::n_classes);
+    // Freed blocks are recycled.
+    void *p = pool::allocate(pool::granularity * 3u);
+    pool::deallocate(p, pool::granularity * 3u);
+    BOOST_CHECK_EQUAL(pool::allocate(pool::granularity * 3u), p);
+    // Reallocation within and outside the pooled range preserves the content.
+    auto c = static_cast<unsigned char *>(p);
+    for (std::size_t i = 0u; i < pool::granularity * 3u; ++i) {
+        c[i] = static_cast<unsigned char>(i);
+    }
+    p = pool::reallocate(p, pool::granularity * 3u, pool::granularity * 5u);
+    c = static_cast<unsigned char *>(p);
+    for (std::size_t i = 0u; i < pool::granularity * 3u; ++i) {
+        BOOST_CHECK_EQUAL(c[i], static_cast<unsigned char>(i));
+    }
+    p = pool::reallocate(p, pool::granularity * 5u, pool::granularity * 1000u);
+    c = static_cast<unsigned char *>(p);
+    for (std::size_t i = 0u; i < pool::granularity * 3u; ++i) {
+        BOOST_CHECK_EQUAL(c[i], static_cast<unsigned char>(i));
+    }
+    p = pool::reallocate(p, pool::granularity * 1000u, 7u);
+    c = static_cast<unsigned char *>(p);
+    for (std::size_t i = 0u; i < 7u; ++i) {
+        BOOST_CHECK_EQUAL(c[i], static_cast<unsigned char>(i));
+    }
+    pool::deallocate(p, 7u);
+    // The number of cached blocks is bounded.
+    std::vector<void *> v;
+    for (unsigned i = 0u; i < pool::max_cached * 2u; ++i) {
+        v.push_back(pool::allocate(pool::granularity));
+    }
+    for (auto ptr : v) {
+        pool::deallocate(ptr, pool::granularity);
+    }
+    BOOST_CHECK_EQUAL(pool::get_state().m_counts[0u], pool::max_cached);
+}
+
+BOOST_AUTO_TEST_CASE(gmp_memory_pool_threads_test)
+{
+    // Multiprecision computations in multiple threads, with values created in one
+    // thread and destroyed in others.
+    const unsigned nthreads = 4u;
+    std::vector<std::vector<integer>> results(nthreads);
+    std::vector<std::thread> threads;
+    for (unsigned i = 0u; i < nthreads; ++i) {
+        threads.emplace_back([i, &results]() {
+            integer acc(1);
+            rational q(1);
+            for (unsigned j = 0u; j < 2000u; ++j) {
+                acc *= integer(j % 7u + 2u + i);
+                acc += integer(j);
+                q += rational(1, j + 1u);
+                if (j % 100u == 0u) {
+                    results[i].push_back(acc);
+                }
+            }
+            results[i].push_back(q.num());
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    threads.clear();
+    // Check the results in other threads, freeing the values allocated by the first batch.
+    // NOTE: Boost.Test is not thread-safe, store the results of the checks.
+    std::vector<char> ok(nthreads, 0);
+    for (unsigned i = 0u; i < nthreads; ++i) {
+        threads.emplace_back([i, nthreads, &results, &ok]() {
+            const unsigned k = (i + 1u) % nthreads;
+            std::vector<integer> res(std::move(results[k]));
+            integer acc(1);
+            rational q(1);
+            std::size_t idx = 0u;
+            bool flag = true;
+            for (unsigned j = 0u; j < 2000u; ++j) {
+                acc *= integer(j % 7u + 2u + k);
+                acc += integer(j);
+                q += rational(1, j + 1u);
+                if (j % 100u == 0u) {
+                    flag = flag && res[idx++] == acc;
+                }
+            }
+            ok[i] = flag && res[idx] == q.num();
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    for (auto f : ok) {
+        BOOST_CHECK(f);
+    }
+    // String conversions go through the non-pooled path.
+    const integer big = integer(1) << 10000;
+    BOOST_CHECK_EQUAL(integer(boost::lexical_cast<std::string>(big)), big);
+}
@@ -0,0 +1,217 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include "../src/horner_plan.hpp"
+
+#define BOOST_TEST_MODULE horner_plan_test
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../src/fixed_monomial.hpp"
+#include "../src/init.hpp"
+#include "../src/kronecker_monomial.hpp"
+#include "../src/math.hpp"
+#include "../src/monomial.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/mp_rational.hpp"
+#include "../src/poisson_series.hpp"
+#include "../src/polynomial.hpp"
+#include "../src/real.hpp"
+
+using namespace piranha;
+
+static std::mt19937 rng;
+
+static const int ntrials = 100;
+
+// Random polynomial in x, y and z.
+template <typename P>
+static P rand_poly(int max_expo, int n_terms, int min_expo = 0)
+{
+    std::uniform_int_distribution<int> edist(min_expo, max_expo), cdist(-10, 10);
+    P x{"x"}, y{"y"}, z{"z"}, retval;
+    for (int i = 0; i < n_terms; ++i) {
+        retval += cdist(rng) * math::pow(x, edist(rng)) * math::pow(y, edist(rng)) * math::pow(z, edist(rng));
+    }
+    return retval;
+}
+
+// Evaluate the polynomial p with the absolute values of its coefficients at the absolute values of dict.
+template <typename P>
+static double abs_evaluate(const P &p, const std::unordered_map<std::string, double> &dict)
+{
+    P tmp;
+    tmp.set_symbol_set(p.get_symbol_set());
+    for (const auto &t : p._container()) {
+        tmp.insert(typename P::term_type(std::abs(t.m_cf), t.m_key));
+    }
+    std::unordered_map<std::string, double> abs_dict;
+    for (const auto &q : dict) {
+        abs_dict.emplace(q.first, std::abs(q.second));
+    }
+    return math::evaluate(tmp, abs_dict);
+}
+
+// The error of the evaluation of a polynomial p in floating-point arithmetic via a sequence of at most n operations
+// per term (including the computation of the powers) is bounded by gamma_n * abs_evaluate(p), with
+// gamma_n = n * u / (1 - n * u) and u the unit roundoff (see Higham, Accuracy and Stability of Numerical
+// Algorithms, 2nd ed., section 5.1). For a Horner plan, n is bounded by the size of the plan plus the number
+// of symbols.
+static double gamma_n(std::size_t n)
+{
+    const double nu = static_cast<double>(n) * std::numeric_limits<double>::epsilon() / 2.;
+    return nu / (1. - nu);
+}
+
+BOOST_AUTO_TEST_CASE(horner_plan_basic_test)
+{
+    init();
+    BOOST_CHECK((detail::horner_plan_enabled<polynomial<rational, k_monomial>>::value));
+    BOOST_CHECK((detail::horner_plan_enabled<polynomial<double, monomial<int>>>::value));
+    BOOST_CHECK((detail::horner_plan_enabled<polynomial<integer, fixed_monomial<short, 3>>>::value));
+    BOOST_CHECK((!detail::horner_plan_enabled<polynomial<rational, monomial<rational>>>::value));
+    BOOST_CHECK((!detail::horner_plan_enabled<poisson_series<polynomial<rational, k_monomial>>>::value));
+    BOOST_CHECK((!detail::horner_plan_enabled<rational>::value));
+    using p_type = polynomial<rational, k_monomial>;
+    using dict_type = std::unordered_map<std::string, rational>;
+    p_type x{"x"}, y{"y"};
+    // Empty series.
+    horner_plan<p_type> h0(p_type{});
+    BOOST_CHECK_EQUAL(h0.size(), 0u);
+    BOOST_CHECK_EQUAL(h0.evaluate(dict_type{}), 0);
+    // Constant series.
+    horner_plan<p_type> h1(p_type{3 / 2_q});
+    BOOST_CHECK_EQUAL(h1.size(), 1u);
+    BOOST_CHECK_EQUAL(h1.evaluate(dict_type{{"x", 1_q}}), 3 / 2_q);
+    // The example from the documentation.
+    const auto p = x * x * x * y + 2 * x * x * x + x * y * y + 3;
+    horner_plan<p_type> h2(p);
+    // 4 push_cf, 3 add, 4 mul_pow.
+    BOOST_CHECK_EQUAL(h2.size(), 11u);
+    BOOST_CHECK_EQUAL(h2.evaluate(dict_type{{"x", 2 / 3_q}, {"y", -5_q}}),
+                      math::evaluate(p, dict_type{{"x", 2 / 3_q}, {"y", -5_q}}));
+    // Extra symbols are ignored.
+    BOOST_CHECK_EQUAL(h2.evaluate(dict_type{{"x", 2 / 3_q}, {"y", -5_q}, {"z", 1_q}}),
+                      math::evaluate(p, dict_type{{"x", 2 / 3_q}, {"y", -5_q}}));
+    // Evaluation with a vector of values, in the order of the symbol set.
+    BOOST_CHECK_EQUAL(h2.evaluate(std::vector<rational>{2 / 3_q, -5_q}),
+                      math::evaluate(p, dict_type{{"x", 2 / 3_q}, {"y", -5_q}}));
+    BOOST_CHECK_THROW(h2.evaluate(std::vector<rational>{2 / 3_q}), std::invalid_argument);
+    BOOST_CHECK_THROW(h2.evaluate(std::vector<rational>{2 / 3_q, -5_q, 1_q}), std::invalid_argument);
+    BOOST_CHECK_EQUAL(h0.evaluate(std::vector<rational>{}), 0);
+    // Missing symbols.
+    BOOST_CHECK_THROW(h2.evaluate(dict_type{{"x", 2 / 3_q}}), std::invalid_argument);
+    BOOST_CHECK_THROW(h2.evaluate(dict_type{{"y", 2 / 3_q}}), std::invalid_argument);
+    BOOST_CHECK_THROW(h2.evaluate(dict_type{}), std::invalid_argument);
+    // Dense univariate polynomial: classic Horner scheme.
+    p_type q;
+    for (int i = 0; i <= 100; ++i) {
+        q += (i + 1) * math::pow(x, i);
+    }
+    horner_plan<p_type> h3(q);
+    BOOST_CHECK_EQUAL(h3.size(), 301u);
+    BOOST_CHECK_EQUAL(h3.evaluate(dict_type{{"x", -7 / 5_q}}), math::evaluate(q, dict_type{{"x", -7 / 5_q}}));
+    // Copy and move.
+    auto h4(h3);
+    BOOST_CHECK_EQUAL(h4.evaluate(dict_type{{"x", 3_q}}), math::evaluate(q, dict_type{{"x", 3_q}}));
+    auto h5(std::move(h4));
+    BOOST_CHECK_EQUAL(h5.evaluate(dict_type{{"x", 3_q}}), math::evaluate(q, dict_type{{"x", 3_q}}));
+    // Evaluation types.
+    BOOST_CHECK((std::is_same<decltype(h3.evaluate(std::unordered_map<std::string, double>{})), double>::value));
+    BOOST_CHECK((std::is_same<decltype(h3.evaluate(std::unordered_map<std::string, real>{})), real>::value));
+    BOOST_CHECK(
+        (std::is_same<decltype(h3.evaluate(std::unordered_map<std::string, p_type>{})), p_type>::value));
+}
+
+BOOST_AUTO_TEST_CASE(horner_plan_random_test)
+{
+    {
+        using p_type = polynomial<rational, k_monomial>;
+        using dict_type = std::unordered_map<std::string, rational>;
+        std::uniform_int_distribution<int> dist(-10, 10);
+        for (int i = 0; i < ntrials; ++i) {
+            const auto p = rand_poly<p_type>(8, 30);
+            horner_plan<p_type> h(p);
+            const dict_type dict{{"x", rational(dist(rng), 7)}, {"y", rational(dist(rng), 3)}, {"z", rational(1, 2)}};
+            BOOST_CHECK_EQUAL(h.evaluate(dict), math::evaluate(p, dict));
+            // Evaluation with polynomials.
+            using dict_type2 = std::unordered_map<std::string, p_type>;
+            const dict_type2 dict2{{"x", p_type{"y"} + 1}, {"y", p_type{"z"} - 2}, {"z", p_type{"x"}}};
+            BOOST_CHECK_EQUAL(h.evaluate(dict2), math::evaluate(p, dict2));
+        }
+    }
+    {
+        // Negative exponents.
+        using p_type = polynomial<rational, monomial<int>>;
+        using dict_type = std::unordered_map<std::string, rational>;
+        for (int i = 0; i < ntrials; ++i) {
+            const auto p = rand_poly<p_type>(5, 30, -5);
+            horner_plan<p_type> h(p);
+            const dict_type dict{{"x", rational(-3, 7)}, {"y", rational(5, 3)}, {"z", rational(1, 2)}};
+            BOOST_CHECK_EQUAL(h.evaluate(dict), math::evaluate(p, dict));
+        }
+    }
+    {
+        // Floating-point.
+        using p_type = polynomial<double, k_monomial>;
+        using dict_type = std::unordered_map<std::string, double>;
+        for (int i = 0; i < ntrials; ++i) {
+            const auto p = rand_poly<p_type>(8, 30);
+            horner_plan<p_type> h(p);
+            const dict_type dict{{"x", .3}, {"y", -1.2}, {"z", .7}};
+            const auto cmp = math::evaluate(p, dict);
+            // Both the plan and the term-by-term evaluation are affected by rounding errors. In the latter,
+            // each term requires 3 powers and 3 multiplications, and the compensated summation adds 2 more.
+            const auto bound = (gamma_n(h.size() + 3u) + gamma_n(8u)) * abs_evaluate(p, dict);
+            BOOST_CHECK(std::abs(h.evaluate(dict) - cmp) <= bound);
+            BOOST_CHECK(std::abs(h.evaluate(std::vector<double>{.3, -1.2, .7}) - cmp) <= bound);
+        }
+    }
+    {
+        // Coefficients depending on the evaluation values.
+        using p_type = polynomial<polynomial<rational, k_monomial>, k_monomial>;
+        using dict_type = std::unordered_map<std::string, rational>;
+        p_type x{"x"}, y{"y"};
+        polynomial<rational, k_monomial> a{"a"}, b{"b"};
+        const auto p = math::pow(a * x + b * y + 1, 6) + a * b;
+        horner_plan<p_type> h(p);
+        const dict_type dict{{"x", 1 / 2_q}, {"y", 3_q}, {"a", -2_q}, {"b", 5 / 7_q}};
+        BOOST_CHECK_EQUAL(h.evaluate(dict), math::evaluate(p, dict));
+        BOOST_CHECK_THROW(h.evaluate(dict_type{{"x", 1 / 2_q}, {"y", 3_q}, {"a", -2_q}}), std::invalid_argument);
+    }
+}
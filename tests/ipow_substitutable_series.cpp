@@ -33,6 +33,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -40,6 +41,8 @@ see https://www.gnu.org/licenses/. */
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 
 #include "../src/base_series_multiplier.hpp"
 #include "../src/config.hpp"
@@ -48,6 +51,7 @@ see https://www.gnu.org/licenses/. */
 #include "../src/init.hpp"
 #include "../src/is_key.hpp"
 #include "../src/key_is_multipliable.hpp"
+#include "../src/kronecker_monomial.hpp"
 #include "../src/monomial.hpp"
 #include "../src/mp_integer.hpp"
 #include "../src/mp_rational.hpp"
@@ -55,6 +59,7 @@ see https://www.gnu.org/licenses/. */
 #include "../src/serialization.hpp"
 #include "../src/series.hpp"
 #include "../src/series_multiplier.hpp"
+#include "../src/settings.hpp"
 #include "../src/symbol_set.hpp"
 #include "../src/term.hpp"
 
@@ -383,6 +388,143 @@ BOOST_AUTO_TEST_CASE(ipow_subs_series_subs_test)
     }
 }
 
+// Term-by-term substitution in the keys, used to check the grouped implementation.
+template <typename S, typename T>
+static auto naive_key_ipow_subs(const S &s, const std::string &name, const integer &n, const T &x)
+    -> decltype(s.ipow_subs(name, n, x))
+{
+    decltype(s.ipow_subs(name, n, x)) retval(0);
+    for (const auto &t : s._container()) {
+        for (auto &p : t.m_key.ipow_subs(name, n, x, s.get_symbol_set())) {
+            S tmp;
+            tmp.set_symbol_set(s.get_symbol_set());
+            tmp.insert(typename S::term_type(t.m_cf, std::move(p.second)));
+            retval += tmp * p.first;
+        }
+    }
+    return retval;
+}
+
+template <typename Key>
+static void grouped_ipow_subs_tester()
+{
+    using stype = g_series_type<rational, Key>;
+    BOOST_CHECK(detail::key_has_ipow_subs_split<Key>::value);
+    stype x{"x"}, y{"y"}, z{"z"}, t{"t"};
+    BOOST_CHECK_EQUAL(stype{}.ipow_subs("x", 2, y + 1), 0);
+    // A series with several thousands of terms, including negative exponents.
+    auto s = math::pow(x + y / 2 - z + 2 * t / 3 - 1, 12);
+    {
+        // The symbols are ordered as t, x, y, z.
+        stype neg;
+        neg.set_symbol_set(s.get_symbol_set());
+        neg.insert(typename stype::term_type(rational(1), Key{0, -5, 1, 0}));
+        neg.insert(typename stype::term_type(rational(-3), Key{0, -4, 0, 0}));
+        neg.insert(typename stype::term_type(rational(1, 7), Key{1, -7, 0, -3}));
+        s += neg;
+    }
+    for (unsigned nt = 1u; nt <= 4u; ++nt) {
+        settings::set_n_threads(nt);
+        for (int n : {1, 2, 3, -2, -3}) {
+            auto res = s.ipow_subs("x", n, y - 2 * t + 1 / 3_q);
+            BOOST_CHECK((std::is_same<decltype(res), stype>::value));
+            BOOST_CHECK_EQUAL(res, naive_key_ipow_subs(s, "x", integer(n), y - 2 * t + 1 / 3_q));
+            BOOST_CHECK(res.get_symbol_set() == s.get_symbol_set());
+            auto res_d = s.ipow_subs("z", n, 1.5);
+            const auto diff = res_d - naive_key_ipow_subs(s, "z", integer(n), 1.5);
+            for (const auto &term : diff._container()) {
+                BOOST_CHECK(std::abs(term.m_cf) < 1E-6);
+            }
+        }
+        // Substitution of x**2 with x**2 does not change anything.
+        BOOST_CHECK_EQUAL(s.ipow_subs("x", 2, x * x), s);
+        BOOST_CHECK_THROW(s.ipow_subs("x", 0, y), zero_division_error);
+    }
+    settings::reset_n_threads();
+}
+
+BOOST_AUTO_TEST_CASE(ipow_subs_series_grouped_test)
+{
+    grouped_ipow_subs_tester<monomial<int>>();
+    grouped_ipow_subs_tester<kronecker_monomial<>>();
+    BOOST_CHECK((!detail::key_has_ipow_subs_split<new_monomial<int>>::value));
+    {
+        // Substitution in the coefficients only.
+        using stype0 = g_series_type<rational, monomial<int>>;
+        using stype1 = g_series_type<stype0, monomial<int>>;
+        stype1 x{stype0{"x"}}, y{stype0{"y"}}, z{"z"}, t{"t"};
+        const auto s = math::pow(x + y + z + t + 1, 12);
+        const stype0 y0{"y"};
+        for (unsigned nt = 1u; nt <= 4u; ++nt) {
+            settings::set_n_threads(nt);
+            auto res = s.ipow_subs("x", 1, y0 - 1);
+            BOOST_CHECK((std::is_same<decltype(res), stype1>::value));
+            BOOST_CHECK(res.is_identical(math::pow(2 * y + z + t, 12)));
+            BOOST_CHECK_EQUAL(s.ipow_subs("x", 1, -y - z - t - 1), 0);
+            BOOST_CHECK_THROW(s.ipow_subs("x", 0, y), zero_division_error);
+        }
+        settings::reset_n_threads();
+    }
+}
+
+template <typename Key>
+static void dict_ipow_subs_tester()
+{
+    using stype = g_series_type<rational, Key>;
+    using dict = std::unordered_map<std::string, std::pair<integer, stype>>;
+    using q_dict = std::unordered_map<std::string, std::pair<integer, rational>>;
+    stype x{"x"}, y{"y"}, z{"z"}, t{"t"}, w{"w"};
+    BOOST_CHECK_EQUAL(stype{}.ipow_subs(dict{{"x", {2_z, y}}}), 0);
+    BOOST_CHECK_EQUAL((x + y).ipow_subs(dict{}), x + y);
+    auto s = math::pow(x + y / 2 - z + 2 * t / 3 - 1, 12);
+    {
+        // Negative exponents. The symbols are ordered as t, x, y, z.
+        stype neg;
+        neg.set_symbol_set(s.get_symbol_set());
+        neg.insert(typename stype::term_type(rational(1), Key{0, -5, 1, 0}));
+        neg.insert(typename stype::term_type(rational(1, 7), Key{1, -7, 0, -3}));
+        s += neg;
+    }
+    for (unsigned nt = 1u; nt <= 4u; ++nt) {
+        settings::set_n_threads(nt);
+        // The substitution is simultaneous.
+        auto res = s.ipow_subs(dict{{"x", {2_z, y}}, {"y", {3_z, x}}});
+        BOOST_CHECK((std::is_same<decltype(res), stype>::value));
+        BOOST_CHECK_EQUAL(res, s.ipow_subs("x", 2, w).ipow_subs("y", 3, x).ipow_subs("w", 1, y));
+        BOOST_CHECK(res.get_symbol_set() == s.get_symbol_set());
+        BOOST_CHECK_EQUAL(s.ipow_subs(dict{{"x", {-2_z, t + 1}}, {"z", {3_z, y}}, {"v", {2_z, t}}}),
+                          s.ipow_subs("x", -2, t + 1).ipow_subs("z", 3, y));
+        const q_dict dq{{"x", {2_z, 1 / 2_q}}, {"t", {1_z, -3_q}}, {"z", {-3_z, 2 / 3_q}}};
+        BOOST_CHECK_EQUAL(s.ipow_subs(dq),
+                          s.ipow_subs("x", 2, 1 / 2_q).ipow_subs("t", 1, -3_q).ipow_subs("z", -3, 2 / 3_q));
+        BOOST_CHECK_THROW(s.ipow_subs(dict{{"x", {0_z, y}}}), zero_division_error);
+    }
+    settings::reset_n_threads();
+}
+
+BOOST_AUTO_TEST_CASE(ipow_subs_series_dict_test)
+{
+    dict_ipow_subs_tester<monomial<int>>();
+    dict_ipow_subs_tester<kronecker_monomial<>>();
+    {
+        // Substitution in the coefficients, and in the coefficients and keys.
+        using stype0 = g_series_type<rational, monomial<int>>;
+        using stype1 = g_series_type<stype0, monomial<int>>;
+        using dict0 = std::unordered_map<std::string, std::pair<integer, stype0>>;
+        stype1 x{stype0{"x"}}, y{stype0{"y"}}, z{"z"}, t{"t"};
+        const auto s = math::pow(x + y + z + t + 1, 12);
+        const stype0 x0{"x"}, y0{"y"};
+        for (unsigned nt = 1u; nt <= 4u; ++nt) {
+            settings::set_n_threads(nt);
+            auto res = s.ipow_subs(dict0{{"x", {1_z, y0}}, {"y", {1_z, x0 - 1}}});
+            BOOST_CHECK((std::is_same<decltype(res), stype1>::value));
+            BOOST_CHECK_EQUAL(res, math::pow(x + y + z + t, 12));
+            BOOST_CHECK_EQUAL(s.ipow_subs(dict0{{"x", {1_z, y0}}, {"z", {1_z, -y0 - 1}}}), math::pow(y + t, 12));
+        }
+        settings::reset_n_threads();
+    }
+}
+
 BOOST_AUTO_TEST_CASE(ipow_subs_series_serialization_test)
 {
     using stype = g_series_type<rational, monomial<int>>;
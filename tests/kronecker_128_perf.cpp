@@ -0,0 +1,81 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE kronecker_128_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/timer/timer.hpp>
+#include <stdexcept>
+#include <string>
+
+#include "../src/config.hpp"
+#include "../src/init.hpp"
+#include "../src/kronecker_monomial.hpp"
+#include "../src/monomial.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/polynomial.hpp"
+#include "../src/settings.hpp"
+
+using namespace piranha;
+
+// Multiplication of dense polynomials in many variables. Calculate:
+// f * f
+// where
+// f = (1 + x0 + x1 + ... + x15)**4.
+// The exponents of the result are too large for a Kronecker monomial with 64-bit codes, and the
+// computation has to be performed either with 128-bit Kronecker codes or with unpacked monomials.
+
+template <typename Key>
+static polynomial<integer, Key> many_variables()
+{
+    using p_type = polynomial<integer, Key>;
+    p_type f{1};
+    for (int i = 0; i < 16; ++i) {
+        f += p_type{"x" + std::to_string(i)};
+    }
+    f = f.pow(4);
+    {
+        boost::timer::auto_cpu_timer t;
+        return f * f;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(kronecker_128_test)
+{
+    init();
+    if (boost::unit_test::framework::master_test_suite().argc > 1) {
+        settings::set_n_threads(
+            boost::lexical_cast<unsigned>(boost::unit_test::framework::master_test_suite().argv[1u]));
+    }
+    BOOST_CHECK_THROW(many_variables<k_monomial>(), std::overflow_error);
+    BOOST_CHECK_EQUAL(many_variables<monomial<signed char>>().size(), 735471u);
+#if defined(PIRANHA_INT128_T)
+    BOOST_CHECK_EQUAL(many_variables<kronecker_monomial<PIRANHA_INT128_T>>().size(), 735471u);
+#endif
+}
@@ -42,7 +42,10 @@ see https://www.gnu.org/licenses/. */
 #include <type_traits>
 #include <vector>
 
+#include "../src/config.hpp"
 #include "../src/init.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/settings.hpp"
 
 using namespace piranha;
 
@@ -161,3 +164,141 @@ BOOST_AUTO_TEST_CASE(kronecker_array_coding_test)
 {
     boost::mpl::for_each<int_types>(coding_tester());
 }
+
+// Range coding.
+struct range_coding_tester {
+    template <typename T>
+    void operator()(const T &)
+    {
+        typedef kronecker_array<T> ka_type;
+        const auto &l = ka_type::get_limits();
+        std::mt19937 rng;
+        std::vector<T> v, v_out, tmp;
+        std::vector<T> c, c_scalar;
+        for (decltype(l.size()) m = 1u; m < l.size(); ++m) {
+            const auto &minmax = std::get<0u>(l[m]);
+            for (unsigned n_threads = 1u; n_threads <= 4u; ++n_threads) {
+                for (std::size_t n_vectors : {std::size_t(0u), std::size_t(1u), std::size_t(3u), std::size_t(100u)}) {
+                    v.resize(n_vectors * m);
+                    for (std::size_t i = 0u; i < v.size(); ++i) {
+                        const auto &M = minmax[i % m];
+                        std::uniform_int_distribution<T> dist(static_cast<T>(-M), M);
+                        v[i] = dist(rng);
+                    }
+                    // Include the extremal vectors.
+                    if (n_vectors == 100u) {
+                        for (std::size_t i = 0u; i < m; ++i) {
+                            v[i] = static_cast<T>(-minmax[i]);
+                            v[m + i] = minmax[i];
+                        }
+                    }
+                    ka_type::encode_range(c, v, m, n_threads);
+                    BOOST_CHECK_EQUAL(c.size(), n_vectors);
+                    // Check against the scalar encoding.
+                    c_scalar.clear();
+                    for (std::size_t i = 0u; i < n_vectors; ++i) {
+                        tmp.assign(v.begin() + static_cast<std::ptrdiff_t>(i * m),
+                                   v.begin() + static_cast<std::ptrdiff_t>((i + 1u) * m));
+                        c_scalar.push_back(ka_type::encode(tmp));
+                    }
+                    BOOST_CHECK(c == c_scalar);
+                    ka_type::decode_range(v_out, c, m, n_threads);
+                    BOOST_CHECK(v_out == v);
+                }
+            }
+        }
+        // The extrema of the codes.
+        for (decltype(l.size()) m = 1u; m < l.size(); ++m) {
+            const std::vector<T> codes{std::get<1u>(l[m]), std::get<2u>(l[m])};
+            ka_type::decode_range(v_out, codes, m);
+            for (std::size_t i = 0u; i < m; ++i) {
+                BOOST_CHECK_EQUAL(v_out[i], -std::get<0u>(l[m])[i]);
+                BOOST_CHECK_EQUAL(v_out[m + i], std::get<0u>(l[m])[i]);
+            }
+        }
+        // Other integral types as vector components.
+        std::vector<long long> vll{1, -1, 0, 1, 1, 1}, vll_out;
+        ka_type::encode_range(c, vll, 2u);
+        ka_type::decode_range(vll_out, c, 2u, 2u);
+        BOOST_CHECK(vll == vll_out);
+        // Exceptions tests.
+        BOOST_CHECK_THROW(ka_type::encode_range(c, v, 0u), std::invalid_argument);
+        BOOST_CHECK_THROW(ka_type::encode_range(c, v, l.size()), std::invalid_argument);
+        BOOST_CHECK_THROW(ka_type::encode_range(c, std::vector<T>(3u), 2u), std::invalid_argument);
+        BOOST_CHECK_THROW(ka_type::encode_range(c, std::vector<T>(2u), 2u, 0u), std::invalid_argument);
+        BOOST_CHECK_THROW(ka_type::encode_range(c, std::vector<T>{T(0), boost::integer_traits<T>::const_max}, 2u),
+                          std::invalid_argument);
+        BOOST_CHECK_THROW(ka_type::decode_range(v_out, c, 0u), std::invalid_argument);
+        BOOST_CHECK_THROW(ka_type::decode_range(v_out, c, l.size()), std::invalid_argument);
+        BOOST_CHECK_THROW(ka_type::decode_range(v_out, std::vector<T>{T(0)}, 1u, 0u), std::invalid_argument);
+        BOOST_CHECK_THROW(
+            ka_type::decode_range(v_out, std::vector<T>(200u, boost::integer_traits<T>::const_max), 2u, 3u),
+            std::invalid_argument);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(kronecker_array_range_coding_test)
+{
+    settings::set_n_threads(4u);
+    boost::mpl::for_each<int_types>(range_coding_tester());
+    settings::reset_n_threads();
+}
+
+#if defined(PIRANHA_INT128_T)
+
+BOOST_AUTO_TEST_CASE(kronecker_array_int128_test)
+{
+    using int_type = PIRANHA_INT128_T;
+    using ka = kronecker_array<int_type>;
+    const auto &l = ka::get_limits();
+    BOOST_CHECK(l.size() > kronecker_array<long long>::get_limits().size());
+    // Conversions to/from integer.
+    const integer two_64 = integer(1ull << 32) * integer(1ull << 32);
+    BOOST_CHECK_EQUAL(detail::ka_to_integer(int_type(-5)), -5);
+    BOOST_CHECK_EQUAL(detail::ka_to_integer(static_cast<int_type>(1) << 100u), two_64 * (integer(1) << 36u));
+    BOOST_CHECK_EQUAL(detail::ka_to_integer(std::numeric_limits<int_type>::max()), two_64 * two_64 / 2 - 1);
+    BOOST_CHECK_EQUAL(detail::ka_to_integer(std::numeric_limits<int_type>::min()), -two_64 * two_64 / 2);
+    BOOST_CHECK(detail::ka_integer_cast<int_type>(-two_64 * 3 - 7) == -(static_cast<int_type>(3) << 64u) - 7);
+    BOOST_CHECK(detail::ka_integer_cast<int_type>(two_64 * two_64 / 2 - 1) == std::numeric_limits<int_type>::max());
+    BOOST_CHECK(detail::ka_integer_cast<int_type>(-two_64 * two_64 / 2) == std::numeric_limits<int_type>::min());
+    BOOST_CHECK_THROW(detail::ka_integer_cast<int_type>(two_64 * two_64 / 2), std::overflow_error);
+    BOOST_CHECK_THROW(detail::ka_integer_cast<int_type>(-two_64 * two_64 / 2 - 1), std::overflow_error);
+    // Check the limits.
+    for (decltype(l.size()) i = 1u; i < l.size(); ++i) {
+        const auto &minmax = std::get<0u>(l[i]);
+        BOOST_CHECK_EQUAL(minmax.size(), i);
+        integer prod(1);
+        for (const auto &M : minmax) {
+            BOOST_CHECK(M > 0);
+            prod *= detail::ka_to_integer(M) * 2 + 1;
+        }
+        BOOST_CHECK(std::get<1u>(l[i]) == -std::get<2u>(l[i]));
+        BOOST_CHECK_EQUAL(prod - 1, detail::ka_to_integer(std::get<3u>(l[i])));
+    }
+    // Coding and decoding.
+    std::mt19937 rng;
+    for (decltype(l.size()) i = 1u; i < l.size(); ++i) {
+        const auto &minmax = std::get<0u>(l[i]);
+        std::vector<long long> v(i), v_out(i);
+        for (int j = 0; j < 100; ++j) {
+            for (decltype(l.size()) k = 0u; k < i; ++k) {
+                const long long M = minmax[k] > std::numeric_limits<long long>::max()
+                                        ? std::numeric_limits<long long>::max()
+                                        : static_cast<long long>(minmax[k]);
+                v[k] = std::uniform_int_distribution<long long>(-M, M)(rng);
+            }
+            ka::decode(v_out, ka::encode(v));
+            BOOST_CHECK(v == v_out);
+        }
+        std::vector<int_type> codes{std::get<1u>(l[i]), std::get<2u>(l[i])}, codes_out;
+        std::vector<int_type> range;
+        ka::decode_range(range, codes, i);
+        ka::encode_range(codes_out, range, i);
+        BOOST_CHECK(codes == codes_out);
+        BOOST_CHECK(range[0u] == -minmax[0u]);
+        BOOST_CHECK(range[i] == minmax[0u]);
+    }
+    BOOST_CHECK_THROW(ka::encode(std::vector<long long>(l.size())), std::invalid_argument);
+}
+
+#endif
@@ -31,6 +31,7 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_MODULE kronecker_monomial_test
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <array>
 #include <boost/lexical_cast.hpp>
 #include <boost/mpl/for_each.hpp>
@@ -40,6 +41,7 @@ see https://www.gnu.org/licenses/. */
 #include <iostream>
 #include <limits>
 #include <list>
+#include <numeric>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -50,6 +52,9 @@ see https://www.gnu.org/licenses/. */
 #include <unordered_set>
 #include <vector>
 
+#include "../src/config.hpp"
+#include "../src/detail/grouped_subs.hpp"
+#include "../src/detail/power_table.hpp"
 #include "../src/exceptions.hpp"
 #include "../src/init.hpp"
 #include "../src/is_key.hpp"
@@ -829,6 +834,27 @@ BOOST_AUTO_TEST_CASE(kronecker_monomial_evaluate_test)
     BOOST_CHECK((!key_is_evaluable<kronecker_monomial<>, char *>::value));
     BOOST_CHECK((!key_is_evaluable<kronecker_monomial<>, std::string>::value));
     BOOST_CHECK((!key_is_evaluable<kronecker_monomial<>, void *>::value));
+    // Evaluation via power tables.
+    using k_type = kronecker_monomial<>;
+    using table_type = detail::power_table<double, k_type::value_type>;
+    BOOST_CHECK((detail::key_has_power_table_evaluate<k_type, double>::value));
+    BOOST_CHECK((detail::key_has_power_table_evaluate<k_type, rational>::value));
+    symbol_set vs{symbol("x"), symbol("y"), symbol("z")};
+    const symbol_set::positions_map<double> pmap(
+        vs, std::unordered_map<symbol, double>{{symbol("x"), 1.5}, {symbol("y"), -.5}, {symbol("z"), 3.}});
+    const std::vector<k_type> keys{k_type{1, -2, 3}, k_type{0, 4, -1}, k_type{-3, 0, 0}};
+    table_type::bounds_type bounds;
+    for (const auto &k : keys) {
+        k.update_exponent_bounds(bounds, vs);
+    }
+    BOOST_CHECK((bounds == table_type::bounds_type{{-3, 1}, {-2, 4}, {-1, 3}}));
+    const table_type table(pmap, bounds);
+    for (const auto &k : keys) {
+        BOOST_CHECK_EQUAL(k.evaluate(table, vs), k.evaluate(pmap, vs));
+    }
+    BOOST_CHECK_THROW(keys[0u].evaluate(table, symbol_set{symbol("x"), symbol("y")}), std::invalid_argument);
+    BOOST_CHECK_THROW(keys[0u].update_exponent_bounds(bounds, symbol_set{symbol("x"), symbol("y")}),
+                      std::invalid_argument);
 }
 
 struct subs_tester {
@@ -878,6 +904,17 @@ struct subs_tester {
         BOOST_CHECK_EQUAL(ret3[0u].first, rational(1, 4));
         BOOST_CHECK((ret3[0u].second == k_type{T(0), T(3)}));
         BOOST_CHECK((std::is_same<rational, decltype(ret3[0u].first)>::value));
+        // Splitting.
+        BOOST_CHECK(detail::key_has_subs_split<k_type>::value);
+        auto sp = k1.subs_split("x", vs);
+        BOOST_CHECK_EQUAL(sp.first, T(2));
+        BOOST_CHECK(sp.second[0u] == ret3[0u].second);
+        sp = k1.subs_split("y", vs);
+        BOOST_CHECK_EQUAL(sp.first, T(3));
+        BOOST_CHECK((sp.second[0u] == k_type{T(2), T(0)}));
+        sp = k1.subs_split("z", vs);
+        BOOST_CHECK_EQUAL(sp.first, T(0));
+        BOOST_CHECK(sp.second[0u] == k1);
     }
 };
 
@@ -1175,6 +1212,18 @@ struct ipow_subs_tester {
         BOOST_CHECK_EQUAL(ret3[0u].first, math::pow(rational(-1, 2), T(2)));
         BOOST_CHECK((ret3[0u].second == k_type{T(-1), T(2)}));
         BOOST_CHECK((std::is_same<rational, decltype(ret3[0u].first)>::value));
+        // Splitting.
+        BOOST_CHECK(detail::key_has_ipow_subs_split<k_type>::value);
+        auto sp = k1.ipow_subs_split("x", integer(-3), vs);
+        BOOST_CHECK_EQUAL(sp.first, 2);
+        BOOST_CHECK(sp.second[0u] == ret3[0u].second);
+        sp = k1.ipow_subs_split("x", integer(4), vs);
+        BOOST_CHECK_EQUAL(sp.first, 0);
+        BOOST_CHECK(sp.second[0u] == k1);
+        sp = k1.ipow_subs_split("z", integer(4), vs);
+        BOOST_CHECK_EQUAL(sp.first, 0);
+        BOOST_CHECK(sp.second[0u] == k1);
+        BOOST_CHECK_THROW(k1.ipow_subs_split("x", integer(0), vs), zero_division_error);
     }
 };
 
@@ -1358,3 +1407,78 @@ BOOST_AUTO_TEST_CASE(kronecker_monomial_has_negative_exponent_test)
 {
     boost::mpl::for_each<int_types>(has_negative_exponent_tester());
 }
+
+#if defined(PIRANHA_INT128_T)
+
+BOOST_AUTO_TEST_CASE(kronecker_monomial_int128_test)
+{
+    using int_type = PIRANHA_INT128_T;
+    using k_type = kronecker_monomial<int_type>;
+    using ka = kronecker_array<int_type>;
+    BOOST_CHECK((std::is_same<k_type::int_type, int_type>::value));
+    BOOST_CHECK((std::is_same<k_type::value_type, long long>::value));
+    BOOST_CHECK(is_key<k_type>::value);
+    BOOST_CHECK(key_has_degree<k_type>::value);
+    BOOST_CHECK(key_is_differentiable<k_type>::value);
+    // The 128-bit codes can represent many more variables than the 64-bit ones.
+    BOOST_CHECK(ka::get_limits().size() > kronecker_array<long long>::get_limits().size());
+    symbol_set ss;
+    for (int i = 0; i < 16; ++i) {
+        ss.add(symbol("x" + std::to_string(100 + i)));
+    }
+    // With 16 variables, the 64-bit codes allow only small exponents.
+    BOOST_CHECK(std::get<0u>(kronecker_array<long long>::get_limits()[16u])[0u] < 10);
+    const auto &minmax = std::get<0u>(ka::get_limits()[16u]);
+    std::vector<long long> v1, v2;
+    for (int i = 0; i < 16; ++i) {
+        v1.push_back(static_cast<long long>(i % 2 ? -i : i));
+        v2.push_back(static_cast<long long>(minmax[static_cast<std::size_t>(i)] / 2));
+    }
+    k_type k1(v1.begin(), v1.end()), k2(v2.begin(), v2.end()), k3;
+    BOOST_CHECK(k1.is_compatible(ss));
+    BOOST_CHECK(k2.is_compatible(ss));
+    auto u1 = k1.unpack(ss);
+    BOOST_CHECK(std::equal(u1.begin(), u1.end(), v1.begin()));
+    auto u2 = k2.unpack(ss);
+    BOOST_CHECK(std::equal(u2.begin(), u2.end(), v2.begin()));
+    // Multiplication.
+    k_type::multiply(k3, k1, k2, ss);
+    auto u3 = k3.unpack(ss);
+    for (decltype(u3.size()) i = 0u; i < 16u; ++i) {
+        BOOST_CHECK_EQUAL(u3[i], v1[i] + v2[i]);
+    }
+    // The hash is additive modulo 2**N.
+    BOOST_CHECK_EQUAL(k3.hash(), k1.hash() + k2.hash());
+    // Degree.
+    BOOST_CHECK((std::is_same<decltype(k1.degree(ss)), long long>::value));
+    BOOST_CHECK_EQUAL(k1.degree(ss), std::accumulate(v1.begin(), v1.end(), 0ll));
+    // Partial derivative.
+    auto p = k1.partial(symbol_set::positions(ss, symbol_set{symbol("x102")}), ss);
+    BOOST_CHECK_EQUAL(p.first, 2);
+    v1[2u] = 1;
+    BOOST_CHECK(p.second == k_type(v1.begin(), v1.end()));
+    // Printing.
+    std::ostringstream oss;
+    k_type{1, 2}.print(oss, symbol_set{symbol("x"), symbol("y")});
+    BOOST_CHECK_EQUAL(oss.str(), "x*y**2");
+    // Out of bounds.
+    v1[0u] = static_cast<long long>(minmax[0u]) + 1;
+    BOOST_CHECK_THROW(k_type(v1.begin(), v1.end()), std::invalid_argument);
+    // Serialization, including negative codes and codes not representable in 64 bits.
+    for (const auto &k : {k1, k2, k3, k_type(-k2.get_int())}) {
+        std::stringstream sstr;
+        {
+            boost::archive::text_oarchive oa(sstr);
+            oa << k;
+        }
+        k_type tmp;
+        {
+            boost::archive::text_iarchive ia(sstr);
+            ia >> tmp;
+        }
+        BOOST_CHECK(tmp == k);
+    }
+    BOOST_CHECK(k2.get_int() > std::numeric_limits<long long>::max());
+}
+
+#endif
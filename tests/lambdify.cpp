@@ -31,21 +31,30 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_MODULE lambdify_test
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <random>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "../src/exceptions.hpp"
+#include "../src/horner_plan.hpp"
 #include "../src/init.hpp"
 #include "../src/kronecker_monomial.hpp"
 #include "../src/math.hpp"
+#include "../src/monomial.hpp"
 #include "../src/mp_integer.hpp"
 #include "../src/mp_rational.hpp"
 #include "../src/polynomial.hpp"
 #include "../src/rational_function.hpp"
 #include "../src/real.hpp"
+#include "../src/settings.hpp"
 
 using namespace piranha;
 using math::lambdify;
@@ -298,3 +307,167 @@ BOOST_AUTO_TEST_CASE(lambdify_test_02)
     en = l2.get_extra_names();
     BOOST_CHECK((en == std::vector<std::string>{"t", "a"} || en == std::vector<std::string>{"a", "t"}));
 }
+
+BOOST_AUTO_TEST_CASE(lambdify_test_03)
+{
+    // Batch evaluation.
+    {
+        using p_type = polynomial<rational, k_monomial>;
+        p_type x{"x"}, y{"y"}, z{"z"};
+        const auto tmp = math::pow(x - 2 * y + z / 3 + 1, 6) * (x * x * x - y / 5 + 2) + z * z;
+        auto l = lambdify<rational>(tmp, {"y", "x", "z", "t"});
+        std::uniform_int_distribution<int> dist(-10, 10);
+        std::vector<std::vector<rational>> values(4u);
+        for (int i = 0; i < ntrials; ++i) {
+            for (auto &v : values) {
+                v.push_back(rational(dist(rng), 3));
+            }
+        }
+        auto check = [&l, &values]() {
+            const auto res = l.evaluate_batch(values);
+            BOOST_CHECK_EQUAL(res.size(), static_cast<std::size_t>(ntrials));
+            for (std::size_t i = 0u; i < res.size(); ++i) {
+                BOOST_CHECK_EQUAL(res[i], l({values[0u][i], values[1u][i], values[2u][i], values[3u][i]}));
+            }
+        };
+        check();
+        // Single points are evaluated via the compiled representation.
+        for (std::size_t i = 0u; i < 10u; ++i) {
+            BOOST_CHECK_EQUAL(l({values[0u][i], values[1u][i], values[2u][i], values[3u][i]}),
+                              math::evaluate(tmp, std::unordered_map<std::string, rational>{{"y", values[0u][i]},
+                                                                                             {"x", values[1u][i]},
+                                                                                             {"z", values[2u][i]}}));
+        }
+        // With threads.
+        for (unsigned nt = 2u; nt <= 4u; ++nt) {
+            settings::set_n_threads(nt);
+            check();
+        }
+        settings::reset_n_threads();
+        // Copies and moves.
+        auto l1(l);
+        BOOST_CHECK(l1.evaluate_batch(values) == l.evaluate_batch(values));
+        auto l2(std::move(l1));
+        BOOST_CHECK(l2.evaluate_batch(values) == l.evaluate_batch(values));
+        // Error handling.
+        BOOST_CHECK_THROW(l.evaluate_batch({}), std::invalid_argument);
+        values[1u].pop_back();
+        BOOST_CHECK_THROW(l.evaluate_batch(values), std::invalid_argument);
+        BOOST_CHECK(l.evaluate_batch({{}, {}, {}, {}}).empty());
+        BOOST_CHECK(lambdify<rational>(tmp, {}).evaluate_batch({}).empty());
+        // Missing symbol.
+        BOOST_CHECK_THROW(lambdify<rational>(tmp, {"y", "x"}).evaluate_batch({{1_q}, {2_q}}), std::invalid_argument);
+        // Empty polynomial.
+        BOOST_CHECK(
+            (lambdify<rational>(p_type{}, {"x"}).evaluate_batch({{1_q, 2_q}}) == std::vector<rational>{0_q, 0_q}));
+        BOOST_CHECK_EQUAL(lambdify<rational>(p_type{}, {"x"})({1_q}), 0);
+        // Constant polynomial.
+        BOOST_CHECK((lambdify<rational>(p_type{3 / 2_q}, {"x"}).evaluate_batch({{1_q, 2_q}})
+                     == std::vector<rational>{3 / 2_q, 3 / 2_q}));
+    }
+    {
+        // Floating-point values, negative exponents and extra map.
+        using p_type = polynomial<double, monomial<int>>;
+        p_type x{"x"}, y{"y"}, z{"z"};
+        const auto tmp = math::pow(x - 2.5 * y + z / 3 + 1, 5) * (x * x * x - y / 5) + math::pow(y, -3) * z;
+        auto l = lambdify<double>(tmp, {"x", "y"}, {{"z", [](const std::vector<double> &v) {
+                                                        BOOST_CHECK_EQUAL(v.size(), 2u);
+                                                        return v[0] * v[1];
+                                                    }}});
+        std::uniform_real_distribution<double> dist(.5, 2.);
+        std::vector<std::vector<double>> values(2u);
+        for (int i = 0; i < 10 * ntrials; ++i) {
+            for (auto &v : values) {
+                v.push_back(dist(rng));
+            }
+        }
+        settings::set_n_threads(3u);
+        const auto res = l.evaluate_batch(values);
+        settings::reset_n_threads();
+        BOOST_CHECK_EQUAL(res.size(), values[0u].size());
+        for (std::size_t i = 0u; i < res.size(); ++i) {
+            const auto cmp = l({values[0u][i], values[1u][i]});
+            BOOST_CHECK(std::abs(res[i] - cmp) <= 1E-12 * std::abs(cmp));
+        }
+        // Horner plan. The error of the evaluation of a polynomial via a sequence of at most n floating-point
+        // operations per term is bounded by gamma_n * pa(|x|), where pa is the polynomial with the absolute values
+        // of the coefficients and gamma_n = n * u / (1 - n * u), u being the unit roundoff (Higham, Accuracy
+        // and Stability of Numerical Algorithms, 2nd ed., section 5.1). For the plan, n is bounded by its size
+        // plus the number of symbols. In the batch evaluation, each term requires 3 powers, 3 multiplications
+        // and the compensated summation adds 2 more operations.
+        auto gamma_n = [](std::size_t n) {
+            const double nu = static_cast<double>(n) * std::numeric_limits<double>::epsilon() / 2.;
+            return nu / (1. - nu);
+        };
+        p_type tmp_abs;
+        tmp_abs.set_symbol_set(tmp.get_symbol_set());
+        for (const auto &t : tmp._container()) {
+            tmp_abs.insert(p_type::term_type(std::abs(t.m_cf), t.m_key));
+        }
+        const auto n_ops = horner_plan<p_type>(tmp).size() + 3u;
+        BOOST_CHECK(!l.has_horner_plan());
+        auto lh(l);
+        lh.build_horner_plan();
+        BOOST_CHECK(lh.has_horner_plan());
+        BOOST_CHECK(!l.has_horner_plan());
+        const auto lh2(lh);
+        BOOST_CHECK(lh2.has_horner_plan());
+        for (std::size_t i = 0u; i < res.size(); ++i) {
+            const auto vx = values[0u][i], vy = values[1u][i];
+            const auto bound = (gamma_n(n_ops) + gamma_n(8u))
+                               * evaluate(tmp_abs, std::unordered_map<std::string, double>{
+                                                       {"x", vx}, {"y", vy}, {"z", vx * vy}});
+            BOOST_CHECK(std::abs(res[i] - lh({vx, vy})) <= bound);
+            BOOST_CHECK_EQUAL(lh({vx, vy}), lh2({vx, vy}));
+        }
+        // Missing symbol.
+        auto lh3 = lambdify<double>(tmp, {"x", "y"});
+        lh3.build_horner_plan();
+        BOOST_CHECK_THROW(lh3({1., 2.}), std::invalid_argument);
+    }
+    {
+        // Horner plan with exact values.
+        using p_type = polynomial<rational, monomial<int>>;
+        p_type x{"x"}, y{"y"}, z{"z"};
+        const auto tmp = math::pow(x - 2 * y + z / 3 + 1, 6) * (x * x * x - y / 5 + 2) + math::pow(z, -2);
+        auto l = lambdify<rational>(tmp, {"y", "x"}, {{"z", [](const std::vector<rational> &v) { return v[0] + 1; }}});
+        l.build_horner_plan();
+        BOOST_CHECK_EQUAL(l({1 / 2_q, -3_q}),
+                          evaluate(tmp, std::unordered_map<std::string, rational>{
+                                            {"x", -3_q}, {"y", 1 / 2_q}, {"z", 3 / 2_q}}));
+        // Coefficients depending on the evaluation values.
+        using p_type2 = polynomial<p_type, monomial<int>>;
+        const auto tmp2 = math::pow(p_type2{"a"} * x + p_type2{"b"} + 1, 4);
+        auto l2 = lambdify<rational>(tmp2, {"x", "a", "b"});
+        l2.build_horner_plan();
+        BOOST_CHECK_EQUAL(l2({1 / 2_q, -3_q, 5_q}),
+                          evaluate(tmp2, std::unordered_map<std::string, rational>{
+                                             {"x", 1 / 2_q}, {"a", -3_q}, {"b", 5_q}}));
+    }
+    {
+        // Objects which are not compiled.
+        using r_type = rational_function<k_monomial>;
+        r_type x{"x"}, y{"y"};
+        auto l = lambdify<rational>((x + y) / (y - 1), {"x", "y"});
+        const auto res = l.evaluate_batch({{1_q, 2_q, 3_q}, {1 / 2_q, 2_q, 4_q}});
+        BOOST_CHECK((res == std::vector<rational>{-3_q, 4_q, 7 / 3_q}));
+        BOOST_CHECK_THROW(l.evaluate_batch({{1_q}, {1_q}}), zero_division_error);
+    }
+    {
+        // Concurrent calls to the call operator.
+        using p_type = polynomial<integer, k_monomial>;
+        p_type x{"x"}, y{"y"};
+        const auto l = lambdify<integer>(math::pow(x + y + 1, 10), {"x", "y"});
+        std::vector<integer> res(4u);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&l, &res, i]() { res[static_cast<std::size_t>(i)] = l({integer(i), 1_z}); });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        for (int i = 0; i < 4; ++i) {
+            BOOST_CHECK_EQUAL(res[static_cast<std::size_t>(i)], math::pow(integer(i) + 2, 10));
+        }
+    }
+}
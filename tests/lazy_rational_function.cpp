@@ -0,0 +1,243 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include "../src/lazy_rational_function.hpp"
+
+#define BOOST_TEST_MODULE lazy_rational_function_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/vector.hpp>
+#include <random>
+#include <type_traits>
+
+#include "../src/exceptions.hpp"
+#include "../src/init.hpp"
+#include "../src/kronecker_monomial.hpp"
+#include "../src/monomial.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/mp_rational.hpp"
+#include "../src/rational_function.hpp"
+
+using namespace piranha;
+
+using key_types = boost::mpl::vector<k_monomial, monomial<unsigned char>, monomial<integer>>;
+
+static std::mt19937 rng;
+static const int ntrials = 100;
+
+template <typename Poly>
+inline static Poly rn_poly(const Poly &x, const Poly &y, const Poly &z, std::uniform_int_distribution<int> &dist)
+{
+    int nterms = dist(rng);
+    Poly retval;
+    for (int i = 0; i < nterms; ++i) {
+        int m = dist(rng);
+        retval += m * (m % 2 ? 1 : -1) * x.pow(dist(rng)) * y.pow(dist(rng)) * z.pow(dist(rng));
+    }
+    return retval;
+}
+
+struct basic_tester {
+    template <typename Key>
+    void operator()(const Key &)
+    {
+        using l_type = lazy_rational_function<Key>;
+        using r_type = rational_function<Key>;
+        using p_type = typename r_type::p_type;
+        BOOST_CHECK(std::is_default_constructible<l_type>::value);
+        BOOST_CHECK((std::is_constructible<l_type, r_type>::value));
+        BOOST_CHECK((std::is_constructible<l_type, p_type>::value));
+        BOOST_CHECK((std::is_constructible<l_type, int>::value));
+        BOOST_CHECK((std::is_constructible<l_type, rational>::value));
+        BOOST_CHECK((!std::is_convertible<int, l_type>::value));
+        l_type l0;
+        BOOST_CHECK(l0.is_reduced());
+        BOOST_CHECK_EQUAL(l0.get(), r_type{});
+        BOOST_CHECK_EQUAL(l0.size(), 1u);
+        BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(l0), "0");
+        p_type x{"x"}, y{"y"};
+        l_type lx{x}, ly{y};
+        BOOST_CHECK(lx.is_reduced());
+        BOOST_CHECK_EQUAL(lx.get(), r_type{x});
+        BOOST_CHECK_EQUAL(l_type{rational(4, -6)}.get(), (r_type{rational(-2, 3)}));
+        // Operations between polynomials keep the unitary denominator and stay canonical.
+        auto l1 = lx * ly + 3 * lx - 1;
+        BOOST_CHECK(l1.is_reduced());
+        BOOST_CHECK_EQUAL(l1.get(), r_type{x * y + 3 * x - 1});
+        // Division does not compute the GCD.
+        auto l2 = (lx * ly) / (lx * lx);
+        BOOST_CHECK(!l2.is_reduced());
+        BOOST_CHECK_EQUAL(l2.num(), x * y);
+        BOOST_CHECK_EQUAL(l2.den(), x * x);
+        BOOST_CHECK_EQUAL(l2.get(), (r_type{y, x}));
+        BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(l2), boost::lexical_cast<std::string>(r_type(y, x)));
+        BOOST_CHECK(l2 == (r_type{y, x}));
+        BOOST_CHECK((r_type{y, x}) == l2);
+        BOOST_CHECK(l2 != lx);
+        BOOST_CHECK(l2 != 1);
+        l2.reduce();
+        BOOST_CHECK(l2.is_reduced());
+        BOOST_CHECK_EQUAL(l2.num(), y);
+        BOOST_CHECK_EQUAL(l2.den(), x);
+        // Zero numerators are simplified eagerly.
+        auto l3 = l2 - l2;
+        BOOST_CHECK(l3.is_reduced());
+        BOOST_CHECK(l3 == 0);
+        BOOST_CHECK_EQUAL(l3.size(), 1u);
+        // Same denominator in addition.
+        auto l4 = lx / ly + 1 / ly;
+        BOOST_CHECK_EQUAL(l4.den(), y);
+        BOOST_CHECK_EQUAL(l4.get(), (r_type{x + 1, y}));
+        // Mixed operations with the interoperable types.
+        BOOST_CHECK_EQUAL((l2 + r_type{x}).get(), (r_type{y, x} + x));
+        BOOST_CHECK_EQUAL((2 - l2).get(), (2 - r_type{y, x}));
+        BOOST_CHECK_EQUAL((rational(1, 2) * l2).get(), (rational(1, 2) * r_type{y, x}));
+        BOOST_CHECK_EQUAL((x / l2).get(), (x / r_type{y, x}));
+        BOOST_CHECK_EQUAL((-l2).get(), (-r_type{y, x}));
+        BOOST_CHECK_EQUAL((+l2).get(), (r_type{y, x}));
+        // In-place operators.
+        l_type l5{lx};
+        l5 += 1;
+        l5 *= ly;
+        l5 -= x;
+        l5 /= l_type{x} - 2;
+        BOOST_CHECK_EQUAL(l5.get(), (r_type{x * y + y - x, x - 2}));
+        // Division by zero.
+        BOOST_CHECK_THROW(lx / 0, zero_division_error);
+        BOOST_CHECK_THROW(lx / (ly - ly), zero_division_error);
+        BOOST_CHECK_THROW(l5 /= l_type{}, zero_division_error);
+        BOOST_CHECK_EQUAL(l5.get(), (r_type{x * y + y - x, x - 2}));
+    }
+};
+
+BOOST_AUTO_TEST_CASE(lazy_rational_function_basic_test)
+{
+    init();
+    boost::mpl::for_each<key_types>(basic_tester());
+}
+
+struct threshold_tester {
+    template <typename Key>
+    void operator()(const Key &)
+    {
+        using l_type = lazy_rational_function<Key>;
+        using r_type = rational_function<Key>;
+        using p_type = typename r_type::p_type;
+        BOOST_CHECK_EQUAL(l_type::get_reduction_threshold(), 64u);
+        p_type x{"x"}, y{"y"};
+        // Sum of 1 / (x + i * y): without reductions the denominator would be the
+        // product of all the factors, which are all coprime.
+        l_type::set_reduction_threshold(0u);
+        l_type s0;
+        r_type r0;
+        for (int i = 1; i <= 12; ++i) {
+            s0 += 1 / l_type{x + i * y};
+            r0 += 1 / r_type{x + i * y};
+            BOOST_CHECK(s0 == r0);
+        }
+        BOOST_CHECK_EQUAL(s0.get(), r0);
+        // With a large threshold, no reduction happens.
+        l_type::set_reduction_threshold(1000000u);
+        l_type s1;
+        for (int i = 1; i <= 12; ++i) {
+            s1 += (x - i * y) / l_type{x * x - i * i * y * y};
+        }
+        BOOST_CHECK(!s1.is_reduced());
+        BOOST_CHECK_EQUAL(s1.get(), r0);
+        // With a small threshold, reductions happen along the way and the size stays bounded.
+        l_type::set_reduction_threshold(8u);
+        l_type s2;
+        for (int i = 1; i <= 12; ++i) {
+            s2 += (x - i * y) / l_type{x * x - i * i * y * y};
+        }
+        BOOST_CHECK(s2.size() < s1.size());
+        BOOST_CHECK_EQUAL(s2.get(), r0);
+        l_type::reset_reduction_threshold();
+        BOOST_CHECK_EQUAL(l_type::get_reduction_threshold(), 64u);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(lazy_rational_function_threshold_test)
+{
+    boost::mpl::for_each<key_types>(threshold_tester());
+}
+
+struct random_tester {
+    template <typename Key>
+    void operator()(const Key &)
+    {
+        using l_type = lazy_rational_function<Key>;
+        using r_type = rational_function<Key>;
+        using p_type = typename r_type::p_type;
+        p_type x{"x"}, y{"y"}, z{"z"};
+        std::uniform_int_distribution<int> dist(0, 3), op_dist(0, 3);
+        for (auto threshold : {0u, 8u, 64u}) {
+            l_type::set_reduction_threshold(threshold);
+            for (int i = 0; i < ntrials; ++i) {
+                r_type r{rn_poly(x, y, z, dist)};
+                l_type l{r};
+                // Chain of random operations, compared against the eager rational function.
+                for (int j = 0; j < 6; ++j) {
+                    const auto n = rn_poly(x, y, z, dist), d = rn_poly(x, y, z, dist);
+                    if (math::is_zero(n) || math::is_zero(d)) {
+                        continue;
+                    }
+                    const r_type tmp{n, d};
+                    switch (op_dist(rng)) {
+                        case 0:
+                            r += tmp;
+                            l += l_type{n} / d;
+                            break;
+                        case 1:
+                            r -= tmp;
+                            l -= l_type{n} / d;
+                            break;
+                        case 2:
+                            r *= tmp;
+                            l *= l_type{n} / d;
+                            break;
+                        default:
+                            r /= tmp;
+                            l /= l_type{n} / d;
+                    }
+                    BOOST_CHECK(l == r);
+                }
+                BOOST_CHECK_EQUAL(l.get(), r);
+                BOOST_CHECK(l.get().is_canonical());
+            }
+        }
+        l_type::reset_reduction_threshold();
+    }
+};
+
+BOOST_AUTO_TEST_CASE(lazy_rational_function_random_test)
+{
+    boost::mpl::for_each<key_types>(random_tester());
+}
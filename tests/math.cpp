@@ -351,6 +351,20 @@ BOOST_AUTO_TEST_CASE(math_sin_cos_test)
     BOOST_CHECK(!has_sine<sin_01>::value);
 }
 
+BOOST_AUTO_TEST_CASE(math_exp_log_test)
+{
+    BOOST_CHECK(math::exp(1.f) == std::exp(1.f));
+    BOOST_CHECK(math::exp(2.) == std::exp(2.));
+    BOOST_CHECK(math::log(1.f) == std::log(1.f));
+    BOOST_CHECK(math::log(2.L) == std::log(2.L));
+    BOOST_CHECK_EQUAL(math::exp(0), 1);
+    BOOST_CHECK_EQUAL(math::log(1), 0);
+    BOOST_CHECK_THROW(math::exp(1), std::invalid_argument);
+    BOOST_CHECK_THROW(math::log(2), std::invalid_argument);
+    BOOST_CHECK((std::is_same<unsigned short, decltype(math::exp((unsigned short)0))>::value));
+    BOOST_CHECK((std::is_same<long, decltype(math::log(1l))>::value));
+}
+
 BOOST_AUTO_TEST_CASE(math_partial_test)
 {
     BOOST_CHECK(piranha::is_differentiable<int>::value);
@@ -48,6 +48,8 @@ see https://www.gnu.org/licenses/. */
 #include <unordered_set>
 #include <vector>
 
+#include "../src/detail/grouped_subs.hpp"
+#include "../src/detail/power_table.hpp"
 #include "../src/exceptions.hpp"
 #include "../src/init.hpp"
 #include "../src/key_is_convertible.hpp"
@@ -504,6 +506,24 @@ BOOST_AUTO_TEST_CASE(monomial_degree_test)
                       std::numeric_limits<int>::min());
     BOOST_CHECK_THROW(m.degree(symbol_set::positions(vs, symbol_set{symbol{"x"}, symbol{"z"}}), vs),
                       std::overflow_error);
+    // Only the final result is checked for small integral exponents.
+    m = k_type{std::numeric_limits<int>::max(), 1, -1};
+    BOOST_CHECK_EQUAL(m.degree(vs), std::numeric_limits<int>::max());
+    m = k_type{std::numeric_limits<int>::min(), -1, 1};
+    BOOST_CHECK_EQUAL(m.degree(vs), std::numeric_limits<int>::min());
+    m = k_type{std::numeric_limits<int>::max(), std::numeric_limits<int>::max(), std::numeric_limits<int>::min()};
+    BOOST_CHECK_EQUAL(m.degree(symbol_set::positions(vs, symbol_set{symbol{"x"}, symbol{"y"}, symbol{"z"}}), vs),
+                      std::numeric_limits<int>::max() - 1);
+    // Short exponents are promoted to int in the computation of the degree.
+    using k_type2 = monomial<short>;
+    k_type2 m2{std::numeric_limits<short>::max(), std::numeric_limits<short>::max(), short(1)};
+    BOOST_CHECK_EQUAL(m2.degree(vs), 2 * int(std::numeric_limits<short>::max()) + 1);
+    // Larger types retain the check on each addition.
+    using k_type3 = monomial<long long>;
+    k_type3 m3{std::numeric_limits<long long>::max(), 1ll, -1ll};
+    BOOST_CHECK_THROW(m3.degree(vs), std::overflow_error);
+    m3 = k_type3{std::numeric_limits<long long>::max(), -1ll, 1ll};
+    BOOST_CHECK_EQUAL(m3.degree(vs), std::numeric_limits<long long>::max());
 }
 
 // Mock cf with wrong specialisation of mul3.
@@ -1042,6 +1062,41 @@ BOOST_AUTO_TEST_CASE(monomial_evaluate_test)
     BOOST_CHECK((!key_is_evaluable<monomial<rational>, void *>::value));
 }
 
+BOOST_AUTO_TEST_CASE(monomial_power_table_evaluate_test)
+{
+    using k_type = monomial<int>;
+    using pmap_type = symbol_set::positions_map<rational>;
+    using dict_type = std::unordered_map<symbol, rational>;
+    using table_type = detail::power_table<rational, int>;
+    BOOST_CHECK((detail::key_has_power_table_evaluate<k_type, rational>::value));
+    BOOST_CHECK((detail::key_has_power_table_evaluate<monomial<signed char>, double>::value));
+    BOOST_CHECK((!detail::key_has_power_table_evaluate<monomial<integer>, rational>::value));
+    BOOST_CHECK((!detail::key_has_power_table_evaluate<monomial<rational>, double>::value));
+    symbol_set vs{symbol("x"), symbol("y")};
+    const pmap_type pmap(vs, dict_type{{symbol("x"), rational(-4, 3)}, {symbol("y"), rational(1, 2)}});
+    table_type::bounds_type bounds;
+    const std::vector<k_type> keys{k_type{2, -3}, k_type{-1, 5}, k_type{0, 0}, k_type{4, 1}};
+    for (const auto &k : keys) {
+        k.update_exponent_bounds(bounds, vs);
+    }
+    BOOST_CHECK((bounds == table_type::bounds_type{{-1, 4}, {-3, 5}}));
+    BOOST_CHECK_EQUAL(table_type::table_size(bounds), 15);
+    const table_type table(pmap, bounds);
+    BOOST_CHECK_EQUAL(table.size(), 2u);
+    for (const auto &k : keys) {
+        BOOST_CHECK_EQUAL(k.evaluate(table, vs), k.evaluate(pmap, vs));
+    }
+    // Size mismatches.
+    BOOST_CHECK_THROW(k_type{1}.update_exponent_bounds(bounds, vs), std::invalid_argument);
+    BOOST_CHECK_THROW(k_type{1}.evaluate(table, vs), std::invalid_argument);
+    BOOST_CHECK_THROW((k_type{1, 2, 3}.update_exponent_bounds(bounds, symbol_set{symbol("a"), symbol("b"),
+                                                                                  symbol("c")})),
+                      std::invalid_argument);
+    // Positions map not covering all the bounds.
+    BOOST_CHECK_THROW(table_type(pmap_type(vs, dict_type{{symbol("y"), rational(1)}}), bounds),
+                      std::invalid_argument);
+}
+
 struct subs_tester {
     template <typename T>
     struct runner {
@@ -1091,6 +1146,18 @@ struct subs_tester {
             BOOST_CHECK_EQUAL(ret3[0u].first, rational(1, 4));
             BOOST_CHECK((ret3[0u].second == k_type{T(0), T(3)}));
             BOOST_CHECK((std::is_same<rational, decltype(ret3[0u].first)>::value));
+            // Splitting.
+            BOOST_CHECK(detail::key_has_subs_split<k_type>::value);
+            auto sp = k1.subs_split("x", vs);
+            BOOST_CHECK_EQUAL(sp.first, T(2));
+            BOOST_CHECK(sp.second[0u] == ret3[0u].second);
+            sp = k1.subs_split("y", vs);
+            BOOST_CHECK_EQUAL(sp.first, T(3));
+            BOOST_CHECK((sp.second[0u] == k_type{T(2), T(0)}));
+            sp = k1.subs_split("z", vs);
+            BOOST_CHECK_EQUAL(sp.first, T(0));
+            BOOST_CHECK(sp.second[0u] == k1);
+            BOOST_CHECK_THROW(k1.subs_split("x", symbol_set{}), std::invalid_argument);
         }
     };
     template <typename T>
@@ -1357,6 +1424,19 @@ struct ipow_subs_tester {
             BOOST_CHECK_EQUAL(ret3[0u].first, math::pow(rational(-1, 2), T(2)));
             BOOST_CHECK((ret3[0u].second == k_type{T(-1), T(2)}));
             BOOST_CHECK((std::is_same<rational, decltype(ret3[0u].first)>::value));
+            // Splitting.
+            BOOST_CHECK(detail::key_has_ipow_subs_split<k_type>::value);
+            auto sp = k1.ipow_subs_split("x", integer(-3), vs);
+            BOOST_CHECK_EQUAL(sp.first, 2);
+            BOOST_CHECK(sp.second[0u] == ret3[0u].second);
+            sp = k1.ipow_subs_split("x", integer(4), vs);
+            BOOST_CHECK_EQUAL(sp.first, 0);
+            BOOST_CHECK(sp.second[0u] == k1);
+            sp = k1.ipow_subs_split("z", integer(4), vs);
+            BOOST_CHECK_EQUAL(sp.first, 0);
+            BOOST_CHECK(sp.second[0u] == k1);
+            BOOST_CHECK_THROW(k1.ipow_subs_split("x", integer(0), vs), zero_division_error);
+            BOOST_CHECK_THROW(k1.ipow_subs_split("x", integer(2), symbol_set{}), std::invalid_argument);
         }
     };
     template <typename T>
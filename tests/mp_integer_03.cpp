@@ -1329,6 +1329,10 @@ struct sin_cos_tester {
         BOOST_CHECK_EQUAL(math::cos(int_type()), 1);
         BOOST_CHECK_THROW(math::sin(int_type(1)), std::invalid_argument);
         BOOST_CHECK_THROW(math::cos(int_type(1)), std::invalid_argument);
+        BOOST_CHECK_EQUAL(math::exp(int_type()), 1);
+        BOOST_CHECK_EQUAL(math::log(int_type(1)), 0);
+        BOOST_CHECK_THROW(math::exp(int_type(1)), std::invalid_argument);
+        BOOST_CHECK_THROW(math::log(int_type(2)), std::invalid_argument);
         BOOST_CHECK((std::is_same<int_type, decltype(math::cos(int_type{}))>::value));
         BOOST_CHECK((std::is_same<int_type, decltype(math::sin(int_type{}))>::value));
         BOOST_CHECK(has_sine<int_type>::value);
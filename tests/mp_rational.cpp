@@ -2022,6 +2022,12 @@ struct sin_cos_tester {
         BOOST_CHECK((std::is_same<q_type, decltype(math::sin(q_type()))>::value));
         BOOST_CHECK_THROW(math::sin(q_type(1)), std::invalid_argument);
         BOOST_CHECK_THROW(math::cos(q_type(1)), std::invalid_argument);
+        BOOST_CHECK_EQUAL(math::exp(q_type()), 1);
+        BOOST_CHECK_EQUAL(math::log(q_type(1)), 0);
+        BOOST_CHECK((std::is_same<q_type, decltype(math::exp(q_type()))>::value));
+        BOOST_CHECK((std::is_same<q_type, decltype(math::log(q_type()))>::value));
+        BOOST_CHECK_THROW(math::exp(q_type(1, 2)), std::invalid_argument);
+        BOOST_CHECK_THROW(math::log(q_type(2)), std::invalid_argument);
         BOOST_CHECK(has_sine<q_type>::value);
         BOOST_CHECK(has_cosine<q_type>::value);
     }
@@ -2321,3 +2327,64 @@ BOOST_AUTO_TEST_CASE(mp_rational_ero_test)
 {
     boost::mpl::for_each<size_types>(ero_tester());
 }
+
+struct sum_accumulator_tester {
+    template <typename T>
+    void operator()(const T &)
+    {
+        using q_type = mp_rational<T::value>;
+        using int_type = typename q_type::int_type;
+        // Empty accumulation.
+        {
+            detail::sum_accumulator<q_type> acc;
+            auto res = acc.get();
+            BOOST_CHECK_EQUAL(res, 0);
+            BOOST_CHECK(res.is_canonical());
+        }
+        // Simple checks, including cancellations.
+        {
+            detail::sum_accumulator<q_type> acc;
+            acc.multiply_accumulate(q_type{1, 2}, q_type{2, 3});
+            acc.multiply_accumulate(q_type{-1, 3}, q_type{1});
+            auto res = acc.get();
+            BOOST_CHECK_EQUAL(res, 0);
+            BOOST_CHECK_EQUAL(res.den(), 1);
+        }
+        {
+            detail::sum_accumulator<q_type> acc;
+            acc.add(q_type{1, 6});
+            acc.multiply_accumulate(q_type{3, 4}, q_type{2, 9});
+            acc.multiply_accumulate(q_type{3, 4}, int_type{2});
+            acc.multiply_accumulate(q_type{1, 5}, 3);
+            auto res = acc.get();
+            BOOST_CHECK_EQUAL(res, q_type(1, 6) + q_type(3, 4) * q_type(2, 9) + q_type(3, 2) + q_type(3, 5));
+            BOOST_CHECK(res.is_canonical());
+        }
+        // Random testing against the canonical arithmetic. Use both small and large denominators,
+        // so that the reduction of the intermediate denominator is triggered.
+        std::uniform_int_distribution<int> int_dist(-10000, 10000), den_dist(1, 100);
+        for (int bits = 1; bits < 4; ++bits) {
+            for (int i = 0; i < ntries / 10; ++i) {
+                detail::sum_accumulator<q_type> acc;
+                q_type cmp;
+                for (int j = 0; j < 100; ++j) {
+                    q_type a{int_dist(rng), den_dist(rng)}, b{int_dist(rng), int_type(den_dist(rng)).pow(bits * 10)};
+                    acc.multiply_accumulate(a, b);
+                    cmp += a * b;
+                    if (j % 10 == 0) {
+                        acc.add(a);
+                        cmp += a;
+                    }
+                }
+                auto res = acc.get();
+                BOOST_CHECK_EQUAL(res, cmp);
+                BOOST_CHECK(res.is_canonical());
+            }
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(mp_rational_sum_accumulator_test)
+{
+    boost::mpl::for_each<size_types>(sum_accumulator_tester());
+}
@@ -59,6 +59,31 @@ inline polynomial<Cf, Key> pearce1(unsigned long long factor = 1u)
         return f * g;
     }
 }
+
+// Division counterpart of pearce1(): compute (f * g) / f, timing only the division.
+template <typename Cf, typename Key>
+inline polynomial<Cf, Key> pearce1_division(unsigned long long factor = 1u)
+{
+    typedef polynomial<Cf, Key> p_type;
+    p_type x("x"), y("y"), z("z"), t("t"), u("u");
+    auto f = (x + y + z * z * 2 + t * t * t * 3 + u * u * u * u * u * 5 + 1);
+    auto tmp_f(f);
+    auto g = (u + t + z * z * 2 + y * y * y * 3 + x * x * x * x * x * 5 + 1);
+    auto tmp_g(g);
+    for (int i = 1; i < 12; ++i) {
+        f *= tmp_f;
+        g *= tmp_g;
+    }
+    if (factor > 1u) {
+        f *= factor;
+        g *= factor;
+    }
+    const auto prod = f * g;
+    {
+        boost::timer::auto_cpu_timer t;
+        return prod / f;
+    }
+}
 }
 
 #endif
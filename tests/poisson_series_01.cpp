@@ -53,6 +53,8 @@ see https://www.gnu.org/licenses/. */
 #include "../src/pow.hpp"
 #include "../src/real.hpp"
 #include "../src/series.hpp"
+#include "../src/settings.hpp"
+#include "../src/symbol_set.hpp"
 
 struct foo {
 };
@@ -464,6 +466,41 @@ BOOST_AUTO_TEST_CASE(poisson_series_evaluate_test)
     // BOOST_CHECK_EQUAL(tmp1 + tmp2,(s2 + s1).evaluate(dict));
 }
 
+BOOST_AUTO_TEST_CASE(poisson_series_evaluate_trig_table_test)
+{
+    // Large series, evaluated with real values via trigonometric tables.
+    using math::sin;
+    using math::cos;
+    using p_type = poisson_series<polynomial<rational, monomial<short>>>;
+    p_type x{"x"}, y{"y"}, z{"z"};
+    const auto s = math::pow(cos(x) + sin(y) * z + cos(x - 2 * y) + 1, 8);
+    BOOST_CHECK(s.size() > 100u);
+    const real vx(1.234), vy(-5.678), vz(.9);
+    const std::unordered_map<std::string, real> dict{{"x", vx}, {"y", vy}, {"z", vz}};
+    // Naive evaluation, term by term.
+    const symbol_set::positions_map<real> pmap(s.get_symbol_set(), dict);
+    real naive(0), abs_sum(0);
+    for (const auto &t : s._container()) {
+        const auto tmp = math::evaluate(t.m_cf, dict) * t.m_key.evaluate(pmap, s.get_symbol_set());
+        naive += tmp;
+        abs_sum += tmp.abs();
+    }
+    BOOST_CHECK((naive - math::pow(cos(vx) + sin(vy) * vz + cos(vx - 2 * vy) + 1, 8)).abs() < real(1E-30) * abs_sum);
+    // Each key is evaluated with an error of a few ulps.
+    BOOST_CHECK((s.evaluate(dict) - naive).abs() < real(1E-30) * abs_sum);
+    for (unsigned nt = 2u; nt <= 4u; ++nt) {
+        settings::set_n_threads(nt);
+        BOOST_CHECK((s.evaluate(dict) - naive).abs() < real(1E-30) * abs_sum);
+    }
+    settings::reset_n_threads();
+    // Exact types do not go through the tables.
+    p_type a{"a"}, b{"b"};
+    const auto s2 = math::pow(cos(a - b) + 1, 50);
+    BOOST_CHECK_EQUAL(
+        s2.evaluate(std::unordered_map<std::string, rational>{{"a", rational(1, 2)}, {"b", rational(1, 2)}}),
+        math::pow(rational(2), 50));
+}
+
 BOOST_AUTO_TEST_CASE(poisson_series_subs_test)
 {
     using math::sin;
@@ -210,6 +210,48 @@ BOOST_AUTO_TEST_CASE(polynomial_multiplier_test)
     boost::mpl::for_each<cf_types>(multiplication_tester());
 }
 
+struct adaptive_kronecker_tester {
+    template <typename Cf>
+    void operator()(const Cf &)
+    {
+        using p_type = polynomial<Cf, monomial<short>>;
+        using p_type_alt = polynomial_alt<Cf, short>;
+        // Many variables: the exponents of the result do not fit in the codes of k_monomial, but they
+        // fit in the codes of the adaptive packing.
+        p_type f{1};
+        for (int i = 0; i < 16; ++i) {
+            f += p_type{"x" + std::to_string(i)};
+        }
+        f = f.pow(3);
+        auto g = f - 2;
+        for (auto i = 1u; i <= 4u; ++i) {
+            settings::set_n_threads(i);
+            auto res = f * g;
+            BOOST_CHECK(res == p_type{p_type_alt(f) * p_type_alt(g)});
+            BOOST_CHECK_EQUAL(res.size(), 74597u);
+        }
+        settings::reset_n_threads();
+        // Negative exponents, one variable with a large range and cancellations.
+        p_type x{"x"}, y{"y"}, z{"z"}, t{"t"};
+        f = (x.pow(-3) + y * 3 / 2 + z.pow(1000) + 1).pow(10);
+        g = (x.pow(-3) - y * 3 / 2 + z.pow(-500) - 1).pow(10);
+        auto res = f * g;
+        BOOST_CHECK(res == p_type{p_type_alt(f) * p_type_alt(g)});
+        // Exponent ranges too large for the adaptive packing: fall back to the plain multiplication.
+        f = (x.pow(3000) + y.pow(3000) + z.pow(3000) + t.pow(3000) + x * y * z - 1).pow(8);
+        g = (x.pow(-3000) + y.pow(-3000) + z.pow(-3000) - t.pow(-3000) + x - 1).pow(8);
+        res = f * g;
+        BOOST_CHECK(res == p_type{p_type_alt(f) * p_type_alt(g)});
+        // Exponents out of bounds for short.
+        BOOST_CHECK_THROW(x.pow(20000) * x.pow(20000), std::overflow_error);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(polynomial_adaptive_kronecker_test)
+{
+    boost::mpl::for_each<cf_types>(adaptive_kronecker_tester());
+}
+
 BOOST_AUTO_TEST_CASE(polynomial_subs_test)
 {
     {
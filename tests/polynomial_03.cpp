@@ -33,7 +33,6 @@ see https://www.gnu.org/licenses/. */
 
 #include <boost/mpl/for_each.hpp>
 #include <boost/mpl/vector.hpp>
-#include <limits>
 #include <random>
 #include <stdexcept>
 #include <tuple>
@@ -45,6 +44,7 @@ see https://www.gnu.org/licenses/. */
 #include "../src/mp_integer.hpp"
 #include "../src/mp_rational.hpp"
 #include "../src/pow.hpp"
+#include "../src/settings.hpp"
 #include "../src/symbol.hpp"
 #include "../src/symbol_set.hpp"
 
@@ -181,6 +181,37 @@ struct udivrem_tester {
         res2 = pp_type::udivrem(xx - xx, x.pow(-1) * xx);
         BOOST_CHECK_EQUAL(res2.first.size(), 0u);
         BOOST_CHECK_EQUAL(res2.second.size(), 0u);
+        // Integral coefficients, sparse operands.
+        using pz_type = polynomial<integer, Key>;
+        pz_type z{"x"};
+        auto res3 = pz_type::udivrem(z.pow(250) + 1, z.pow(3) + 1);
+        BOOST_CHECK_EQUAL(res3.first * (z.pow(3) + 1) + res3.second, z.pow(250) + 1);
+        BOOST_CHECK_EQUAL(res3.second, 1 - z);
+        BOOST_CHECK_THROW(pz_type::udivrem(z.pow(250) + 1, 2 * z.pow(3) + 1), math::inexact_division);
+        BOOST_CHECK_THROW(pz_type::udivrem(z.pow(5) + 1, 2 * z.pow(3) + 1), math::inexact_division);
+        // Large dense operands, with multiple threads and several blocks in the dense kernel.
+        std::uniform_int_distribution<int> cd(-10, 10), dd(20, 200);
+        settings::set_min_work_per_thread(1u);
+        for (auto i = 0; i < ntrials / 10; ++i) {
+            const int deg_n = dd(rng), deg_d = dd(rng) / 2;
+            pz_type num = z - z, den = z.pow(deg_d) * (ud(rng) < 5 ? 1 : -1);
+            for (int j = 0; j <= deg_n; ++j) {
+                num += cd(rng) * z.pow(j);
+            }
+            for (int j = 0; j < deg_d; ++j) {
+                den += cd(rng) * z.pow(j);
+            }
+            settings::set_n_threads(1u);
+            const auto tmp1 = pz_type::udivrem(num, den);
+            settings::set_n_threads(4u);
+            const auto tmp4 = pz_type::udivrem(num, den);
+            BOOST_CHECK_EQUAL(num, den * tmp1.first + tmp1.second);
+            BOOST_CHECK(tmp1.second.size() == 0u || tmp1.second.degree() < deg_d);
+            BOOST_CHECK_EQUAL(tmp1.first, tmp4.first);
+            BOOST_CHECK_EQUAL(tmp1.second, tmp4.second);
+        }
+        settings::reset_n_threads();
+        settings::reset_min_work_per_thread();
     }
 };
 
@@ -310,102 +341,6 @@ BOOST_AUTO_TEST_CASE(polynomial_establish_limits_test)
     boost::mpl::for_each<key_types>(establish_limits_tester());
 }
 
-struct mapping_tester {
-    template <typename Key>
-    void operator()(const Key &)
-    {
-        using namespace piranha::detail;
-        using p_type = polynomial<integer, Key>;
-        using kp_type = polynomial<integer, k_monomial>;
-        // Start with some basic checks.
-        p_type x{"x"}, y{"y"}, z{"z"};
-        kp_type kx{"x"};
-        auto res = poly_to_univariate(2 * x, x * x);
-        BOOST_CHECK_EQUAL(std::get<0u>(res).size(), 1u);
-        BOOST_CHECK(std::get<0u>(res).get_symbol_set() == x.get_symbol_set());
-        BOOST_CHECK_EQUAL(std::get<0u>(res)._container().begin()->m_cf, 2);
-        BOOST_CHECK_EQUAL(std::get<0u>(res)._container().begin()->m_key.get_int(), 1);
-        BOOST_CHECK_EQUAL(std::get<1u>(res).size(), 1u);
-        BOOST_CHECK(std::get<1u>(res).get_symbol_set() == x.get_symbol_set());
-        BOOST_CHECK_EQUAL(std::get<1u>(res)._container().begin()->m_cf, 1);
-        BOOST_CHECK_EQUAL(std::get<1u>(res)._container().begin()->m_key.get_int(), 2);
-        BOOST_CHECK_EQUAL(std::get<2u>(res).size(), 2u);
-        BOOST_CHECK_EQUAL(std::get<2u>(res)[0u], 1);
-        BOOST_CHECK_EQUAL(std::get<2u>(res)[1u], 3);
-        // Decodification.
-        auto dres = poly_from_univariate<Key>(std::get<0u>(res), std::get<2u>(res), symbol_set({symbol{"x"}}));
-        BOOST_CHECK_EQUAL(dres, 2 * x);
-        // Check the throwing with negative powers.
-        BOOST_CHECK_THROW(poly_to_univariate(y, y.pow(-1)), std::invalid_argument);
-        // Another simple example to check by hand.
-        res = poly_to_univariate(2 * x * x + y * y, x * x * x - y);
-        BOOST_CHECK_EQUAL(std::get<2u>(res).size(), 3u);
-        BOOST_CHECK_EQUAL(std::get<2u>(res)[0u], 1);
-        BOOST_CHECK_EQUAL(std::get<2u>(res)[1u], 4);
-        BOOST_CHECK_EQUAL(std::get<2u>(res)[2u], 12);
-        BOOST_CHECK_EQUAL(std::get<0u>(res).size(), 2u);
-        BOOST_CHECK_EQUAL(std::get<0u>(res).get_symbol_set().size(), 1u);
-        BOOST_CHECK_EQUAL(*std::get<0u>(res).get_symbol_set().begin(), symbol("x"));
-        BOOST_CHECK_EQUAL(std::get<0u>(res), 2 * kx * kx + kx.pow(8));
-        BOOST_CHECK_EQUAL(std::get<1u>(res).size(), 2u);
-        BOOST_CHECK_EQUAL(std::get<1u>(res).get_symbol_set().size(), 1u);
-        BOOST_CHECK_EQUAL(*std::get<1u>(res).get_symbol_set().begin(), symbol("x"));
-        BOOST_CHECK_EQUAL(std::get<1u>(res), kx * kx * kx - kx.pow(4));
-        overflow_check(x, y);
-        dres = poly_from_univariate<Key>(std::get<0u>(res), std::get<2u>(res), symbol_set({symbol{"x"}, symbol{"y"}}));
-        BOOST_CHECK_EQUAL(dres, 2 * x * x + y * y);
-        // Random checking.
-        std::uniform_int_distribution<int> ud(0, 9);
-        for (int i = 0; i < ntrials; ++i) {
-            symbol_set ss({symbol{"x"}, symbol{"y"}, symbol{"z"}});
-            // Generate two random polys.
-            p_type n, d;
-            for (int j = 0; j < 10; ++j) {
-                n += x.pow(ud(rng)) * y.pow(ud(rng)) * z.pow(ud(rng));
-                d += x.pow(ud(rng)) * y.pow(ud(rng)) * z.pow(ud(rng));
-            }
-            // In these unlikely cases, skip the iteration.
-            if (n.get_symbol_set().size() != 3u || n.get_symbol_set() != d.get_symbol_set() || n.size() == 0u
-                || d.size() == 0u) {
-                continue;
-            }
-            res = poly_to_univariate(n, d);
-            BOOST_CHECK_EQUAL(std::get<0u>(res).size(), n.size());
-            BOOST_CHECK(std::get<0u>(res).get_symbol_set() == symbol_set({symbol{"x"}}));
-            BOOST_CHECK_EQUAL(std::get<1u>(res).size(), d.size());
-            BOOST_CHECK(std::get<1u>(res).get_symbol_set() == symbol_set({symbol{"x"}}));
-            BOOST_CHECK_EQUAL(std::get<2u>(res).size(), 4u);
-            dres = poly_from_univariate<Key>(std::get<0u>(res), std::get<2u>(res), ss);
-            BOOST_CHECK_EQUAL(dres, n);
-        }
-    }
-    template <
-        typename T,
-        typename std::enable_if<detail::is_mp_integer<typename T::term_type::key_type::value_type>::value, int>::type
-        = 0>
-    void overflow_check(const T &x, const T &y) const
-    {
-        BOOST_CHECK_THROW(poly_to_univariate(x.pow(std::numeric_limits<k_monomial::value_type>::max()), x),
-                          std::overflow_error);
-        BOOST_CHECK_THROW(poly_to_univariate(x.pow(std::numeric_limits<k_monomial::value_type>::max() / 2)
-                                                 + y.pow(std::numeric_limits<k_monomial::value_type>::max() / 2),
-                                             x + y),
-                          std::overflow_error);
-    }
-    template <
-        typename T,
-        typename std::enable_if<!detail::is_mp_integer<typename T::term_type::key_type::value_type>::value, int>::type
-        = 0>
-    void overflow_check(const T &, const T &) const
-    {
-    }
-};
-
-BOOST_AUTO_TEST_CASE(polynomial_mapping_test)
-{
-    boost::mpl::for_each<key_types>(mapping_tester());
-}
-
 struct univariate_gcdheu_tester {
     template <typename Key>
     void operator()(const Key &)
@@ -258,6 +258,49 @@ BOOST_AUTO_TEST_CASE(polynomial_division_recursive_test)
     }
 }
 
+struct sparse_division_tester {
+    template <typename Key>
+    void operator()(const Key &)
+    {
+        // Sparse operands with large exponents, whose dense codification does not fit in a machine word.
+        using p_type = polynomial<integer, Key>;
+        p_type x{"x"}, y{"y"}, z{"z"};
+        const auto a = x.pow(1ll << 40) + 3 * y.pow(1ll << 30) * z - 2, b = x * y - z.pow(1ll << 35) * x;
+        BOOST_CHECK_EQUAL((a * b) / b, a);
+        BOOST_CHECK_EQUAL((a * b) / a, b);
+        BOOST_CHECK_EQUAL((a * b * b) / (a * b), b);
+        BOOST_CHECK_THROW((a * b + x) / b, math::inexact_division);
+        BOOST_CHECK_THROW((a * b) / (2 * b), math::inexact_division);
+        BOOST_CHECK_THROW((a * b) / (b * z.pow(1ll << 36)), math::inexact_division);
+        BOOST_CHECK_THROW((a * b) / (b * y.pow(1ll << 41)), math::inexact_division);
+        // Random testing.
+        std::uniform_int_distribution<long long> edist(0, 1ll << 34);
+        std::uniform_int_distribution<int> dist(0, 9);
+        for (int i = 0; i < ntrials / 10; ++i) {
+            p_type n, m;
+            for (int j = 0; j < dist(rng); ++j) {
+                n += (dist(rng) - 4) * x.pow(edist(rng)) * y.pow(edist(rng)) * z.pow(edist(rng));
+            }
+            for (int j = 0; j < dist(rng); ++j) {
+                m += (dist(rng) - 4) * x.pow(edist(rng)) * y.pow(edist(rng)) * z.pow(edist(rng));
+            }
+            if (m.size() == 0u) {
+                BOOST_CHECK_THROW(n / m, zero_division_error);
+            } else {
+                BOOST_CHECK_EQUAL((n * m) / m, n);
+                if (n.size() != 0u) {
+                    BOOST_CHECK_EQUAL((n * m * n) / (m * n), n);
+                }
+            }
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(polynomial_division_sparse_test)
+{
+    boost::mpl::for_each<boost::mpl::vector<monomial<long long>, monomial<integer>>>(sparse_division_tester());
+}
+
 struct uprem_tester {
     template <typename Key>
     void operator()(const Key &)
@@ -709,6 +752,103 @@ BOOST_AUTO_TEST_CASE(polynomial_gcd_heu_test)
     g_checker(n, m, x);
 }
 
+struct gcd_modular_tester {
+    explicit gcd_modular_tester(polynomial_gcd_algorithm algo) : m_algo(algo)
+    {
+    }
+    template <typename Key>
+    void operator()(const Key &) const
+    {
+        using p_type = polynomial<integer, Key>;
+        using math::pow;
+        const auto algo = m_algo;
+        auto gcd_f = [algo](const p_type &a, const p_type &b) {
+            return std::get<0u>(p_type::gcd(a, b, false, algo));
+        };
+        auto gcd_check = [](const p_type &a, const p_type &b, const p_type &g) {
+            auto ret = std::get<0u>(p_type::gcd(a, b, false, polynomial_gcd_algorithm::prs_sr));
+            BOOST_CHECK(ret == g || ret == -g);
+        };
+        // Some zero tests.
+        BOOST_CHECK_EQUAL(gcd_f(p_type{}, p_type{}), 0);
+        p_type x{"x"}, y{"y"}, z{"z"}, t{"t"}, u{"u"};
+        BOOST_CHECK_EQUAL(gcd_f(x, p_type{}), x);
+        BOOST_CHECK_EQUAL(gcd_f(p_type{}, x), x);
+        BOOST_CHECK_EQUAL(gcd_f(x - x, y - y), 0);
+        BOOST_CHECK_EQUAL(gcd_f(x + y, y - y), x + y);
+        // Negative exponents.
+        BOOST_CHECK_THROW(gcd_f(x, x.pow(-1)), std::invalid_argument);
+        BOOST_CHECK_THROW(gcd_f(x + y, x.pow(-1)), std::invalid_argument);
+        BOOST_CHECK_THROW(gcd_f(y.pow(-1) + x, x + y), std::invalid_argument);
+        // Zerovariate and univariate tests.
+        BOOST_CHECK_EQUAL(gcd_f(p_type{12}, p_type{9}), 3);
+        BOOST_CHECK_EQUAL(gcd_f(p_type{0}, p_type{9}), 9);
+        BOOST_CHECK(gcd_f(6 * x * x - 6, 4 * x * x + 8 * x + 4) == 2 * x + 2
+                    || gcd_f(6 * x * x - 6, 4 * x * x + 8 * x + 4) == -2 * x - 2);
+        BOOST_CHECK(gcd_f(x.pow(10) - 1, x.pow(4) - 1) == x * x - 1 || gcd_f(x.pow(10) - 1, x.pow(4) - 1) == 1 - x * x);
+        // Contents and monomial GCDs.
+        BOOST_CHECK_EQUAL(gcd_f(16 * x.pow(4) * y * y * z * z, 14 * x.pow(5) * y.pow(3) * z * z
+                                                                  - 12 * x.pow(3) * y.pow(4) * z.pow(3)
+                                                                  - 7 * x * x * y.pow(4) * z.pow(3)),
+                          x * x * y * y * z * z);
+        BOOST_CHECK_EQUAL(gcd_f(6 * x * y + 6 * x, 4 * x * y + 4 * x), 2 * x * y + 2 * x);
+        // The test from the Geddes book.
+        auto a = -30 * x.pow(3) * y + 90 * x * x * y * y + 15 * x * x - 60 * x * y + 45 * y * y;
+        auto b = 100 * x * x * y - 140 * x * x - 250 * x * y * y + 350 * x * y - 150 * y * y * y + 210 * y * y;
+        BOOST_CHECK(gcd_f(a, b) == -15 * y + 5 * x || -gcd_f(a, b) == -15 * y + 5 * x);
+        // Random testing.
+        std::uniform_int_distribution<int> dist(0, 4);
+        for (int i = 0; i < ntrials / 3; ++i) {
+            auto n = rn_poly(x, y, z, dist), m = rn_poly(x, y, z, dist), r = rn_poly(x, y, z, dist);
+            auto tup_res = p_type::gcd(n * r, m * n, true, algo);
+            const auto &g = std::get<0u>(tup_res);
+            gcd_check(n * r, m * n, g);
+            if (math::is_zero(m * n)) {
+                BOOST_CHECK_EQUAL(g, n * r);
+            } else if (math::is_zero(n * r)) {
+                BOOST_CHECK_EQUAL(g, m * n);
+            } else {
+                BOOST_CHECK_EQUAL((n * r) / g, std::get<1u>(tup_res));
+                BOOST_CHECK_EQUAL((m * n) / g, std::get<2u>(tup_res));
+            }
+        }
+        // The test slow with PRS_SR.
+        auto n = 9 * x * pow(y, 8) + 5 * x * x * pow(y, 9) * pow(z, 7) + 9 * pow(x, 3) * pow(z, 3)
+                 + 5 * pow(x, 6) * pow(y, 8) * pow(z, 8) - 8 * pow(x, 8) * y * y * pow(z, 7)
+                 - 8 * pow(x, 7) * pow(y, 7) * pow(z, 5) - 8 * pow(x, 9) * pow(y, 7) * pow(z, 5);
+        auto m = 5 * pow(x, 6) * pow(y, 5) * pow(z, 6) + 9 * pow(x, 4) * pow(y, 3) * pow(z, 8)
+                 + pow(x, 5) * pow(y, 5) * pow(z, 8) - 8 * pow(x, 9) * y * pow(z, 3)
+                 - 2 * pow(x, 5) * pow(y, 8) * pow(z, 5) - 2 * pow(x, 7) * pow(y, 9) * pow(z, 2)
+                 + 5 * pow(x, 9) * pow(y, 4) * pow(z, 9) - 8 * pow(x, 5) * pow(y, 7) * pow(z, 5);
+        BOOST_CHECK(gcd_f(n, m) == x || gcd_f(n, m) == -x);
+        // Sparse GCDs in several variables, with large coefficients.
+        auto f = pow(1 + x + y * y + z * z * z + t.pow(4) + u.pow(5), 3) * 123456789123456789_z;
+        auto g1 = f * (f + 2 * x * y - 1), g2 = f * (f - 3 * t * u);
+        auto res = p_type::gcd(g1, g2, true, algo);
+        BOOST_CHECK(std::get<0u>(res) == f || std::get<0u>(res) == -f);
+        BOOST_CHECK_EQUAL(std::get<0u>(res) * std::get<1u>(res), g1);
+        BOOST_CHECK_EQUAL(std::get<0u>(res) * std::get<2u>(res), g2);
+        // A GCD whose leading coefficient is not a monomial.
+        auto h = (y + z) * x * x + t * x + u;
+        res = p_type::gcd(h * (x + y + 1), h * (x * z - t + 2), true, algo);
+        BOOST_CHECK(std::get<0u>(res) == h || std::get<0u>(res) == -h);
+    }
+    polynomial_gcd_algorithm m_algo;
+};
+
+BOOST_AUTO_TEST_CASE(polynomial_gcd_modular_test)
+{
+    boost::mpl::for_each<key_types>(gcd_modular_tester(polynomial_gcd_algorithm::brown));
+    boost::mpl::for_each<key_types>(gcd_modular_tester(polynomial_gcd_algorithm::zippel));
+    boost::mpl::for_each<key_types>(gcd_modular_tester(polynomial_gcd_algorithm::automatic));
+    // The modular algorithms require integral coefficients.
+    using pq_type = polynomial<polynomial<integer, k_monomial>, k_monomial>;
+    pq_type x{"x"}, y{"y"};
+    BOOST_CHECK_THROW(pq_type::gcd(x + y, x - y, false, polynomial_gcd_algorithm::brown), std::runtime_error);
+    BOOST_CHECK_THROW(pq_type::gcd(x + y, x - y, false, polynomial_gcd_algorithm::zippel), std::runtime_error);
+    BOOST_CHECK_EQUAL(std::get<0u>(pq_type::gcd(x * y, x * x, false, polynomial_gcd_algorithm::automatic)), x);
+}
+
 BOOST_AUTO_TEST_CASE(polynomial_height_test)
 {
     {
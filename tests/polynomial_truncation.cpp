@@ -211,3 +211,223 @@ BOOST_AUTO_TEST_CASE(polynomial_truncation_recursive_test)
     BOOST_CHECK(x * x * x * x * x * y * z == 0);
     p1::unset_auto_truncate_degree();
 }
+
+BOOST_AUTO_TEST_CASE(polynomial_truncation_compose_test)
+{
+    using p_type = polynomial<rational, monomial<int>>;
+    using pk_type = polynomial<integer, k_monomial>;
+    using pr_type = polynomial<rational, monomial<rational>>;
+    BOOST_CHECK((std::is_same<p_type, decltype(math::compose(p_type{}, "x", p_type{}))>::value));
+    BOOST_CHECK((std::is_same<pk_type, decltype(math::compose(pk_type{}, "x", pk_type{}))>::value));
+    BOOST_CHECK((std::is_same<pr_type, decltype(math::compose(pr_type{}, "x", pr_type{}))>::value));
+    for (unsigned nt = 1u; nt <= 3u; ++nt) {
+        settings::set_n_threads(nt);
+        p_type x{"x"}, y{"y"}, z{"z"};
+        const auto f = math::pow(1 + x + y - z, 12) + 3 * x * z - x * x * x / 7;
+        const auto g = 1 + y + z * z / 2 + x * y;
+        // Without truncation, compose() is the same as subs().
+        BOOST_CHECK_EQUAL(f.compose("x", g), f.subs("x", g));
+        BOOST_CHECK_EQUAL(math::compose(f, "x", g), f.subs("x", g));
+        // Total degree truncation.
+        for (int d = 0; d < 10; ++d) {
+            p_type::set_auto_truncate_degree(d);
+            BOOST_CHECK_EQUAL(math::compose(f, "x", g), f.subs("x", g));
+            BOOST_CHECK_EQUAL(math::compose(f, "y", g - y), f.subs("y", g - y));
+            BOOST_CHECK_EQUAL(math::compose(f, "z", p_type{4}), f.subs("z", p_type{4}));
+            BOOST_CHECK_EQUAL(math::compose(x, "x", g), g.truncate_degree(d));
+            BOOST_CHECK_EQUAL(math::compose(p_type{}, "x", g), 0);
+            // Absent variable.
+            BOOST_CHECK_EQUAL(math::compose(f, "t", g), f.subs("t", g));
+        }
+        // Partial degree truncation.
+        for (int d = 0; d < 10; ++d) {
+            p_type::set_auto_truncate_degree(d, {"x", "z"});
+            BOOST_CHECK_EQUAL(math::compose(f, "x", g), f.subs("x", g));
+            BOOST_CHECK_EQUAL(math::compose(f, "y", g), f.subs("y", g));
+        }
+        // Negative exponents: fall back to subs().
+        p_type::set_auto_truncate_degree(4);
+        const auto fn = f + z * math::pow(x, -1);
+        BOOST_CHECK_EQUAL(math::compose(fn, "x", 2 * z), fn.subs("x", 2 * z));
+        BOOST_CHECK_EQUAL(math::compose(fn, "x", 2 * z), f.subs("x", 2 * z) + rational(1, 2));
+        // Composition with a larger polynomial, and multivariate block coefficients.
+        p_type::set_auto_truncate_degree(15, {"x", "y"});
+        const auto h = math::pow(1 + x + y + z, 20);
+        BOOST_CHECK_EQUAL(math::compose(h, "x", x * y - y * y + z), h.subs("x", x * y - y * y + z));
+        pk_type a{"a"}, b{"b"};
+        pk_type::set_auto_truncate_degree(9);
+        const auto fk = math::pow(a - b + 2, 15);
+        BOOST_CHECK_EQUAL(math::compose(fk, "a", a * a - b), fk.subs("a", a * a - b));
+        pk_type::unset_auto_truncate_degree();
+        // Rational exponents: fall back to subs() in presence of non-integral exponents.
+        pr_type r{"r"}, s{"s"};
+        pr_type::set_auto_truncate_degree(rational(7, 2));
+        const auto fr = math::pow(r + s + 1, 5);
+        BOOST_CHECK_EQUAL(math::compose(fr, "r", s * s + 1), fr.subs("r", s * s + 1));
+        BOOST_CHECK_EQUAL(math::compose(fr + math::pow(r, rational(1, 2)), "r", s * s),
+                          fr.subs("r", s * s) + s);
+        pr_type::unset_auto_truncate_degree();
+        p_type::unset_auto_truncate_degree();
+    }
+    settings::reset_n_threads();
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_truncation_newton_test)
+{
+    using p_type = polynomial<rational, monomial<int>>;
+    using pk_type = polynomial<integer, k_monomial>;
+    for (unsigned nt = 1u; nt <= 3u; ++nt) {
+        settings::set_n_threads(nt);
+        p_type x{"x"}, y{"y"}, z{"z"};
+        const auto f = 1 + x - y / 2 + x * z + 3 * y * y;
+        // Without truncation, the usual restrictions apply.
+        BOOST_CHECK_THROW(f.pow(-1), std::invalid_argument);
+        BOOST_CHECK_THROW(f.pow(1 / 2_q), std::invalid_argument);
+        // Total degree truncation.
+        for (int d = 0; d < 12; ++d) {
+            p_type::set_auto_truncate_degree(d);
+            const auto fi = f.pow(-1);
+            BOOST_CHECK_EQUAL(p_type::truncated_multiplication(fi, f, d), 1);
+            BOOST_CHECK_EQUAL(math::invert(f), fi);
+            BOOST_CHECK_EQUAL((1 - x).pow(-1), (1 - math::pow(x, d + 1)) / (1 - x) * 1);
+            const auto s = f.pow(1 / 2_q);
+            BOOST_CHECK_EQUAL(s * s, f.truncate_degree(d));
+            BOOST_CHECK_EQUAL(f.pow(3 / 2_q), f * s);
+            BOOST_CHECK_EQUAL(f.pow(-1 / 2_q) * s, 1);
+            const auto r = f.pow(-2 / 3_q);
+            BOOST_CHECK_EQUAL(r * r * r * f * f, 1);
+            BOOST_CHECK_EQUAL(f.pow(-3), fi * fi * fi);
+            const auto t = f.pow(7 / 3_q);
+            BOOST_CHECK_EQUAL(t * t * t, math::pow(f, 7));
+            // Roots of the constant term are computed via math::pow().
+            BOOST_CHECK_THROW((4 * f).pow(1 / 2_q), std::invalid_argument);
+            BOOST_CHECK_EQUAL((2 * f).pow(-1), fi / 2);
+        }
+        p_type::set_auto_truncate_degree(-1);
+        BOOST_CHECK_EQUAL(f.pow(-1), 0);
+        // Partial degree truncation.
+        for (int d = 0; d < 12; ++d) {
+            p_type::set_auto_truncate_degree(d, {"x", "z"});
+            const auto g = 1 + x * y - z + 2 * x * x;
+            const auto gi = g.pow(-1);
+            BOOST_CHECK_EQUAL(gi * g, 1);
+            const auto s = g.pow(1 / 2_q);
+            BOOST_CHECK_EQUAL(s * s, g.truncate_degree(d, {"x", "z"}));
+            // The constant part with respect to x and z is not a constant.
+            BOOST_CHECK_THROW((g + y).pow(-1), std::invalid_argument);
+        }
+        // Unsupported cases fall back to the default implementation.
+        p_type::set_auto_truncate_degree(5);
+        BOOST_CHECK_THROW((x + y).pow(-1), std::invalid_argument);
+        BOOST_CHECK_THROW((f + math::pow(x, -1)).pow(-1), std::invalid_argument);
+        BOOST_CHECK_THROW((2 + x).pow(1 / 2_q), std::invalid_argument);
+        BOOST_CHECK_EQUAL(f.pow(2), (f * f).truncate_degree(5));
+        p_type::unset_auto_truncate_degree();
+        // Integral coefficients: only inversion with unitary constant term.
+        pk_type a{"a"}, b{"b"};
+        pk_type::set_auto_truncate_degree(6);
+        pk_type geo;
+        for (int k = 0; k <= 6; ++k) {
+            geo += math::pow(a + b, k);
+        }
+        BOOST_CHECK_EQUAL((1 - a - b).pow(-1), geo);
+        BOOST_CHECK_EQUAL((a + b - 1).pow(-1), -geo);
+        BOOST_CHECK_EQUAL(math::invert(1 - a - b), geo);
+        BOOST_CHECK_THROW((2 - a).pow(-1), std::invalid_argument);
+        BOOST_CHECK_THROW((1 - a).pow(1 / 2_q), std::invalid_argument);
+        pk_type::unset_auto_truncate_degree();
+    }
+    settings::reset_n_threads();
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_truncation_elementary_test)
+{
+    using p_type = polynomial<rational, monomial<int>>;
+    using pk_type = polynomial<integer, k_monomial>;
+    using pd_type = polynomial<double, k_monomial>;
+    for (unsigned nt = 1u; nt <= 3u; ++nt) {
+        settings::set_n_threads(nt);
+        p_type x{"x"}, y{"y"}, z{"z"};
+        const auto f = x - y / 2 + x * z + 3 * y * y;
+        // Without truncation, only single-coefficient series are supported.
+        BOOST_CHECK_THROW(math::exp(f), std::invalid_argument);
+        BOOST_CHECK_THROW(math::sin(f), std::invalid_argument);
+        BOOST_CHECK_EQUAL(math::exp(p_type{0}), 1);
+        BOOST_CHECK_EQUAL(math::cos(p_type{0}), 1);
+        BOOST_CHECK_THROW(math::log(p_type{2}), std::invalid_argument);
+        // Total degree truncation.
+        for (int d = 0; d < 10; ++d) {
+            p_type::set_auto_truncate_degree(d);
+            // Reference values from the Taylor expansions.
+            p_type e_ref, l_ref, s_ref, c_ref, fk{1};
+            integer fact(1);
+            for (int k = 0; k <= d; ++k) {
+                if (k) {
+                    fact *= k;
+                    l_ref += ((k % 2) ? 1 : -1) * fk / k;
+                }
+                e_ref += fk / fact;
+                if (k % 2) {
+                    s_ref += ((k % 4 == 1) ? 1 : -1) * fk / fact;
+                } else {
+                    c_ref += ((k % 4 == 0) ? 1 : -1) * fk / fact;
+                }
+                fk *= f;
+            }
+            const auto e = math::exp(f);
+            BOOST_CHECK_EQUAL(e, e_ref);
+            BOOST_CHECK_EQUAL(math::log(1 + f), l_ref);
+            BOOST_CHECK_EQUAL(math::sin(f), s_ref);
+            BOOST_CHECK_EQUAL(math::cos(f), c_ref);
+            BOOST_CHECK_EQUAL(math::log(e), f.truncate_degree(d));
+            BOOST_CHECK_EQUAL(math::exp(-f) * e, 1);
+            BOOST_CHECK_EQUAL(math::sin(f) * math::sin(f) + math::cos(f) * math::cos(f), 1);
+            BOOST_CHECK_EQUAL(math::log((1 + f) * (1 - f)), math::log(1 + f) + math::log(1 - f));
+            BOOST_CHECK_EQUAL(math::log(math::invert(1 + f)), -l_ref);
+            BOOST_CHECK_THROW(math::log(2 * (1 + f)), std::invalid_argument);
+            BOOST_CHECK_THROW(math::log(f), zero_division_error);
+        }
+        p_type::set_auto_truncate_degree(-1);
+        BOOST_CHECK_EQUAL(math::exp(f), 0);
+        BOOST_CHECK(math::exp(f).get_symbol_set() == f.get_symbol_set());
+        // Partial degree truncation.
+        for (int d = 0; d < 8; ++d) {
+            p_type::set_auto_truncate_degree(d, {"x", "z"});
+            const auto g = x * y - z + 2 * x * x * y;
+            BOOST_CHECK_EQUAL(math::exp(g) * math::exp(-g), 1);
+            BOOST_CHECK_EQUAL(math::log(math::exp(g)), g.truncate_degree(d, {"x", "z"}));
+            BOOST_CHECK_EQUAL(math::exp(2 * g), math::exp(g) * math::exp(g));
+            BOOST_CHECK_EQUAL(math::sin(2 * g), 2 * math::sin(g) * math::cos(g));
+            // The constant part with respect to x and z is not a constant.
+            BOOST_CHECK_THROW(math::exp(g + y), std::invalid_argument);
+        }
+        // Negative degrees are not supported.
+        p_type::set_auto_truncate_degree(5);
+        BOOST_CHECK_THROW(math::exp(f + math::pow(x, -1)), std::invalid_argument);
+        p_type::unset_auto_truncate_degree();
+        // Floating-point coefficients and non-zero constant terms.
+        pd_type a{"a"}, b{"b"};
+        pd_type::set_auto_truncate_degree(8);
+        const auto h = 1. + a - 2. * b;
+        const auto id = math::exp(math::log(h)) - h;
+        for (const auto &t : id._container()) {
+            BOOST_CHECK(std::abs(t.m_cf) < 1E-12);
+        }
+        const auto ee = math::exp(h) - math::exp(1.) * math::exp(a - 2. * b);
+        for (const auto &t : ee._container()) {
+            BOOST_CHECK(std::abs(t.m_cf) < 1E-12);
+        }
+        const auto sc = math::sin(h) * math::sin(h) + math::cos(h) * math::cos(h) - 1.;
+        for (const auto &t : sc._container()) {
+            BOOST_CHECK(std::abs(t.m_cf) < 1E-12);
+        }
+        pd_type::unset_auto_truncate_degree();
+        // With integral coefficients, only single-coefficient series are supported.
+        pk_type c{"c"};
+        pk_type::set_auto_truncate_degree(4);
+        BOOST_CHECK_THROW(math::exp(c), std::invalid_argument);
+        BOOST_CHECK_EQUAL(math::cos(pk_type{0}), 1);
+        pk_type::unset_auto_truncate_degree();
+    }
+    settings::reset_n_threads();
+}
@@ -0,0 +1,102 @@
+/* Copyright 2009-2016 Francesco Biscani (bluescarni@gmail.com)
+
+This file is part of the Piranha library.
+
+The Piranha library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The Piranha library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the Piranha library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include "../src/lazy_rational_function.hpp"
+
+#define BOOST_TEST_MODULE rational_function_sum_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/timer/timer.hpp>
+#include <iostream>
+
+#include "../src/init.hpp"
+#include "../src/kronecker_monomial.hpp"
+#include "../src/rational_function.hpp"
+#include "../src/settings.hpp"
+
+using namespace piranha;
+
+using r_type = rational_function<k_monomial>;
+using l_type = lazy_rational_function<k_monomial>;
+using p_type = r_type::p_type;
+
+// Sum of (x - i*z) / (x + i*y + i**2*z), for i in [1, n]. The denominators are pairwise coprime,
+// so the eager rational function computes a GCD of growing size at every step.
+template <typename R>
+static inline R rf_sum(int n)
+{
+    p_type x{"x"}, y{"y"}, z{"z"};
+    R retval;
+    boost::timer::auto_cpu_timer t;
+    for (int i = 1; i <= n; ++i) {
+        retval += (x - i * z) / R{x + i * y + i * i * z};
+    }
+    return retval;
+}
+
+// Telescoping chain of products and cancelling sums: the final result is (x + y) / (x + (n + 1)*y).
+template <typename R>
+static inline R rf_chain(int n)
+{
+    p_type x{"x"}, y{"y"};
+    R retval{1};
+    boost::timer::auto_cpu_timer t;
+    for (int i = 1; i <= n; ++i) {
+        retval *= (x + i * y) / R{x + (i + 1) * y};
+        retval += R{1} / (x - y);
+        retval -= R{1} / (x - y);
+    }
+    return retval;
+}
+
+BOOST_AUTO_TEST_CASE(rational_function_sum_test)
+{
+    init();
+    if (boost::unit_test::framework::master_test_suite().argc > 1) {
+        settings::set_n_threads(
+            boost::lexical_cast<unsigned>(boost::unit_test::framework::master_test_suite().argv[1u]));
+    }
+    std::cout << "Eager sum:\n";
+    const auto r = rf_sum<r_type>(40);
+    std::cout << "Lazy sum:\n";
+    const auto l = rf_sum<l_type>(40);
+    BOOST_CHECK_EQUAL(l.get(), r);
+    BOOST_CHECK_EQUAL(r.den().size(), 861u);
+}
+
+BOOST_AUTO_TEST_CASE(rational_function_chain_test)
+{
+    std::cout << "Eager chain:\n";
+    const auto r = rf_chain<r_type>(200);
+    std::cout << "Lazy chain:\n";
+    const auto l = rf_chain<l_type>(200);
+    BOOST_CHECK_EQUAL(l.get(), r);
+    p_type x{"x"}, y{"y"};
+    BOOST_CHECK_EQUAL(r, (r_type{x + y, x + 201 * y}));
+}
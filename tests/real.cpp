@@ -1846,6 +1846,15 @@ BOOST_AUTO_TEST_CASE(real_sin_cos_test)
     BOOST_CHECK_EQUAL((real{0}).sin().get_prec(), real::default_prec);
 }
 
+BOOST_AUTO_TEST_CASE(real_exp_log_test)
+{
+    BOOST_CHECK_EQUAL(math::exp(real{0, 4}), 1);
+    BOOST_CHECK_EQUAL((real{1, 4}.log()), 0);
+    BOOST_CHECK_EQUAL(math::log(real{1, 4}), 0);
+    BOOST_CHECK_EQUAL(math::log(real{1, 4}).get_prec(), 4);
+    BOOST_CHECK_EQUAL(math::log(math::exp(real{2})), 2);
+}
+
 BOOST_AUTO_TEST_CASE(real_truncate_test)
 {
     real r{"inf"};
@@ -46,8 +46,11 @@ see https://www.gnu.org/licenses/. */
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "../src/detail/grouped_subs.hpp"
+#include "../src/detail/power_table.hpp"
 #include "../src/init.hpp"
 #include "../src/key_is_convertible.hpp"
 #include "../src/key_is_multipliable.hpp"
@@ -1088,6 +1091,66 @@ BOOST_AUTO_TEST_CASE(rtkm_evaluate_test)
     BOOST_CHECK((!key_is_evaluable<real_trigonometric_kronecker_monomial<>, void *>::value));
 }
 
+struct trig_table_evaluate_tester {
+    template <typename T>
+    void operator()(const T &)
+    {
+        using k_type = real_trigonometric_kronecker_monomial<T>;
+        using bounds_type = std::vector<std::pair<T, T>>;
+        BOOST_CHECK((detail::key_has_trig_table_evaluate<k_type, real>::value));
+        BOOST_CHECK((!detail::key_has_trig_table_evaluate<k_type, double>::value));
+        BOOST_CHECK((!detail::key_has_trig_table_evaluate<k_type, integer>::value));
+        BOOST_CHECK((!detail::key_has_trig_table_evaluate<k_type, rational>::value));
+        BOOST_CHECK((!detail::key_has_power_table_evaluate<k_type, real>::value));
+        BOOST_CHECK((!detail::key_has_trig_table_evaluate<monomial<T>, real>::value));
+        // NOTE: keep the multipliers small, in order to be able to encode them in the signed char case.
+        const symbol_set vs{symbol("x"), symbol("y")};
+        const std::unordered_map<symbol, real> dict{{symbol("x"), real(1.5)}, {symbol("y"), real(-3)}};
+        const symbol_set::positions_map<real> pmap(vs, dict);
+        // Bounds.
+        bounds_type bounds;
+        k_type k1({T(1), T(-2)}), k2({T(-3), T(0)}), k3({T(2), T(2)});
+        k1.update_multiplier_bounds(bounds, vs);
+        BOOST_CHECK((bounds == bounds_type{{T(1), T(1)}, {T(-2), T(-2)}}));
+        k2.update_multiplier_bounds(bounds, vs);
+        BOOST_CHECK((bounds == bounds_type{{T(-3), T(1)}, {T(-2), T(0)}}));
+        k3.update_multiplier_bounds(bounds, vs);
+        BOOST_CHECK((bounds == bounds_type{{T(-3), T(2)}, {T(-2), T(2)}}));
+        BOOST_CHECK_THROW(k1.update_multiplier_bounds(bounds, symbol_set{}), std::invalid_argument);
+        BOOST_CHECK_THROW(k1.update_multiplier_bounds(bounds, symbol_set{symbol("x")}), std::invalid_argument);
+        // Evaluation.
+        const detail::trig_table<real, T> table(pmap, bounds);
+        BOOST_CHECK_EQUAL(table.size(), 2u);
+        BOOST_CHECK_EQUAL(table(0u, T(0)).first, 1);
+        BOOST_CHECK_EQUAL(table(0u, T(0)).second, 0);
+        BOOST_CHECK_EQUAL(table(1u, T(2)).first, math::cos(real(-3) * T(2)));
+        BOOST_CHECK_EQUAL(table(1u, T(2)).second, math::sin(real(-3) * T(2)));
+        // The angle addition formulae introduce rounding errors of a few ulps.
+        const real tol = real(1E-30);
+        for (const auto &k : {k1, k2, k3}) {
+            for (const bool f : {true, false}) {
+                auto tmp(k);
+                tmp.set_flavour(f);
+                BOOST_CHECK((tmp.evaluate(table, vs) - tmp.evaluate(pmap, vs)).abs() < tol);
+            }
+        }
+        k_type k4({T(0), T(0)});
+        BOOST_CHECK_EQUAL(k4.evaluate(table, vs), 1);
+        k4.set_flavour(false);
+        BOOST_CHECK_EQUAL(k4.evaluate(table, vs), 0);
+        BOOST_CHECK_THROW(k1.evaluate(table, symbol_set{symbol("x")}), std::invalid_argument);
+        BOOST_CHECK((std::is_same<real, decltype(k1.evaluate(table, vs))>::value));
+        // Construction from an invalid positions map.
+        const symbol_set::positions_map<real> empty_pmap(vs, std::unordered_map<symbol, real>{});
+        BOOST_CHECK_THROW((detail::trig_table<real, T>(empty_pmap, bounds)), std::invalid_argument);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(rtkm_trig_table_evaluate_test)
+{
+    boost::mpl::for_each<int_types>(trig_table_evaluate_tester());
+}
+
 struct subs_tester {
     template <typename T>
     void operator()(const T &)
@@ -1226,6 +1289,22 @@ struct subs_tester {
         BOOST_CHECK((ret2[1u].second == tmp));
         tmp.set_flavour(true);
         BOOST_CHECK((ret2[0u].second == tmp));
+        // Splitting.
+        BOOST_CHECK(detail::key_has_subs_split<k_type>::value);
+        auto sp = k1.subs_split("x", vs);
+        BOOST_CHECK((sp.first == std::make_tuple(T(0), false, true)));
+        BOOST_CHECK((sp.second[0u] == ret2[0u].second));
+        BOOST_CHECK((sp.second[1u] == ret2[1u].second));
+        k1 = k_type({T(2), T(-1), T(1)});
+        sp = k1.subs_split("y", vs);
+        BOOST_CHECK((sp.first == std::make_tuple(T(-1), true, false)));
+        tmp = k_type({T(2), T(0), T(1)});
+        BOOST_CHECK((sp.second[0u] == tmp));
+        tmp.set_flavour(false);
+        BOOST_CHECK((sp.second[1u] == tmp));
+        sp = k1.subs_split("t", vs);
+        BOOST_CHECK((sp.first == std::make_tuple(T(0), true, false)));
+        BOOST_CHECK((sp.second[0u] == k1));
     }
 };
 
@@ -58,6 +58,7 @@ see https://www.gnu.org/licenses/. */
 #include "../src/real.hpp"
 #include "../src/serialization.hpp"
 #include "../src/series_multiplier.hpp"
+#include "../src/settings.hpp"
 #include "../src/symbol.hpp"
 #include "../src/symbol_set.hpp"
 #include "../src/type_traits.hpp"
@@ -477,6 +478,76 @@ BOOST_AUTO_TEST_CASE(series_evaluate_test)
     BOOST_CHECK_EQUAL(math::evaluate<double>(p_type1{}, {{"foo", 4.}, {"bar", 7}}), 0);
 }
 
+BOOST_AUTO_TEST_CASE(series_evaluate_mt_test)
+{
+    // Large series, evaluated with and without threads. The exponents span a small range, so that
+    // the evaluation goes through the power tables.
+    using p_type = g_series_type<rational, int>;
+    using term_type = p_type::term_type;
+    using key_type = term_type::key_type;
+    p_type p;
+    p.set_symbol_set(symbol_set{symbol("x"), symbol("y"), symbol("z")});
+    for (int i = -10; i < 20; ++i) {
+        for (int j = -10; j < 20; ++j) {
+            for (int k = -10; k < 20; ++k) {
+                p.insert(term_type(rational(i + j + 31, k + 11), key_type{i, j, k}));
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(p.size(), 27000u);
+    const std::unordered_map<std::string, rational> dict{
+        {"x", rational(-3, 2)}, {"y", rational(5, 7)}, {"z", rational(1, 3)}};
+    // Naive evaluation, term by term.
+    const symbol_set::positions_map<rational> pmap(p.get_symbol_set(), {{symbol("x"), dict.at("x")},
+                                                                         {symbol("y"), dict.at("y")},
+                                                                         {symbol("z"), dict.at("z")}});
+    rational naive(0);
+    for (const auto &t : p._container()) {
+        naive += t.m_cf * t.m_key.evaluate(pmap, p.get_symbol_set());
+    }
+    BOOST_CHECK_EQUAL(p.evaluate(dict), naive);
+    for (unsigned nt = 2u; nt <= 4u; ++nt) {
+        settings::set_n_threads(nt);
+        BOOST_CHECK_EQUAL(p.evaluate(dict), naive);
+    }
+    settings::reset_n_threads();
+    // Exponents spanning a range too large for the tables.
+    p.insert(term_type(rational(1), key_type{100000, 0, 0}));
+    naive += math::pow(dict.at("x"), 100000);
+    BOOST_CHECK_EQUAL(p.evaluate(dict), naive);
+    // Compensated summation of floating-point coefficients.
+    using p_type2 = g_series_type<double, int>;
+    p_type2 x{"x"}, y{"y"}, z{"z"};
+    const auto q = 1E16 * x + z - 1E16 * y;
+    BOOST_CHECK_EQUAL(q.evaluate(std::unordered_map<std::string, double>{{"x", 1.}, {"y", 1.}, {"z", 1.}}), 1.);
+}
+
+BOOST_AUTO_TEST_CASE(series_evaluate_symbol_test)
+{
+    // Evaluation with maps of symbols.
+    using p_type = g_series_type<rational, int>;
+    using dict_type = std::unordered_map<symbol, rational>;
+    p_type x{"x"}, y{"y"};
+    const symbol sx("x"), sy("y"), sz("z");
+    BOOST_CHECK((std::is_same<rational, decltype(p_type{}.evaluate(dict_type{}))>::value));
+    BOOST_CHECK((std::is_same<double, decltype(p_type{}.evaluate(std::unordered_map<symbol, double>{}))>::value));
+    BOOST_CHECK_EQUAL(p_type{}.evaluate(dict_type{}), 0);
+    BOOST_CHECK_THROW(x.evaluate(dict_type{}), std::invalid_argument);
+    BOOST_CHECK_THROW((x + (2 * y).pow(3)).evaluate(dict_type{{sx, rational(1)}}), std::invalid_argument);
+    BOOST_CHECK_THROW((x + (2 * y).pow(3)).evaluate(dict_type{{sy, rational(1)}}), std::invalid_argument);
+    const auto p = (x + 3 * y - 1).pow(4);
+    BOOST_CHECK_EQUAL(p.evaluate(dict_type{{sx, rational(1, 2)}, {sy, rational(-2, 3)}, {sz, rational(5)}}),
+                      p.evaluate(std::unordered_map<std::string, rational>{{"x", rational(1, 2)},
+                                                                           {"y", rational(-2, 3)}}));
+    BOOST_CHECK_EQUAL(p.evaluate(std::unordered_map<symbol, double>{{sx, 1.}, {sy, 0.}}), 0.);
+    // Series coefficients.
+    using p_type2 = g_series_type<p_type, int>;
+    const auto q = p_type2{"z"} * x - y;
+    BOOST_CHECK_EQUAL(q.evaluate(dict_type{{sx, rational(3)}, {sy, rational(2)}, {sz, rational(1, 2)}}),
+                      rational(-1, 2));
+    BOOST_CHECK_THROW(q.evaluate(dict_type{{sx, rational(3)}, {sz, rational(1, 2)}}), std::invalid_argument);
+}
+
 template <typename Expo>
 class g_series_type_nr : public series<float, monomial<Expo>, g_series_type_nr<Expo>>
 {
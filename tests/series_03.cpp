@@ -35,13 +35,19 @@ see https://www.gnu.org/licenses/. */
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../src/forwarding.hpp"
 #include "../src/init.hpp"
+#include "../src/kronecker_monomial.hpp"
 #include "../src/invert.hpp"
+#include "../src/math.hpp"
 #include "../src/monomial.hpp"
+#include "../src/mp_integer.hpp"
 #include "../src/polynomial.hpp"
 #include "../src/serialization.hpp"
+#include "../src/settings.hpp"
 #include "../src/symbol.hpp"
 #include "../src/symbol_set.hpp"
 
@@ -329,6 +335,43 @@ BOOST_AUTO_TEST_CASE(series_extend_symbol_set_test)
     BOOST_CHECK((symbol_set{symbol{"y"}, symbol{"x"}, symbol{"z"}} == foo.get_symbol_set()));
 }
 
+// Large series, so that the parallel merging of the arguments kicks in.
+template <typename p_type>
+inline void merge_arguments_tester()
+{
+    p_type a{"a"}, b{"b"}, c{"c"}, d{"d"}, e{"e"}, z{"z"}, A{"A"}, bb{"bb"};
+    const auto p0 = math::pow(a + b + c + d + e + 1, 17);
+    BOOST_CHECK_EQUAL(p0.size(), 26334u);
+    std::vector<p_type> res;
+    for (unsigned nt : {1u, 4u}) {
+        settings::set_n_threads(nt);
+        // New symbols at the end, at the beginning and in the middle.
+        for (const auto &s : {z, A, bb, z * A * bb}) {
+            auto p1 = p0 + s;
+            BOOST_CHECK_EQUAL(p1.size(), p0.size() + 1u);
+            BOOST_CHECK(p1 - s == p0);
+            res.push_back(std::move(p1));
+            // Rvalue operands.
+            auto p2 = p0;
+            res.push_back(std::move(p2) - s);
+            res.push_back(s * p0);
+        }
+        res.push_back(p0.extend_symbol_set(symbol_set{symbol{"a"}, symbol{"b"}, symbol{"c"}, symbol{"d"},
+                                                      symbol{"e"}, symbol{"f"}, symbol{"g"}}));
+    }
+    settings::reset_n_threads();
+    BOOST_CHECK_EQUAL(res.size() % 2u, 0u);
+    for (decltype(res.size()) i = 0u; i < res.size() / 2u; ++i) {
+        BOOST_CHECK_EQUAL(res[i], res[i + res.size() / 2u]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(series_merge_arguments_test)
+{
+    merge_arguments_tester<polynomial<integer, k_monomial>>();
+    merge_arguments_tester<polynomial<integer, monomial<int>>>();
+}
+
 template <typename T, typename... Args>
 inline void checker(const T &s, Args... args)
 {
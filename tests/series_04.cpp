@@ -34,6 +34,7 @@ see https://www.gnu.org/licenses/. */
 #include <algorithm>
 #include <boost/mpl/for_each.hpp>
 #include <boost/mpl/vector.hpp>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <sstream>
@@ -56,6 +57,8 @@ see https://www.gnu.org/licenses/. */
 #include "../src/serialization.hpp"
 #include "../src/series_multiplier.hpp"
 #include "../src/settings.hpp"
+#include "../src/symbol.hpp"
+#include "../src/symbol_set.hpp"
 #include "../src/type_traits.hpp"
 
 using namespace piranha;
@@ -471,6 +474,45 @@ BOOST_AUTO_TEST_CASE(series_transform_test)
                       p_type2{"y"} * x + p_type2{"x"});
 }
 
+BOOST_AUTO_TEST_CASE(series_filter_transform_trim_mt_test)
+{
+    using p_type = polynomial<integer, monomial<int>>;
+    using pair_type = std::decay<decltype(*(p_type{}.begin()))>::type;
+    p_type x{"x"}, y{"y"}, z{"z"}, t{"t"}, u{"u"};
+    // Large enough for the parallel trimming to kick in.
+    const auto p = math::pow(x + y + z + t + u + 1, 17);
+    settings::set_n_threads(4u);
+    BOOST_CHECK_THROW(p.filter([](const pair_type &) { return true; }, 0u), std::invalid_argument);
+    BOOST_CHECK_THROW(p.transform([](const pair_type &q) { return q; }, 0u), std::invalid_argument);
+    auto even = [](const pair_type &q) { return q.first % 2 == 0; };
+    auto f1 = p.filter(even), f4 = p.filter(even, 4u), f100 = p.filter(even, 100u);
+    BOOST_CHECK(f1.size() > 0u && f1.size() < p.size());
+    BOOST_CHECK_EQUAL(f1, f4);
+    BOOST_CHECK_EQUAL(f1, f100);
+    BOOST_CHECK_EQUAL(f1 + p.filter([&even](const pair_type &q) { return !even(q); }, 3u), p);
+    BOOST_CHECK(p.filter([](const pair_type &) { return false; }, 4u).empty());
+    std::function<bool(const pair_type &)> std_even(even);
+    BOOST_CHECK_EQUAL(p.filter(std_even, 4u), f1);
+    auto halve = [](const pair_type &q) { return pair_type(q.first / 2, q.second); };
+    auto t1 = p.transform(halve), t4 = p.transform(halve, 4u);
+    BOOST_CHECK_EQUAL(t1, t4);
+    BOOST_CHECK_EQUAL(t4 * 2, f1 + p.filter([&even](const pair_type &q) { return !even(q); }).transform(
+                                      [](const pair_type &q) { return pair_type(q.first - 1, q.second); }, 2u));
+    std::function<pair_type(const pair_type &)> std_halve(halve);
+    BOOST_CHECK_EQUAL(p.transform(std_halve, 4u), t1);
+    BOOST_CHECK_EQUAL(p_type{}.transform(halve, 4u), 0);
+    // Trimming.
+    const auto ext = p.extend_symbol_set(symbol_set{symbol{"a"}, symbol{"t"}, symbol{"u"}, symbol{"v"}, symbol{"x"},
+                                                    symbol{"y"}, symbol{"z"}});
+    const auto tr = ext.trim();
+    BOOST_CHECK(tr.get_symbol_set() == p.get_symbol_set());
+    BOOST_CHECK_EQUAL(tr, p);
+    BOOST_CHECK((p - x).trim().get_symbol_set() == p.get_symbol_set());
+    BOOST_CHECK(((x + 1) * (p - p + 1) + y - y).trim().get_symbol_set() == symbol_set{symbol{"x"}});
+    settings::reset_n_threads();
+    BOOST_CHECK_EQUAL(tr, ext.trim());
+}
+
 struct print_tex_tester {
     template <typename Cf>
     struct runner {
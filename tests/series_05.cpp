@@ -34,6 +34,7 @@ see https://www.gnu.org/licenses/. */
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 
@@ -307,3 +308,78 @@ BOOST_AUTO_TEST_CASE(series_evaluation_test)
                     != std::string::npos);
     }
 }
+
+BOOST_AUTO_TEST_CASE(series_product_cache_test)
+{
+    using p_type = polynomial<integer, monomial<int>>;
+    p_type x{"x"}, y{"y"}, z{"z"};
+    const auto a = math::pow(x + y + 1, 4), b = math::pow(x - z + 2, 3), c = x * y * z - 3;
+    const auto ab = a * b, ac = a * c, ba = b * a;
+    // The fingerprints are computed once, and reused in all the lookups.
+    const series_fingerprint fa(a), fb(b), fc(c), fx(x), fy(y);
+    // Disabled by default.
+    BOOST_CHECK_EQUAL(p_type::get_product_cache_max_terms(), 0u);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    BOOST_CHECK(p_type::get_product_cache_stats() == std::make_tuple(0u, 0u, 0u, 0u));
+    p_type::set_product_cache_max_terms(10000u);
+    BOOST_CHECK_EQUAL(p_type::get_product_cache_max_terms(), 10000u);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    BOOST_CHECK(fa == series_fingerprint(a));
+    BOOST_CHECK(fa != fb);
+    BOOST_CHECK_EQUAL(fa.size(), a.size());
+    BOOST_CHECK_EQUAL(fa.hash(), a.hash());
+    BOOST_CHECK(fa.get_symbol_set() == a.get_symbol_set());
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(b, fb, a, fa), ba);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, c, fc), ac);
+    auto st = p_type::get_product_cache_stats();
+    BOOST_CHECK_EQUAL(std::get<0u>(st), 2u);
+    BOOST_CHECK_EQUAL(std::get<1u>(st), 3u);
+    BOOST_CHECK_EQUAL(std::get<2u>(st), 3u);
+    BOOST_CHECK_EQUAL(std::get<3u>(st), 3u * a.size() + 2u * b.size() + c.size() + 2u * ab.size() + ac.size());
+    // Series with the same fingerprint but different terms are not confused.
+    const auto a2 = a + x - y;
+    const series_fingerprint fa2(a2);
+    BOOST_CHECK(fa2 == fa);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a2, fa2, b, fb), a2 * b);
+    // Series differing only in the symbol set are not confused either.
+    p_type t{"t"};
+    const auto c2 = c + t - t;
+    const series_fingerprint fc2(c2);
+    BOOST_CHECK(fc2 != fc);
+    BOOST_CHECK(p_type::cached_multiplication(a, fa, c2, fc2).get_symbol_set() == (a * c2).get_symbol_set());
+    // LRU eviction: the least recently used entry (b * a) goes first.
+    const auto n_terms = std::get<3u>(p_type::get_product_cache_stats());
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    p_type::set_product_cache_max_terms(n_terms - 1u);
+    st = p_type::get_product_cache_stats();
+    BOOST_CHECK(std::get<3u>(st) <= n_terms - 1u);
+    BOOST_CHECK_EQUAL(std::get<2u>(st), 4u);
+    const auto hits = std::get<0u>(st), misses = std::get<1u>(st);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    BOOST_CHECK_EQUAL(std::get<0u>(p_type::get_product_cache_stats()), hits + 1u);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(b, fb, a, fa), ba);
+    BOOST_CHECK_EQUAL(std::get<1u>(p_type::get_product_cache_stats()), misses + 1u);
+    // Products too large for the cache are not stored.
+    p_type::set_product_cache_max_terms(10u);
+    BOOST_CHECK_EQUAL(std::get<2u>(p_type::get_product_cache_stats()), 0u);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    BOOST_CHECK_EQUAL(std::get<2u>(p_type::get_product_cache_stats()), 0u);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(x, fx, y, fy), x * y);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(x, fx, y, fy), x * y);
+    BOOST_CHECK_EQUAL(std::get<2u>(p_type::get_product_cache_stats()), 1u);
+    // Changing the truncation settings clears the cache.
+    p_type::set_product_cache_max_terms(10000u);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    p_type::set_auto_truncate_degree(2);
+    BOOST_CHECK_EQUAL(std::get<2u>(p_type::get_product_cache_stats()), 0u);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), (a * b).truncate_degree(2));
+    p_type::unset_auto_truncate_degree();
+    BOOST_CHECK_EQUAL(std::get<2u>(p_type::get_product_cache_stats()), 0u);
+    BOOST_CHECK_EQUAL(p_type::cached_multiplication(a, fa, b, fb), ab);
+    p_type::clear_product_cache();
+    BOOST_CHECK(p_type::get_product_cache_stats() == std::make_tuple(0u, 0u, 0u, 0u));
+    BOOST_CHECK_EQUAL(p_type::get_product_cache_max_terms(), 10000u);
+    p_type::set_product_cache_max_terms(0u);
+}
@@ -33,6 +33,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -40,6 +41,8 @@ see https://www.gnu.org/licenses/. */
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 
 #include "../src/base_series_multiplier.hpp"
 #include "../src/config.hpp"
@@ -48,6 +51,7 @@ see https://www.gnu.org/licenses/. */
 #include "../src/init.hpp"
 #include "../src/is_key.hpp"
 #include "../src/key_is_multipliable.hpp"
+#include "../src/kronecker_monomial.hpp"
 #include "../src/math.hpp"
 #include "../src/monomial.hpp"
 #include "../src/mp_integer.hpp"
@@ -56,6 +60,7 @@ see https://www.gnu.org/licenses/. */
 #include "../src/serialization.hpp"
 #include "../src/series.hpp"
 #include "../src/series_multiplier.hpp"
+#include "../src/settings.hpp"
 #include "../src/symbol_set.hpp"
 #include "../src/term.hpp"
 
@@ -197,6 +202,12 @@ BOOST_AUTO_TEST_CASE(subs_series_subs_test)
         BOOST_CHECK(tmp6.is_identical(math::subs(3 * x + y * y / 7, "y", z * 2)));
         BOOST_CHECK((std::is_same<decltype(tmp6), stype0>::value));
         BOOST_CHECK_EQUAL(tmp6, 3 * x + 4 * z * z / 7);
+        // Rational substitutions with many colliding terms and cancellations.
+        auto tmp7 = math::pow(x + y / 3 + z - 2 / 7_q, 6).subs("x", 3 / 5_q);
+        BOOST_CHECK((std::is_same<decltype(tmp7), stype0>::value));
+        BOOST_CHECK_EQUAL(tmp7, math::pow(y / 3 + z - 2 / 7_q + 3 / 5_q, 6));
+        BOOST_CHECK_EQUAL((x * y - y / 2 + x * x * z - z / 4).subs("x", 1 / 2_q), 0);
+        BOOST_CHECK_EQUAL(stype0{}.subs("x", 1 / 2_q), 0);
     }
     // Subs on cf only.
     using stype1 = g_series_type<stype0, new_monomial<int>>;
@@ -291,6 +302,158 @@ BOOST_AUTO_TEST_CASE(subs_series_subs_test)
     }
 }
 
+// Term-by-term substitution in the keys, used to check the grouped implementation.
+template <typename S, typename T>
+static auto naive_key_subs(const S &s, const std::string &name, const T &x) -> decltype(s.subs(name, x))
+{
+    decltype(s.subs(name, x)) retval(0);
+    for (const auto &t : s._container()) {
+        for (auto &p : t.m_key.subs(name, x, s.get_symbol_set())) {
+            S tmp;
+            tmp.set_symbol_set(s.get_symbol_set());
+            tmp.insert(typename S::term_type(t.m_cf, std::move(p.second)));
+            retval += tmp * p.first;
+        }
+    }
+    return retval;
+}
+
+template <typename Key>
+static void grouped_subs_tester()
+{
+    using stype = g_series_type<rational, Key>;
+    BOOST_CHECK(detail::key_has_subs_split<Key>::value);
+    stype x{"x"}, y{"y"}, z{"z"}, t{"t"}, u{"u"};
+    // Empty series.
+    BOOST_CHECK_EQUAL(stype{}.subs("x", y + 1), 0);
+    BOOST_CHECK_EQUAL(stype{}.subs("x", 1.5), 0);
+    // A series with several thousands of terms, so that multiple threads are used.
+    const auto s = math::pow(x + y / 2 - z + 2 * t / 3 + u - 1, 10) + x * x * y;
+    for (unsigned nt = 1u; nt <= 4u; ++nt) {
+        settings::set_n_threads(nt);
+        // Substitution with a series.
+        auto res = s.subs("x", y - 2 * t + 1 / 3_q);
+        BOOST_CHECK((std::is_same<decltype(res), stype>::value));
+        BOOST_CHECK_EQUAL(res, naive_key_subs(s, "x", y - 2 * t + 1 / 3_q));
+        BOOST_CHECK_EQUAL(res, math::pow(y / 2 - z + 2 * t / 3 + u - 1 + y - 2 * t + 1 / 3_q, 10)
+                                   + math::pow(y - 2 * t + 1 / 3_q, 2) * y);
+        // The symbol set is preserved.
+        BOOST_CHECK(res.get_symbol_set() == s.get_symbol_set());
+        // Substitution with a series which cancels out everything.
+        BOOST_CHECK_EQUAL((s - x * x * y).subs("u", x / -1 - y / 2 + z - 2 * t / 3 + 1), 0);
+        // Substitution with a floating-point value.
+        auto res_d = s.subs("y", 1.5);
+        BOOST_CHECK((std::is_same<decltype(res_d), g_series_type<double, Key>>::value));
+        const auto diff = res_d - naive_key_subs(s, "y", 1.5);
+        for (const auto &term : diff._container()) {
+            BOOST_CHECK(std::abs(term.m_cf) < 1E-9);
+        }
+        // Symbol not in the series.
+        BOOST_CHECK_EQUAL(s.subs("v", y + 1), s);
+        // Rational substitution.
+        BOOST_CHECK_EQUAL(s.subs("z", 3 / 7_q), naive_key_subs(s, "z", 3 / 7_q));
+    }
+    settings::reset_n_threads();
+}
+
+BOOST_AUTO_TEST_CASE(subs_series_grouped_subs_test)
+{
+    grouped_subs_tester<monomial<int>>();
+    grouped_subs_tester<kronecker_monomial<>>();
+    BOOST_CHECK((!detail::key_has_subs_split<new_monomial<int>>::value));
+    {
+        // Substitution in the coefficients only, with and without change of coefficient type.
+        using stype0 = g_series_type<rational, monomial<int>>;
+        using stype1 = g_series_type<stype0, monomial<int>>;
+        stype1 x{stype0{"x"}}, y{stype0{"y"}}, z{"z"}, t{"t"};
+        const auto s = math::pow(x + y + z + t + 1, 12);
+        const stype0 y0{"y"};
+        for (unsigned nt = 1u; nt <= 4u; ++nt) {
+            settings::set_n_threads(nt);
+            auto res = s.subs("x", y0 - 1);
+            BOOST_CHECK((std::is_same<decltype(res), stype1>::value));
+            BOOST_CHECK(res.is_identical(math::pow(2 * y + z + t, 12)));
+            BOOST_CHECK_EQUAL(s.subs("x", -y - z - t - 1), 0);
+            auto res_d = s.subs("y", .5);
+            BOOST_CHECK_EQUAL(res_d, math::pow(x + .5 + z + t + 1, 12));
+        }
+        settings::reset_n_threads();
+    }
+}
+
+template <typename Key>
+static void dict_subs_tester()
+{
+    using stype = g_series_type<rational, Key>;
+    using dict = std::unordered_map<std::string, stype>;
+    using q_dict = std::unordered_map<std::string, rational>;
+    using d_dict = std::unordered_map<std::string, double>;
+    stype x{"x"}, y{"y"}, z{"z"}, t{"t"}, u{"u"};
+    // Empty series and empty dictionary.
+    BOOST_CHECK_EQUAL(stype{}.subs(dict{{"x", y}}), 0);
+    BOOST_CHECK_EQUAL((x + y).subs(dict{}), x + y);
+    BOOST_CHECK_EQUAL((x + y).subs(d_dict{}), x + y);
+    BOOST_CHECK((std::is_same<decltype((x + y).subs(d_dict{})), g_series_type<double, Key>>::value));
+    // A series with several thousands of terms, so that multiple threads are used.
+    const auto s = math::pow(x + y / 2 - z + 2 * t / 3 + u - 1, 10) + x * x * y;
+    for (unsigned nt = 1u; nt <= 4u; ++nt) {
+        settings::set_n_threads(nt);
+        // The substitution is simultaneous: swap x and y.
+        auto res = s.subs(dict{{"x", y}, {"y", x}});
+        BOOST_CHECK((std::is_same<decltype(res), stype>::value));
+        BOOST_CHECK_EQUAL(res, math::pow(y + x / 2 - z + 2 * t / 3 + u - 1, 10) + y * y * x);
+        BOOST_CHECK(res.get_symbol_set() == s.get_symbol_set());
+        // Chained substitutions give the same result if the values do not contain the substituted symbols.
+        const dict d{{"x", t - 2 * u + 1 / 3_q}, {"z", t * t}, {"v", u}};
+        BOOST_CHECK_EQUAL(s.subs(d), s.subs("x", t - 2 * u + 1 / 3_q).subs("z", t * t));
+        // Cancellation.
+        BOOST_CHECK_EQUAL((s - x * x * y).subs(dict{{"u", 2 * t / -3 + 1 - x}, {"z", y / 2}}), 0);
+        // Rational and floating-point values.
+        const q_dict dq{{"x", 1 / 2_q}, {"y", -3 / 5_q}, {"t", 2_q}};
+        BOOST_CHECK_EQUAL(s.subs(dq), s.subs("x", 1 / 2_q).subs("y", -3 / 5_q).subs("t", 2_q));
+        auto res_d = s.subs(d_dict{{"x", 1.5}, {"u", -.25}});
+        BOOST_CHECK((std::is_same<decltype(res_d), g_series_type<double, Key>>::value));
+        const auto diff = res_d - s.subs("x", 1.5).subs("u", -.25);
+        for (const auto &term : diff._container()) {
+            BOOST_CHECK(std::abs(term.m_cf) < 1E-9);
+        }
+        // All the symbols.
+        BOOST_CHECK_EQUAL(s.subs(q_dict{{"x", 1_q}, {"y", 2_q}, {"z", 1_q}, {"t", 3_q}, {"u", 0_q}}),
+                          math::pow(1 + 1 - 1 + 2 + 0 - 1_q, 10) + 2);
+        // Symbols not in the series.
+        BOOST_CHECK_EQUAL(s.subs(dict{{"v", y + 1}, {"w", x}}), s);
+    }
+    settings::reset_n_threads();
+}
+
+BOOST_AUTO_TEST_CASE(subs_series_dict_subs_test)
+{
+    dict_subs_tester<monomial<int>>();
+    dict_subs_tester<kronecker_monomial<>>();
+    {
+        // Substitution in the coefficients and in the keys.
+        using stype0 = g_series_type<rational, monomial<int>>;
+        using stype1 = g_series_type<stype0, monomial<int>>;
+        using dict0 = std::unordered_map<std::string, stype0>;
+        stype1 x{stype0{"x"}}, y{stype0{"y"}}, z{"z"}, t{"t"};
+        const stype0 x0{"x"}, y0{"y"}, z0{"z"};
+        const auto s = math::pow(x + y + z + t + 1, 12);
+        for (unsigned nt = 1u; nt <= 4u; ++nt) {
+            settings::set_n_threads(nt);
+            // Coefficients only.
+            auto res = s.subs(dict0{{"x", y0}, {"y", x0 - 1}});
+            BOOST_CHECK((std::is_same<decltype(res), stype1>::value));
+            BOOST_CHECK_EQUAL(res, math::pow(x + y + z + t, 12));
+            // Coefficients and keys.
+            BOOST_CHECK_EQUAL(s.subs(dict0{{"x", y0}, {"z", x0 - 1}}), math::pow(x + 2 * y + t, 12));
+            BOOST_CHECK_EQUAL(s.subs(dict0{{"x", z0}, {"z", -x0 - y0 - 1}, {"t", stype0{}}}),
+                              math::pow(stype1{z0} - x, 12));
+            BOOST_CHECK_EQUAL(s.subs(dict0{{"x", -y0 - 1}, {"z", stype0{}}, {"t", stype0{}}}), 0);
+        }
+        settings::reset_n_threads();
+    }
+}
+
 BOOST_AUTO_TEST_CASE(subs_series_serialization_test)
 {
     using stype = g_series_type<rational, monomial<int>>;
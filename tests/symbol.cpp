@@ -37,7 +37,9 @@ see https://www.gnu.org/licenses/. */
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include "../src/init.hpp"
 #include "../src/serialization.hpp"
@@ -94,13 +96,50 @@ BOOST_AUTO_TEST_CASE(symbol_operators_test)
     BOOST_CHECK(symbol("a") < symbol("b"));
     BOOST_CHECK(!(symbol("a") < symbol("a")));
     BOOST_CHECK(symbol("abc") < symbol("abd"));
+    BOOST_CHECK(!(symbol("abd") < symbol("abc")));
+}
+
+BOOST_AUTO_TEST_CASE(symbol_id_test)
+{
+    // Ids are unique and they do not change.
+    BOOST_CHECK_EQUAL(symbol("x").get_id(), symbol("x").get_id());
+    BOOST_CHECK(symbol("x").get_id() != symbol("y").get_id());
+    symbol a("__id_test_a"), b("__id_test_b");
+    BOOST_CHECK_EQUAL(b.get_id(), a.get_id() + 1u);
+    BOOST_CHECK_EQUAL(symbol(b).get_id(), b.get_id());
+    // Concurrent creation: all threads must agree on the ids and on the underlying objects.
+    const unsigned nt = 4u, ns = 100u;
+    std::vector<std::vector<symbol>> res(nt);
+    std::vector<std::thread> threads;
+    for (unsigned i = 0u; i < nt; ++i) {
+        threads.emplace_back([i, &res]() {
+            for (unsigned j = 0u; j < ns; ++j) {
+                // Look up each name twice, to exercise the thread-local cache.
+                res[i].emplace_back("__id_test_" + std::to_string((j * (i + 1u)) % ns));
+                res[i].emplace_back(res[i].back().get_name());
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    std::unordered_set<std::size_t> ids;
+    for (unsigned i = 0u; i < nt; ++i) {
+        for (const auto &s : res[i]) {
+            const symbol tmp(s.get_name());
+            BOOST_CHECK(tmp == s);
+            BOOST_CHECK_EQUAL(tmp.get_id(), s.get_id());
+            ids.insert(s.get_id());
+        }
+    }
+    BOOST_CHECK_EQUAL(ids.size(), ns);
 }
 
 BOOST_AUTO_TEST_CASE(symbol_hash_test)
 {
     BOOST_CHECK_NO_THROW(symbol("x").hash());
     BOOST_CHECK_EQUAL(symbol("x").hash(), std::hash<symbol>()(symbol("x")));
-    BOOST_CHECK_EQUAL(symbol("x").hash(), std::hash<std::string const *>()(std::addressof(symbol("x").get_name())));
+    BOOST_CHECK_EQUAL(symbol("x").hash(), std::hash<std::size_t>()(symbol("x").get_id()));
     BOOST_CHECK(is_hashable<symbol>::value);
     BOOST_CHECK(is_hashable<symbol &>::value);
     BOOST_CHECK(is_hashable<symbol &&>::value);
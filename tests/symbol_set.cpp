@@ -469,6 +469,19 @@ BOOST_AUTO_TEST_CASE(symbol_set_positions_map_test)
     std::vector<pmap::value_type> cmp3{{3u, -5}};
     BOOST_CHECK(std::equal(pm3.begin(), pm3.end(), cmp3.begin()));
     BOOST_CHECK((pm3.back() == pmap::value_type{3u, -5}));
+    // Construction from string maps.
+    using smap = std::unordered_map<std::string, int>;
+    pmap pm4(a, smap{{"a", 4}, {"b", -5}, {"e", 6}, {"z", 4}, {"h", -1}, {"c", 3}, {"d", -20}});
+    BOOST_CHECK_EQUAL(pm4.size(), 2u);
+    BOOST_CHECK(std::equal(pm4.begin(), pm4.end(), cmp1.begin()));
+    pmap pm5(a, smap{});
+    BOOST_CHECK_EQUAL(pm5.size(), 0u);
+    pmap pm6(symbol_set{}, smap{{"a", 4}});
+    BOOST_CHECK_EQUAL(pm6.size(), 0u);
+    pmap pm7(a, smap{{"i", 1}, {"b", 2}, {"f", 3}, {"c", 4}});
+    std::vector<pmap::value_type> cmp7{{0u, 2}, {1u, 4}, {2u, 3}, {3u, 1}};
+    BOOST_CHECK_EQUAL(pm7.size(), 4u);
+    BOOST_CHECK(std::equal(pm7.begin(), pm7.end(), cmp7.begin()));
     // pmappable type trait.
     BOOST_CHECK(detail::is_pmappable<pmap1_t>::value);
     BOOST_CHECK(!detail::is_pmappable<pmap2_t>::value);
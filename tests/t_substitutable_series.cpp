@@ -51,6 +51,8 @@ see https://www.gnu.org/licenses/. */
 #include "../src/pow.hpp"
 #include "../src/real.hpp"
 #include "../src/serialization.hpp"
+#include "../src/settings.hpp"
+#include "../src/symbol.hpp"
 #include "../src/symbol_set.hpp"
 
 using namespace piranha;
@@ -209,6 +211,165 @@ BOOST_AUTO_TEST_CASE(t_subs_series_t_subs_test)
     BOOST_CHECK((!has_t_subs<g_series_type<double, key02>, double, double>::value));
 }
 
+// Term-by-term trigonometric substitution in the keys, used to check the grouped implementation.
+template <typename S, typename T>
+static S naive_key_t_subs(const S &s, const std::string &name, const T &c, const T &sn)
+{
+    S retval;
+    for (const auto &t : s._container()) {
+        for (const auto &p : t.m_key.t_subs(name, c, sn, s.get_symbol_set())) {
+            S tmp;
+            tmp.set_symbol_set(s.get_symbol_set());
+            tmp.insert(typename S::term_type(t.m_cf, p.second));
+            retval += p.first * tmp;
+        }
+    }
+    return retval;
+}
+
+// Same for plain substitution.
+template <typename S, typename T>
+static auto naive_key_subs(const S &s, const std::string &name, const T &x) -> decltype(s.subs(name, x))
+{
+    decltype(s.subs(name, x)) retval;
+    for (const auto &t : s._container()) {
+        for (const auto &p : t.m_key.subs(name, x, s.get_symbol_set())) {
+            S tmp;
+            tmp.set_symbol_set(s.get_symbol_set());
+            tmp.insert(typename S::term_type(t.m_cf, p.second));
+            retval += tmp * p.first;
+        }
+    }
+    return retval;
+}
+
+BOOST_AUTO_TEST_CASE(t_subs_series_grouped_test)
+{
+    using p_type = poisson_series<polynomial<rational, monomial<short>>>;
+    using key_type = p_type::term_type::key_type;
+    BOOST_CHECK(detail::key_has_subs_split<key_type>::value);
+    p_type x{"x"}, y{"y"}, z{"z"}, a{"a"}, b{"b"};
+    // A series with several hundreds of terms, with all the combinations of sign and flavour.
+    p_type s;
+    for (int i = -4; i <= 4; ++i) {
+        for (int j = -4; j <= 4; ++j) {
+            for (int k = 0; k <= 3; ++k) {
+                s += (i + 2 * j - k + a) * math::cos(i * x + j * y + k * z)
+                     + (i - j + k * b) / 3 * math::sin(i * x + j * y + k * z);
+            }
+        }
+    }
+    // A series with rational coefficients and a few thousands of terms, in which the substitution affects
+    // only the keys.
+    using p_type2 = poisson_series<rational>;
+    p_type2 s2;
+    s2.set_symbol_set(symbol_set{symbol{"x"}, symbol{"y"}, symbol{"z"}});
+    for (int i = -6; i <= 6; ++i) {
+        for (int j = -6; j <= 6; ++j) {
+            for (int k = -6; k <= 6; ++k) {
+                // Skip the non-canonical keys.
+                if (i < 0 || (i == 0 && j < 0) || (i == 0 && j == 0 && k < 0)) {
+                    continue;
+                }
+                key_type k_cos{i, j, k}, k_sin{i, j, k};
+                k_sin.set_flavour(false);
+                s2.insert(p_type2::term_type(rational(i + 2 * j - k), k_cos));
+                s2.insert(p_type2::term_type(rational(i - j + k, 3), k_sin));
+            }
+        }
+    }
+    const auto cmp_x = naive_key_t_subs(s, "x", a, b), cmp_y = naive_key_t_subs(s, "y", a * a - 1, b),
+               cmp_z = naive_key_t_subs(s, "z", 3 / 5_q * a, p_type{4 / 5_q});
+    const auto cmp2_y = naive_key_t_subs(s2, "y", 3 / 5_q, 4 / 5_q);
+    const auto cmp2_z = naive_key_subs(s2, "z", 1.5_r);
+    for (unsigned nt = 1u; nt <= 4u; ++nt) {
+        settings::set_n_threads(nt);
+        auto res = s.t_subs("x", a, b);
+        BOOST_CHECK((std::is_same<decltype(res), p_type>::value));
+        BOOST_CHECK_EQUAL(res, cmp_x);
+        BOOST_CHECK(res.get_symbol_set() == s.get_symbol_set());
+        BOOST_CHECK_EQUAL(s.t_subs("y", a * a - 1, b), cmp_y);
+        BOOST_CHECK_EQUAL(s.t_subs("z", 3 / 5_q * a, p_type{4 / 5_q}), cmp_z);
+        BOOST_CHECK_EQUAL(s.t_subs("c", a, b), s);
+        BOOST_CHECK_EQUAL(s2.t_subs("y", 3 / 5_q, 4 / 5_q), cmp2_y);
+        BOOST_CHECK_EQUAL(s2.t_subs("c", 3 / 5_q, 4 / 5_q), s2);
+        // Plain substitution.
+        auto res2 = s2.subs("z", 1.5_r);
+        BOOST_CHECK((std::is_same<decltype(res2), poisson_series<real>>::value));
+        const auto diff = res2 - cmp2_z;
+        for (const auto &t : diff._container()) {
+            BOOST_CHECK(math::abs(t.m_cf) < 1E-30);
+        }
+        BOOST_CHECK_EQUAL(s2.subs("x", 0_q), naive_key_subs(s2, "x", 0_q));
+    }
+    settings::reset_n_threads();
+}
+
+BOOST_AUTO_TEST_CASE(t_subs_series_dict_test)
+{
+    using p_type = poisson_series<polynomial<rational, monomial<short>>>;
+    using dict = std::unordered_map<std::string, std::pair<p_type, p_type>>;
+    p_type x{"x"}, y{"y"}, z{"z"}, a{"a"}, b{"b"};
+    BOOST_CHECK_EQUAL(p_type{}.t_subs(dict{{"x", {a, b}}}), 0);
+    BOOST_CHECK_EQUAL(math::cos(x).t_subs(dict{}), math::cos(x));
+    // The same series, with x and y swapped.
+    p_type s, s_swap;
+    for (int i = -3; i <= 3; ++i) {
+        for (int j = -3; j <= 3; ++j) {
+            for (int k = 0; k <= 2; ++k) {
+                s += (i + 2 * j - k + a) * math::cos(i * x + j * y + k * z)
+                     + (i - j + k * b) / 3 * math::sin(i * x + j * y + k * z);
+                s_swap += (i + 2 * j - k + a) * math::cos(i * y + j * x + k * z)
+                          + (i - j + k * b) / 3 * math::sin(i * y + j * x + k * z);
+            }
+        }
+    }
+    // Rational coefficients.
+    using p_type2 = poisson_series<rational>;
+    using q_dict = std::unordered_map<std::string, std::pair<rational, rational>>;
+    using key_type = p_type2::term_type::key_type;
+    p_type2 s2;
+    s2.set_symbol_set(symbol_set{symbol{"x"}, symbol{"y"}, symbol{"z"}});
+    for (int i = -6; i <= 6; ++i) {
+        for (int j = -6; j <= 6; ++j) {
+            for (int k = -6; k <= 6; ++k) {
+                // Skip the non-canonical keys.
+                if (i < 0 || (i == 0 && j < 0) || (i == 0 && j == 0 && k < 0)) {
+                    continue;
+                }
+                key_type k_cos{i, j, k}, k_sin{i, j, k};
+                k_sin.set_flavour(false);
+                s2.insert(p_type2::term_type(rational(i + 2 * j - k), k_cos));
+                s2.insert(p_type2::term_type(rational(i - j + k, 3), k_sin));
+            }
+        }
+    }
+    const auto cmp = s.t_subs("x", a, b).t_subs("z", a * a - 1, b);
+    const auto cmp2 = s2.t_subs("x", 3 / 5_q, 4 / 5_q).t_subs("y", -4 / 5_q, 3 / 5_q);
+    const auto cmp2_d = s2.subs("x", 1.5_r).subs("y", -.5_r);
+    for (unsigned nt = 1u; nt <= 4u; ++nt) {
+        settings::set_n_threads(nt);
+        auto res = s.t_subs(dict{{"x", {a, b}}, {"z", {a * a - 1, b}}});
+        BOOST_CHECK((std::is_same<decltype(res), p_type>::value));
+        BOOST_CHECK_EQUAL(res, cmp);
+        // The substitution is simultaneous: swap x and y. This check is expensive, hence it is run only once.
+        if (nt == 1u) {
+            BOOST_CHECK_EQUAL(
+                s.t_subs(dict{{"x", {math::cos(y), math::sin(y)}}, {"y", {math::cos(x), math::sin(x)}}}), s_swap);
+        }
+        BOOST_CHECK_EQUAL(s.t_subs(dict{{"c", {a, b}}}), s);
+        BOOST_CHECK_EQUAL(s2.t_subs(q_dict{{"x", {3 / 5_q, 4 / 5_q}}, {"y", {-4 / 5_q, 3 / 5_q}}}), cmp2);
+        // Plain substitution.
+        auto res2 = s2.subs(std::unordered_map<std::string, real>{{"x", 1.5_r}, {"y", -.5_r}});
+        BOOST_CHECK((std::is_same<decltype(res2), poisson_series<real>>::value));
+        const auto diff = res2 - cmp2_d;
+        for (const auto &t : diff._container()) {
+            BOOST_CHECK(math::abs(t.m_cf) < 1E-30);
+        }
+    }
+    settings::reset_n_threads();
+}
+
 BOOST_AUTO_TEST_CASE(t_subs_series_serialization_test)
 {
     using stype = poisson_series<polynomial<rational, monomial<short>>>;